@@ -0,0 +1,120 @@
+#include <ogdf/basic/Graph.h>
+#include <ogdf/basic/Math.h>
+#include <ogdf/basic/Thread.h>
+#include <ogdf/basic/basic.h>
+#include <ogdf/graphalg/MatchingBlossom.h>
+#include <ogdf/graphalg/MatchingBlossomV.h>
+#include <ogdf/graphalg/MatchingModule.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+using namespace ogdf;
+
+// Returns the seconds passed since start.
+static double since(std::chrono::steady_clock::time_point start)
+{
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+static void run(const std::string& name, MatchingModule<double>& matching, const Graph& G,
+		const EdgeArray<double>& weight)
+{
+	std::unordered_set<edge> result;
+	auto start = std::chrono::steady_clock::now();
+	bool found = matching.minimumWeightPerfectMatching(G, weight, result);
+	double seconds = since(start);
+	std::cout << std::left << std::setw(46) << name << std::right << std::fixed
+	          << std::setprecision(3) << std::setw(8) << seconds << " s  ";
+	if (found) {
+		std::cout << "weight " << std::setprecision(6) << matching.matchingWeight(result, weight);
+	} else {
+		std::cout << "no perfect matching";
+	}
+	std::cout << std::endl;
+}
+
+int main(int argc, char* argv[])
+{
+	// usage: ex-blossom-v-benchmark [nodes [degree [threads]]]
+	const int n = 2 * ((argc > 1 ? std::stoi(argv[1]) : 10000) / 2);
+	const double degree = argc > 2 ? std::stod(argv[2]) : 10;
+	const unsigned int maxThreads = argc > 3 ? std::stoul(argv[3])
+	                                         : std::max(1u, Thread::hardware_concurrency());
+
+	// random points in the unit square, each connected to all points within the radius that
+	// gives the requested average degree
+	setSeed(42);
+	Graph G;
+	NodeArray<double> x(G), y(G);
+	const double radius = std::sqrt(degree / (Math::pi * n));
+	const int cells = std::max(1, static_cast<int>(1 / radius));
+	auto cellOf = [&](double coord) { return std::min(cells - 1, static_cast<int>(coord * cells)); };
+	std::vector<std::vector<node>> grid(cells * cells);
+	for (int i = 0; i < n; ++i) {
+		node v = G.newNode();
+		x[v] = randomDouble(0, 1);
+		y[v] = randomDouble(0, 1);
+		grid[cellOf(x[v]) * cells + cellOf(y[v])].push_back(v);
+	}
+	auto dist = [&](node u, node v) { return std::hypot(x[u] - x[v], y[u] - y[v]); };
+	for (node u : G.nodes) {
+		const int cx = cellOf(x[u]);
+		const int cy = cellOf(y[u]);
+		for (int i = std::max(0, cx - 1); i <= std::min(cells - 1, cx + 1); ++i) {
+			for (int j = std::max(0, cy - 1); j <= std::min(cells - 1, cy + 1); ++j) {
+				for (node v : grid[i * cells + j]) {
+					if (u->index() < v->index() && dist(u, v) <= radius) {
+						G.newEdge(u, v);
+					}
+				}
+			}
+		}
+	}
+
+	// pairs of nodes consecutive in grid order are connected as well, so that a perfect
+	// matching exists
+	node previous = nullptr;
+	for (const std::vector<node>& cell : grid) {
+		for (node v : cell) {
+			if (previous == nullptr) {
+				previous = v;
+			} else {
+				if (dist(previous, v) > radius) {
+					G.newEdge(previous, v);
+				}
+				previous = nullptr;
+			}
+		}
+	}
+
+	EdgeArray<double> weight(G);
+	for (edge e : G.edges) {
+		weight[e] = dist(e->source(), e->target());
+	}
+	std::cout << G.numberOfNodes() << " nodes, " << G.numberOfEdges() << " edges" << std::endl;
+
+	// the original Blossom algorithm takes minutes on larger instances
+	if (n <= 4000) {
+		MatchingBlossom<double> blossom;
+		run("Blossom I", blossom, G, weight);
+	}
+
+	for (bool greedyInit : {true, false}) {
+		for (unsigned int threads = 1; threads <= maxThreads; threads *= 2) {
+			MatchingBlossomV<double> blossomV(greedyInit);
+			blossomV.maxThreads(threads);
+			run(std::string("Blossom V") + (greedyInit ? "" : " without greedy init") + ", "
+							+ std::to_string(threads) + " thread(s)",
+					blossomV, G, weight);
+		}
+	}
+
+	return 0;
+}
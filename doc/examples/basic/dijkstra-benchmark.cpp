@@ -0,0 +1,69 @@
+#include <ogdf/basic/Graph.h>
+#include <ogdf/basic/List.h>
+#include <ogdf/basic/basic.h>
+#include <ogdf/basic/graph_generators/randomized.h>
+#include <ogdf/basic/heap/DaryHeap.h>
+#include <ogdf/basic/heap/PairingHeap.h>
+#include <ogdf/graphalg/Dijkstra.h>
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+using namespace ogdf;
+
+// Returns the seconds passed since start.
+static double since(std::chrono::steady_clock::time_point start)
+{
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+template<typename T, template<typename P, class C> class H>
+static void run(const std::string& name, const Graph& G, const EdgeArray<T>& weight, int runs)
+{
+	Dijkstra<T, H> dijkstra;
+	NodeArray<edge> predecessor;
+	NodeArray<T> distance;
+	double checksum = 0;
+
+	auto start = std::chrono::steady_clock::now();
+	node s = G.firstNode();
+	for (int i = 0; i < runs; ++i, s = s->succ()) {
+		List<node> sources {s};
+		dijkstra.call(G, weight, sources, predecessor, distance);
+		for (node v : G.nodes) {
+			checksum += distance[v];
+		}
+	}
+	std::cout << std::left << std::setw(32) << name << std::right << std::fixed
+	          << std::setprecision(3) << std::setw(8) << since(start) << " s  checksum "
+	          << std::setprecision(0) << checksum << std::endl;
+}
+
+int main(int argc, char* argv[])
+{
+	// usage: ex-dijkstra-benchmark [nodes [edges [runs]]]
+	const int n = argc > 1 ? std::stoi(argv[1]) : 200000;
+	const int m = argc > 2 ? std::stoi(argv[2]) : 5 * n;
+	const int runs = argc > 3 ? std::stoi(argv[3]) : 10;
+
+	setSeed(42);
+	Graph G;
+	randomSimpleConnectedGraph(G, n, m);
+	EdgeArray<int> intWeight(G);
+	EdgeArray<double> doubleWeight(G);
+	for (edge e : G.edges) {
+		intWeight[e] = randomNumber(1, 100);
+		doubleWeight[e] = randomDouble(1, 100);
+	}
+	std::cout << G.numberOfNodes() << " nodes, " << G.numberOfEdges() << " edges, " << runs
+	          << " sources" << std::endl;
+
+	run<int, PairingHeap>("int, PairingHeap", G, intWeight, runs);
+	run<int, DaryHeap>("int, DaryHeap (RadixHeap)", G, intWeight, runs);
+	run<double, PairingHeap>("double, PairingHeap", G, doubleWeight, runs);
+	run<double, DaryHeap>("double, DaryHeap", G, doubleWeight, runs);
+
+	return 0;
+}
@@ -0,0 +1,108 @@
+#include <ogdf/basic/ConcurrentDisjointSets.h>
+#include <ogdf/basic/DisjointSets.h>
+#include <ogdf/basic/Thread.h>
+
+#include <chrono>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace ogdf;
+
+using Pairs = std::vector<std::pair<int, int>>;
+
+// Returns the seconds passed since start.
+static double since(std::chrono::steady_clock::time_point start)
+{
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+static void report(const std::string& name, double seconds, int sets)
+{
+	std::cout << std::left << std::setw(48) << name << std::right << std::fixed
+	          << std::setprecision(3) << std::setw(8) << seconds << " s  " << sets << " sets"
+	          << std::endl;
+}
+
+template<typename DS>
+static void runSequential(const std::string& name, int n, const Pairs& pairs)
+{
+	auto start = std::chrono::steady_clock::now();
+	DS sets(n);
+	for (int i = 0; i < n; ++i) {
+		sets.makeSet();
+	}
+	for (const auto& p : pairs) {
+		sets.quickUnion(p.first, p.second);
+	}
+	report(name, since(start), sets.getNumberOfSets());
+}
+
+template<typename DS>
+static void runConcurrent(const std::string& name, int n, const Pairs& pairs, unsigned int threads)
+{
+	auto start = std::chrono::steady_clock::now();
+	DS sets(n);
+	for (int i = 0; i < n; ++i) {
+		sets.makeSet();
+	}
+
+	// the calling thread works on the first slice itself
+	const size_t m = pairs.size();
+	std::vector<std::function<void()>> jobs;
+	for (unsigned int t = 0; t < threads; ++t) {
+		jobs.emplace_back([&, t] {
+			for (size_t i = m * t / threads; i < m * (t + 1) / threads; ++i) {
+				sets.quickUnion(pairs[i].first, pairs[i].second);
+			}
+		});
+	}
+	std::vector<Thread> worker;
+	for (unsigned int t = 1; t < threads; ++t) {
+		worker.emplace_back(jobs[t]);
+	}
+	jobs[0]();
+	for (Thread& thread : worker) {
+		thread.join();
+	}
+	report(name + ", " + std::to_string(threads) + " thread(s)", since(start),
+			sets.getNumberOfSets());
+}
+
+int main(int argc, char* argv[])
+{
+	// usage: ex-disjoint-sets-benchmark [elements [unions [threads]]]
+	const int n = argc > 1 ? std::stoi(argv[1]) : 10000000;
+	const int m = argc > 2 ? std::stoi(argv[2]) : 2 * n;
+	const unsigned int maxThreads = argc > 3 ? std::stoul(argv[3])
+	                                         : std::max(1u, Thread::hardware_concurrency());
+
+	std::mt19937 rng(42);
+	std::uniform_int_distribution<int> dist(0, n - 1);
+	Pairs pairs(m);
+	for (auto& p : pairs) {
+		p = {dist(rng), dist(rng)};
+	}
+	std::cout << n << " elements, " << m << " unions" << std::endl;
+
+	runSequential<DisjointSets<>>("Index, PathSplitting", n, pairs);
+	runSequential<DisjointSets<LinkOptions::Index, CompressionOptions::PathCompression,
+			InterleavingOptions::Rem>>("Index, PathCompression, Rem", n, pairs);
+	runSequential<DisjointSets<LinkOptions::Rank, CompressionOptions::PathSplitting,
+			InterleavingOptions::Tarjan>>("Rank, PathSplitting, Tarjan", n, pairs);
+	runSequential<DisjointSets<LinkOptions::Size, CompressionOptions::PathHalving>>(
+			"Size, PathHalving", n, pairs);
+
+	for (unsigned int threads = 1; threads <= maxThreads; threads *= 2) {
+		runConcurrent<ConcurrentDisjointSets<>>("Concurrent Index, PathSplitting", n, pairs,
+				threads);
+		runConcurrent<ConcurrentDisjointSets<LinkOptions::Index, CompressionOptions::PathHalving>>(
+				"Concurrent Index, PathHalving", n, pairs, threads);
+	}
+
+	return 0;
+}
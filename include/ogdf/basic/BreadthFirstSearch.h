@@ -0,0 +1,172 @@
+/** \file
+ * \brief Declaration of class BreadthFirstSearch, a reusable and
+ * direction-optimizing breadth-first search.
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.md in the OGDF root directory for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, see
+ * http://www.gnu.org/copyleft/gpl.html
+ */
+
+#pragma once
+
+#include <ogdf/basic/Graph.h>
+#include <ogdf/basic/basic.h>
+#include <ogdf/basic/internal/parallel.h>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace ogdf {
+
+//! Breadth-first search engine for repeated searches in a static graph.
+/**
+ * @ingroup graph-algs
+ *
+ * The constructor copies the adjacency lists of the graph into flat arrays
+ * (in the order of the adjacency entries). Each call of run() computes the
+ * distance (level), the parent edge and the visiting order of all nodes
+ * reachable from the source. Only the nodes reached by the previous run are
+ * reset, so many searches that each explore a small part of the graph are
+ * cheap.
+ *
+ * Levels are expanded either top-down (scanning the edges of the frontier)
+ * or bottom-up (every unvisited node looks for a neighbor in the frontier,
+ * which is stored as a bitset). The direction is switched with the
+ * heuristic of Beamer, Asanović and Patterson: bottom-up as soon as the
+ * frontier has more than 1/#c_alpha of the unexplored edges, top-down again
+ * when it has less than 1/#c_beta of the nodes.
+ *
+ * Large levels are expanded by several threads. Distances are always the
+ * same, but parents and the order within a level may then depend on the
+ * scheduling. With one thread and direction optimization disabled, the
+ * search visits the nodes exactly in the order of a queue-based BFS that
+ * scans the adjacency lists in order.
+ *
+ * <H3>Optional parameters</H3>
+ *
+ * <table>
+ *   <tr>
+ *     <th><i>Option</i><th><i>Type</i><th><i>Default</i><th><i>Description</i>
+ *   </tr><tr>
+ *     <td><i>directionOptimizing</i><td>bool<td>true
+ *     <td>Whether bottom-up expansion may be used.
+ *   </tr><tr>
+ *     <td><i>maxThreads</i><td>int<td>System::numberOfProcessors()
+ *     <td>The maximal number of threads. At most one thread is used per
+ *     #c_minArcsPerThread arcs of the graph.
+ *   </tr>
+ * </table>
+ */
+class OGDF_EXPORT BreadthFirstSearch : public internal::MaxThreadsOption {
+public:
+	//! Parameter of the switch to bottom-up expansion.
+	static constexpr int c_alpha = 14;
+
+	//! Parameter of the switch back to top-down expansion.
+	static constexpr int c_beta = 24;
+
+	//! The minimal number of arcs per thread.
+	static constexpr int c_minArcsPerThread = 1 << 14;
+
+	/**
+	 * Creates an engine for \p G.
+	 *
+	 * @param G is the graph; it must not be changed while the engine is used.
+	 * @param directed is true iff edges may only be traversed from source to target.
+	 */
+	explicit BreadthFirstSearch(const Graph& G, bool directed = false);
+
+	//! Runs a breadth-first search from \p s.
+	void run(node s);
+
+	//! Returns true iff \p v was reached by the last run.
+	bool reached(node v) const { return distance(v) >= 0; }
+
+	//! Returns the distance of \p v to the source (-1 if \p v was not reached).
+	int distance(node v) const {
+		OGDF_ASSERT(v->graphOf() == &m_G);
+		return m_distance[v->index()].load(std::memory_order_relaxed);
+	}
+
+	//! Returns the edge by which \p v was reached (nullptr for the source and unreached nodes).
+	edge parent(node v) const {
+		OGDF_ASSERT(v->graphOf() == &m_G);
+		return m_parent[v->index()];
+	}
+
+	//! Returns the number of nodes reached by the last run.
+	int numberOfReachedNodes() const { return static_cast<int>(m_order.size()); }
+
+	//! Returns the <i>i</i>-th reached node; nodes are ordered by distance.
+	node reachedNode(int i) const { return m_nodes[m_order[i]]; }
+
+	//! Returns the number of levels, i.e., the maximal distance plus one.
+	int numberOfLevels() const { return static_cast<int>(m_levelBegin.size()) - 1; }
+
+	//! Returns the index of the first node with distance \p level, see reachedNode().
+	/**
+	 * levelBegin(numberOfLevels()) is numberOfReachedNodes().
+	 */
+	int levelBegin(int level) const { return m_levelBegin[level]; }
+
+	//! Assigns the distances (-1 for unreached nodes) of the last run to \p distance.
+	void distances(NodeArray<int>& distance) const;
+
+	//! Assigns the parent edges of the last run to \p parent.
+	void parents(NodeArray<edge>& parent) const;
+
+	//! Returns whether bottom-up expansion may be used.
+	bool directionOptimizing() const { return m_directionOptimizing; }
+
+	//! Sets whether bottom-up expansion may be used.
+	void directionOptimizing(bool enable) { m_directionOptimizing = enable; }
+
+private:
+	const Graph& m_G;
+	int m_n; //!< Size of all node arrays (maximal node index + 1).
+	bool m_directionOptimizing = true;
+
+	std::vector<node> m_nodes; //!< Node of each index (nullptr for unused indices).
+	std::vector<int> m_outBegin; //!< Start of the outgoing arcs of each node.
+	std::vector<int> m_outHead;
+	std::vector<edge> m_outEdge;
+	std::vector<int> m_inBegin; //!< Start of the incoming arcs (only if directed).
+	std::vector<int> m_inTail;
+	std::vector<edge> m_inEdge;
+	bool m_directed;
+
+	std::unique_ptr<std::atomic<int>[]> m_distance;
+	std::vector<edge> m_parent;
+	std::vector<int> m_order; //!< Reached nodes by level.
+	std::vector<int> m_levelBegin;
+	std::vector<uint64_t> m_frontierBits; //!< Frontier for bottom-up expansion.
+
+	//! Expands the level starting at m_levelBegin[\p level] with \p nThreads threads.
+	void expand(int level, bool bottomUp, unsigned int nThreads,
+			std::vector<std::vector<int>>& next);
+};
+
+}
@@ -0,0 +1,315 @@
+/** \file
+ * \brief Implementation of lock-free concurrent disjoint sets (union-find functionality).
+ *
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.md in the OGDF root directory for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, see
+ * http://www.gnu.org/copyleft/gpl.html
+ */
+
+#pragma once
+
+#include <ogdf/basic/DisjointSets.h>
+#include <ogdf/basic/basic.h>
+#include <ogdf/basic/internal/copy_move.h>
+
+#include <atomic>
+#include <utility>
+
+namespace ogdf {
+
+//! A lock-free Union/Find data structure for maintaining disjoint sets concurrently.
+/**
+ * The interface and the policy template parameters are those of DisjointSets.
+ * find(), getRepresentative(), sameSet(), quickUnion() and getNumberOfSets() may be called
+ * concurrently by several threads; makeSet() and init() may not.
+ *
+ * Sets are linked by index: the root with the smaller id is made a child of the root with
+ * the larger one by a compare-and-swap, so parent ids only increase and concurrent unions
+ * can never form a cycle. A union whose compare-and-swap fails because another thread
+ * linked one of the roots in the meantime retries from the new roots. Path compression
+ * only ever replaces a parent by one of its ancestors and therefore needs no synchronization.
+ *
+ * Only the policies that stay correct under concurrent compression are supported:
+ * LinkOptions::Index with CompressionOptions::PathSplitting, CompressionOptions::PathHalving
+ * or CompressionOptions::Disabled, and no interleaving.
+ *
+ * For linking by index, the expected running time depends on the order of the ids. If the
+ * ids do not follow a random order, a random permutation should be applied first.
+ */
+template<LinkOptions linkOption = LinkOptions::Index,
+		CompressionOptions compressionOption = CompressionOptions::PathSplitting,
+		InterleavingOptions interleavingOption = InterleavingOptions::Disabled>
+class ConcurrentDisjointSets {
+	static_assert(linkOption == LinkOptions::Index,
+			"Concurrent disjoint sets require linking by index.");
+	static_assert(compressionOption == CompressionOptions::PathSplitting
+					|| compressionOption == CompressionOptions::PathHalving
+					|| compressionOption == CompressionOptions::Disabled,
+			"Concurrent disjoint sets support path splitting, path halving or no compression.");
+	static_assert(interleavingOption == InterleavingOptions::Disabled,
+			"Concurrent disjoint sets do not support interleaving.");
+
+private:
+	std::atomic<int> m_numberOfSets; //!< Current number of disjoint sets.
+	int m_numberOfElements; //!< Current number of elements.
+	int m_maxNumberOfElements; //!< Maximum number of elements (array size) adjusted dynamically.
+
+	std::atomic<int>* m_parents; //!< Maps set id to parent set id.
+
+	//find
+	int find(disjoint_sets::CompressionOption<CompressionOptions::PathSplitting>, int set);
+	int find(disjoint_sets::CompressionOption<CompressionOptions::PathHalving>, int set);
+	int find(disjoint_sets::CompressionOption<CompressionOptions::Disabled>, int set);
+
+	//! Returns the parent of \p set.
+	int parent(int set) const { return m_parents[set].load(std::memory_order_acquire); }
+
+	//! Sets the parent of the non-maximal set \p set to its ancestor \p ancestor.
+	/**
+	 * A plain store suffices: \p set stays non-maximal and \p ancestor stays its ancestor, so
+	 * overwriting a concurrent compression merely loses progress.
+	 */
+	void compress(int set, int ancestor) {
+		m_parents[set].store(ancestor, std::memory_order_relaxed);
+	}
+
+public:
+	//! Creates an empty ConcurrentDisjointSets structure.
+	/**
+	 * \param maxNumberOfElements Expected number of Elements.
+	 */
+	explicit ConcurrentDisjointSets(int maxNumberOfElements = (1 << 15)) : m_parents(nullptr) {
+		init(maxNumberOfElements);
+	}
+
+	~ConcurrentDisjointSets() { delete[] m_parents; }
+
+	OGDF_COPY_CONSTR(ConcurrentDisjointSets)
+		: ConcurrentDisjointSets(copy.m_maxNumberOfElements) {
+		m_numberOfSets = copy.m_numberOfSets.load();
+		m_numberOfElements = copy.m_numberOfElements;
+		for (int i = 0; i < m_numberOfElements; ++i) {
+			m_parents[i].store(copy.m_parents[i].load(), std::memory_order_relaxed);
+		}
+	}
+
+	OGDF_SWAP_OP(ConcurrentDisjointSets) {
+		int numberOfSets = first.m_numberOfSets.load();
+		first.m_numberOfSets = second.m_numberOfSets.load();
+		second.m_numberOfSets = numberOfSets;
+		std::swap(first.m_numberOfElements, second.m_numberOfElements);
+		std::swap(first.m_maxNumberOfElements, second.m_maxNumberOfElements);
+		std::swap(first.m_parents, second.m_parents);
+	}
+
+	OGDF_COPY_MOVE_BY_SWAP(ConcurrentDisjointSets)
+
+	//! Resets the structure to be empty, also changing the expected number of elements.
+	void init(int maxNumberOfElements) {
+		m_maxNumberOfElements = maxNumberOfElements;
+		init();
+	}
+
+	//! Resets the structure to be empty, preserving the previous value of maxNumberOfElements.
+	void init() {
+		delete[] m_parents;
+		m_numberOfSets = 0;
+		m_numberOfElements = 0;
+		m_parents = new std::atomic<int>[m_maxNumberOfElements];
+	}
+
+	//! Returns the id of the largest superset of \p set and compresses the path.
+	/**
+	 * May be called concurrently. If other threads unify sets at the same time, the result is
+	 * a set id that was maximal at some point during the call.
+	 *
+	 * \param set Set.
+	 * \return Superset id
+	 * \pre \p set is a non negative properly initialized id.
+	 */
+	int find(int set) {
+		OGDF_ASSERT(set >= 0);
+		OGDF_ASSERT(set < m_numberOfElements);
+		return find(disjoint_sets::CompressionOption<compressionOption>(), set);
+	}
+
+	//! Returns the id of the largest superset of \p set.
+	/**
+	 * \param set Set.
+	 * \return Superset id
+	 * \pre \p set is a non negative properly initialized id.
+	 */
+	int getRepresentative(int set) const {
+		OGDF_ASSERT(set >= 0);
+		OGDF_ASSERT(set < m_numberOfElements);
+		for (int p = parent(set); p != set; p = parent(set)) {
+			set = p;
+		}
+		return set;
+	}
+
+	//! Returns whether \p set1 and \p set2 belong to the same maximal set.
+	/**
+	 * In contrast to comparing the results of two find() calls, the answer is exact even if
+	 * other threads unify sets at the same time.
+	 */
+	bool sameSet(int set1, int set2) {
+		for (;;) {
+			set1 = find(set1);
+			set2 = find(set2);
+			if (set1 == set2) {
+				return true;
+			}
+			if (parent(set1) == set1) {
+				return false;
+			}
+		}
+	}
+
+	//! Initializes a singleton set.
+	/**
+	 * Must not be called concurrently with any other method.
+	 *
+	 * \return Set id of the initialized singleton set.
+	 */
+	int makeSet() {
+		if (m_numberOfElements == m_maxNumberOfElements) {
+			std::atomic<int>* parents = m_parents;
+			m_maxNumberOfElements = max(1, 2 * m_maxNumberOfElements);
+			m_parents = new std::atomic<int>[m_maxNumberOfElements];
+			for (int i = 0; i < m_numberOfElements; ++i) {
+				m_parents[i].store(parents[i].load(std::memory_order_relaxed),
+						std::memory_order_relaxed);
+			}
+			delete[] parents;
+		}
+		m_numberOfSets++;
+		int id = m_numberOfElements++;
+		m_parents[id].store(id, std::memory_order_relaxed);
+		return id;
+	}
+
+	//! Unions \p set1 and \p set2.
+	/**
+	 * May be called concurrently as long as no other thread links \p set1 or \p set2 at the
+	 * same time; otherwise, use quickUnion(). Should another thread link one of them anyway,
+	 * nothing is changed and -1 is returned.
+	 *
+	 * \pre \p set1 and \p set2 are maximal disjoint sets.
+	 * \return Set id of the union.
+	 */
+	int link(int set1, int set2) {
+		OGDF_ASSERT(set1 == getRepresentative(set1));
+		OGDF_ASSERT(set2 == getRepresentative(set2));
+		if (set1 == set2) {
+			return -1;
+		}
+		if (set1 > set2) {
+			std::swap(set1, set2);
+		}
+		int expected = set1;
+		if (!m_parents[set1].compare_exchange_strong(expected, set2, std::memory_order_acq_rel)) {
+			return -1;
+		}
+		m_numberOfSets--;
+		return set2;
+	}
+
+	//! Unions the maximal disjoint sets containing \p set1 and \p set2.
+	/**
+	 * May be called concurrently; the operation is lock-free.
+	 *
+	 * \return True, if the maximal sets containing \p set1 and \p set2 were disjoint and have
+	 *         been joined. False otherwise.
+	 */
+	bool quickUnion(int set1, int set2) {
+#ifdef OGDF_DISJOINT_SETS_INTERMEDIATE_PARENT_CHECK
+		if (parent(set1) == parent(set2)) {
+			return false;
+		}
+#endif
+		for (;;) {
+			set1 = find(set1);
+			set2 = find(set2);
+			if (set1 == set2) {
+				return false;
+			}
+			if (set1 > set2) {
+				std::swap(set1, set2);
+			}
+			int expected = set1;
+			if (m_parents[set1].compare_exchange_strong(expected, set2,
+						std::memory_order_acq_rel)) {
+				m_numberOfSets--;
+				return true;
+			}
+		}
+	}
+
+	//! Returns the current number of disjoint sets.
+	int getNumberOfSets() { return m_numberOfSets; }
+
+	//! Returns the current number of elements.
+	int getNumberOfElements() { return m_numberOfElements; }
+};
+
+//find
+template<LinkOptions linkOption, CompressionOptions compressionOption, InterleavingOptions interleavingOption>
+int ConcurrentDisjointSets<linkOption, compressionOption, interleavingOption>::find(
+		disjoint_sets::CompressionOption<CompressionOptions::PathSplitting>, int set) {
+	int p = parent(set);
+	int grandParent = parent(p);
+	while (p != grandParent) {
+		compress(set, grandParent);
+		set = p;
+		p = grandParent;
+		grandParent = parent(grandParent);
+	}
+	return p;
+}
+
+template<LinkOptions linkOption, CompressionOptions compressionOption, InterleavingOptions interleavingOption>
+int ConcurrentDisjointSets<linkOption, compressionOption, interleavingOption>::find(
+		disjoint_sets::CompressionOption<CompressionOptions::PathHalving>, int set) {
+	for (int p = parent(set); p != set; p = parent(set)) {
+		int grandParent = parent(p);
+		if (grandParent != p) {
+			compress(set, grandParent);
+		}
+		set = grandParent;
+	}
+	return set;
+}
+
+template<LinkOptions linkOption, CompressionOptions compressionOption, InterleavingOptions interleavingOption>
+int ConcurrentDisjointSets<linkOption, compressionOption, interleavingOption>::find(
+		disjoint_sets::CompressionOption<CompressionOptions::Disabled>, int set) {
+	for (int p = parent(set); p != set; p = parent(set)) {
+		set = p;
+	}
+	return set;
+}
+
+}
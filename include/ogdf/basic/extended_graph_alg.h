@@ -41,8 +41,12 @@
 #include <ogdf/basic/comparer.h>
 #include <ogdf/basic/internal/config_autogen.h>
 #include <ogdf/basic/internal/graph_iterators.h>
+#include <ogdf/basic/internal/parallel_sort.h>
 #include <ogdf/planarity/BoyerMyrvold.h>
 
+#include <utility>
+#include <vector>
+
 namespace ogdf {
 class ClusterGraph;
 template<class E>
@@ -270,6 +274,73 @@ T makeMinimumSpanningTree(Graph& G, const EdgeArray<T>& weight) {
 	return total;
 }
 
+//! @cond
+
+namespace internal {
+
+//! Marks the edges of the minimum spanning forest of \p G in \p isInTree.
+/**
+ * \p order contains all edges of \p G, sorted by increasing weight with ties broken
+ * arbitrarily but consistently. Edges are inserted into \p isInTree, which has to be
+ * initialized with false, as Kruskal's algorithm would do when processing \p order.
+ */
+OGDF_EXPORT void markMinSpanningForest(const Graph& G, const Array<edge>& order,
+		EdgeArray<bool>& isInTree, unsigned int numberOfThreads);
+
+}
+
+//! @endcond
+
+//! Computes a minimum spanning forest with several threads.
+/**
+ * @ingroup ga-mst
+ *
+ * The edges are sorted by weight in parallel (ties are broken by the order of the edges
+ * in \p G, so the result does not depend on the number of threads). Then Borůvka's
+ * algorithm runs in rounds on a concurrent union-find structure (ConcurrentDisjointSets):
+ * in each round, the threads determine the lightest edge leaving each component, add
+ * these edges to the forest and unite their components, and drop the edges that no
+ * longer leave a component. With at most one thread, Kruskal's algorithm is used instead.
+ *
+ * In contrast to computeMinST(), \p G does not need to be connected.
+ *
+ * @tparam T        is the numeric type for edge weights.
+ * @param  G        is the input graph.
+ * @param  weight   is an edge array with the edge weights.
+ * @param  isInTree is assigned the result, i.e. \a isInTree[\a e] is true iff edge \a e is in the computed forest.
+ * @param  numberOfThreads is the maximal number of threads.
+ * @return the sum of the edge weights in the computed forest.
+ **/
+template<typename T>
+T parallelComputeMinST(const Graph& G, const EdgeArray<T>& weight, EdgeArray<bool>& isInTree,
+		unsigned int numberOfThreads) {
+	const int m = G.numberOfEdges();
+	Array<edge> order(m);
+	std::vector<std::pair<T, int>> sorted(m);
+	int i = 0;
+	for (edge e : G.edges) {
+		order[i] = e;
+		sorted[i] = {weight[e], i};
+		++i;
+	}
+	internal::parallelSort(sorted.begin(), sorted.end(), numberOfThreads);
+
+	Array<edge> sortedOrder(m);
+	for (i = 0; i < m; ++i) {
+		sortedOrder[i] = order[sorted[i].second];
+	}
+	isInTree.init(G, false);
+	internal::markMinSpanningForest(G, sortedOrder, isInTree, numberOfThreads);
+
+	T total(0);
+	for (edge e : sortedOrder) {
+		if (isInTree[e]) {
+			total += weight[e];
+		}
+	}
+	return total;
+}
+
 //! @}
 
 //! Returns true, if G is planar, false otherwise.
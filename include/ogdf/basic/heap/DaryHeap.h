@@ -0,0 +1,224 @@
+/** \file
+ * \brief Implementation of an array-based 4-ary heap that allows the
+ * decrease operation.
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.md in the OGDF root directory for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, see
+ * http://www.gnu.org/copyleft/gpl.html
+ */
+
+#pragma once
+
+#include <ogdf/basic/basic.h>
+#include <ogdf/basic/heap/HeapBase.h>
+
+#include <deque>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace ogdf {
+
+/**
+ * \brief Heap realized by a data array in which every node has four children.
+ * This heap implementation does not support merge operations.
+ *
+ * Compared to BinaryHeap, the tree is only half as deep, which makes
+ * decrease() cheaper and the sift operations more cache friendly. Values are
+ * stored in one contiguous array, and handles are taken from a pool that is
+ * recycled, so push() does not allocate memory once the heap has reached its
+ * maximal size.
+ *
+ * The arity is a constant of the class (and not a template parameter) so the
+ * heap can be passed wherever a heap with signature <tt>H<T, C></tt> is
+ * expected, e.g., to Dijkstra or PrioritizedMapQueue.
+ *
+ * @tparam T Denotes value type of inserted elements.
+ * @tparam C Denotes comparison functor determining value ordering.
+ */
+template<typename T, typename C = std::less<T>>
+class DaryHeap : public HeapBase<DaryHeap<T, C>, int, T, C> {
+	using base_type = HeapBase<DaryHeap<T, C>, int, T, C>;
+
+public:
+	//! The number of children of each node.
+	static constexpr int arity = 4;
+
+	/**
+	 * Initializes an empty heap.
+	 *
+	 * @param comp Comparison functor determining value ordering.
+	 * @param initialSize The intial capacity of this heap.
+	 */
+	explicit DaryHeap(const C& comp = C(), int initialSize = 128) : base_type(comp) {
+		m_heap.reserve(initialSize);
+	}
+
+	virtual ~DaryHeap() = default;
+
+	/**
+	 * Returns the topmost value in the heap.
+	 *
+	 * @return the topmost value
+	 */
+	const T& top() const override {
+		OGDF_ASSERT(!empty());
+		return m_heap.front().value;
+	}
+
+	/**
+	 * Inserts a value into the heap.
+	 *
+	 * @param value The value to be inserted
+	 * @return A handle to access and modify the value; it is valid until the value is popped
+	 */
+	int* push(const T& value) override {
+		int* handle;
+		if (m_freeHandles.empty()) {
+			m_handles.emplace_back();
+			handle = &m_handles.back();
+		} else {
+			handle = m_freeHandles.back();
+			m_freeHandles.pop_back();
+		}
+
+		m_heap.push_back({value, handle});
+		siftUp(size() - 1);
+		return handle;
+	}
+
+	/**
+	 * Removes the topmost value from the heap.
+	 */
+	void pop() override {
+		OGDF_ASSERT(!empty());
+		m_freeHandles.push_back(m_heap.front().handle);
+
+		if (size() > 1) {
+			m_heap.front() = std::move(m_heap.back());
+			m_heap.pop_back();
+			siftDown(0);
+		} else {
+			m_heap.pop_back();
+		}
+	}
+
+	/**
+	 * Decreases a single value.
+	 *
+	 * @param handle The handle of the value to be decreased
+	 * @param value The decreased value. This must be less than the former value
+	 */
+	void decrease(int* handle, const T& value) override {
+		Entry& entry = m_heap[*handle];
+		OGDF_ASSERT(!this->comparator()(entry.value, value));
+
+		entry.value = value;
+		siftUp(*handle);
+	}
+
+	/**
+	 * Returns the value of that handle.
+	 *
+	 * @param handle The handle
+	 * @return The value
+	 */
+	const T& value(int* handle) const override {
+		OGDF_ASSERT(handle != nullptr);
+		OGDF_ASSERT(*handle >= 0);
+		OGDF_ASSERT(*handle < size());
+
+		return m_heap[*handle].value;
+	}
+
+	//! Returns the number of stored elements.
+	int size() const { return static_cast<int>(m_heap.size()); }
+
+	//! Returns true iff the heap is empty.
+	bool empty() const { return m_heap.empty(); }
+
+	//! Removes all elements; all handles become invalid.
+	void clear() {
+		m_heap.clear();
+		m_handles.clear();
+		m_freeHandles.clear();
+	}
+
+private:
+	struct Entry {
+		T value;
+		int* handle;
+	};
+
+	std::vector<Entry> m_heap; //!< The heap; the children of i are arity*i+1, ..., arity*i+arity.
+	std::deque<int> m_handles; //!< All handles ever allocated (a deque keeps them in place).
+	std::vector<int*> m_freeHandles; //!< Handles that can be reused.
+
+	//! Establishes heap property by moving element up in heap if necessary.
+	void siftUp(int pos) {
+		const C& compare = this->comparator();
+		Entry entry = std::move(m_heap[pos]);
+
+		while (pos > 0) {
+			int parent = (pos - 1) / arity;
+			if (!compare(entry.value, m_heap[parent].value)) {
+				break;
+			}
+			m_heap[pos] = std::move(m_heap[parent]);
+			*m_heap[pos].handle = pos;
+			pos = parent;
+		}
+
+		m_heap[pos] = std::move(entry);
+		*m_heap[pos].handle = pos;
+	}
+
+	//! Establishes heap property by moving element down in heap if necessary.
+	void siftDown(int pos) {
+		const C& compare = this->comparator();
+		const int n = size();
+		Entry entry = std::move(m_heap[pos]);
+
+		for (int first; (first = arity * pos + 1) < n;) {
+			int last = std::min(first + arity, n);
+			int best = first;
+			for (int child = first + 1; child < last; ++child) {
+				if (compare(m_heap[child].value, m_heap[best].value)) {
+					best = child;
+				}
+			}
+			if (!compare(m_heap[best].value, entry.value)) {
+				break;
+			}
+			m_heap[pos] = std::move(m_heap[best]);
+			*m_heap[pos].handle = pos;
+			pos = best;
+		}
+
+		m_heap[pos] = std::move(entry);
+		*m_heap[pos].handle = pos;
+	}
+};
+
+}
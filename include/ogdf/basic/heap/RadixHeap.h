@@ -81,6 +81,14 @@ public:
 	 */
 	RadixHeapNode<V, P>* push(const V& value, const P& priority);
 
+	//! Returns the value of the top element.
+	/**
+	 * Behaviour of this function is undefined if the heap is empty.
+	 *
+	 * @return Value of the top node.
+	 */
+	const V& top() const;
+
 	//! Removes the top element from the heap and returns its value.
 	/**
 	 * Behaviour of this function is undefined if the heap is empty.
@@ -162,6 +170,23 @@ RadixHeapNode<V, P>* RadixHeap<V, P>::push(const V& value, const P& priority) {
 	return heapNode;
 }
 
+template<typename V, typename P>
+const V& RadixHeap<V, P>::top() const {
+	if (m_buckets[0] != nullptr) {
+		return m_buckets[0]->value;
+	}
+
+	std::size_t ind = BITS + 1 - msbSet(m_bucketMask);
+
+	Bucket min = m_buckets[ind];
+	for (Bucket it = min->next; it != nullptr; it = it->next) {
+		if (it->priority < min->priority) {
+			min = it;
+		}
+	}
+	return min->value;
+}
+
 template<typename V, typename P>
 V RadixHeap<V, P>::pop() {
 	m_size--;
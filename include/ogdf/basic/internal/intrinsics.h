@@ -1,5 +1,5 @@
 /** \file
- * \brief Include of header files for SSE-intrinsics
+ * \brief Include of header files for SSE-intrinsics and portable bit scans
  *
  * \author Carsten Gutwenger
  *
@@ -36,6 +36,40 @@
 #include <ogdf/basic/basic.h> // IWYU pragma: keep
 #include <ogdf/basic/internal/config_autogen.h>
 
+#include <cstdint>
+
 #ifdef OGDF_SSE3_EXTENSIONS
 #	include OGDF_SSE3_EXTENSIONS // IWYU pragma: export
 #endif
+
+namespace ogdf {
+
+//! Returns the index of the lowest set bit of \p x != 0.
+inline int lowestSetBit(uint64_t x) {
+	OGDF_ASSERT(x != 0);
+#if defined(__GNUC__) || defined(__clang__)
+	return __builtin_ctzll(x);
+#else
+	int i = 0;
+	for (; (x & 1) == 0; x >>= 1) {
+		++i;
+	}
+	return i;
+#endif
+}
+
+//! Returns the index of the highest set bit of \p x != 0.
+inline int highestSetBit(uint64_t x) {
+	OGDF_ASSERT(x != 0);
+#if defined(__GNUC__) || defined(__clang__)
+	return 63 - __builtin_clzll(x);
+#else
+	int i = 0;
+	while (x >>= 1) {
+		++i;
+	}
+	return i;
+#endif
+}
+
+}
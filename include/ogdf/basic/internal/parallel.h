@@ -0,0 +1,120 @@
+/** \file
+ * \brief Helpers for running work on several threads.
+ *
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.md in the OGDF root directory for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, see
+ * http://www.gnu.org/copyleft/gpl.html
+ */
+
+#pragma once
+
+#include <ogdf/basic/Array.h>
+#include <ogdf/basic/Thread.h>
+#include <ogdf/basic/basic.h>
+
+#include <atomic>
+#include <functional>
+#include <vector>
+
+namespace ogdf {
+namespace internal {
+
+//! Returns the number of hardware threads, or 1 if OGDF is built without thread safety.
+inline unsigned int defaultMaxThreads() {
+#ifdef OGDF_MEMORY_POOL_NTS
+	return 1;
+#else
+	return max(1u, Thread::hardware_concurrency());
+#endif
+}
+
+//! The maximal number of threads used by an algorithm.
+/**
+ * Defaults to defaultMaxThreads(). If OGDF is built without thread safety
+ * (OGDF_MEMORY_POOL_NTS), a single thread is used and the setter has no effect.
+ */
+class MaxThreadsOption {
+public:
+	//! Returns the maximal number of used threads.
+	unsigned int maxThreads() const { return m_maxThreads; }
+
+	//! Sets the maximal number of used threads to \p n.
+	void maxThreads(unsigned int n) {
+#ifndef OGDF_MEMORY_POOL_NTS
+		m_maxThreads = max(1u, n);
+#endif
+	}
+
+protected:
+	unsigned int m_maxThreads = defaultMaxThreads(); //!< The maximal number of used threads
+};
+
+//! Runs \p worker(id) for id = 0, ..., \p nThreads - 1 in parallel, id 0 on the calling thread.
+inline void runThreads(unsigned int nThreads, const std::function<void(unsigned int)>& worker) {
+	if (nThreads <= 1) {
+		worker(0);
+		return;
+	}
+
+	// Thread only keeps a reference to its function, so the jobs must outlive the threads
+	std::vector<std::function<void()>> job;
+	job.reserve(nThreads - 1);
+	for (unsigned int id = 1; id < nThreads; ++id) {
+		job.emplace_back([&worker, id] { worker(id); });
+	}
+	Array<Thread> thread(nThreads - 1);
+	for (unsigned int id = 1; id < nThreads; ++id) {
+		thread[id - 1] = Thread(job[id - 1]);
+	}
+	worker(0);
+	for (Thread& t : thread) {
+		t.join();
+	}
+}
+
+//! Returns the number of threads parallelFor() uses for \p n items in chunks of \p chunkSize.
+inline unsigned int parallelForThreads(unsigned int maxThreads, int n, int chunkSize) {
+	return static_cast<unsigned int>(
+			max(1, min(static_cast<int>(maxThreads), (n + chunkSize - 1) / chunkSize)));
+}
+
+//! Calls \p fun(begin, end, id) for consecutive chunks [begin, end) of [0, \p n).
+/**
+ * The chunks have size \p chunkSize (except for the last one) and are handed out one by one to
+ * parallelForThreads() threads with ids 0, 1, ... Thus the chunk boundaries do not depend on
+ * the number of threads.
+ */
+template<typename Fun>
+void parallelFor(unsigned int maxThreads, int n, int chunkSize, const Fun& fun) {
+	std::atomic<int> next(0);
+	runThreads(parallelForThreads(maxThreads, n, chunkSize), [&](unsigned int id) {
+		for (int begin = next.fetch_add(chunkSize); begin < n; begin = next.fetch_add(chunkSize)) {
+			fun(begin, min(begin + chunkSize, n), id);
+		}
+	});
+}
+
+}
+}
@@ -0,0 +1,90 @@
+/** \file
+ * \brief Sorting a range with several threads.
+ *
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.md in the OGDF root directory for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, see
+ * http://www.gnu.org/copyleft/gpl.html
+ */
+
+#pragma once
+
+#include <ogdf/basic/basic.h>
+#include <ogdf/basic/internal/parallel.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <vector>
+
+namespace ogdf {
+namespace internal {
+
+//! Sorts [\p first, \p last) with respect to \p comp using up to \p numberOfThreads threads.
+/**
+ * The range is split into one run per thread, the runs are sorted in parallel and then
+ * merged pairwise in parallel rounds. Small ranges are sorted by a single thread.
+ * The sort is not stable.
+ */
+template<typename RandomIt, typename Compare>
+void parallelSort(RandomIt first, RandomIt last, unsigned int numberOfThreads, Compare comp) {
+#ifdef OGDF_MEMORY_POOL_NTS
+	numberOfThreads = 1;
+#endif
+	const int64_t n = std::distance(first, last);
+	// sorting fewer elements per thread does not pay off the thread start
+	const unsigned int threads = static_cast<unsigned int>(
+			min<int64_t>(max(1u, numberOfThreads), max<int64_t>(1, n >> 14)));
+	if (threads == 1) {
+		std::sort(first, last, comp);
+		return;
+	}
+
+	std::vector<RandomIt> bound(threads + 1);
+	for (unsigned int i = 0; i <= threads; ++i) {
+		bound[i] = first + n * i / threads;
+	}
+
+	runThreads(threads, [&](unsigned int i) { std::sort(bound[i], bound[i + 1], comp); });
+
+	for (unsigned int width = 1; width < threads; width *= 2) {
+		// merge the runs i and i + width for i = 0, 2 * width, 4 * width, ...
+		runThreads((threads + width - 1) / (2 * width), [&](unsigned int j) {
+			const unsigned int i = 2 * width * j;
+			std::inplace_merge(bound[i], bound[i + width], bound[min(i + 2 * width, threads)],
+					comp);
+		});
+	}
+}
+
+//! Sorts [\p first, \p last) in ascending order using up to \p numberOfThreads threads.
+template<typename RandomIt>
+void parallelSort(RandomIt first, RandomIt last, unsigned int numberOfThreads) {
+	parallelSort(first, last, numberOfThreads,
+			std::less<typename std::iterator_traits<RandomIt>::value_type>());
+}
+
+}
+}
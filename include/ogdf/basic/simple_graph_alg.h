@@ -499,6 +499,28 @@ inline int connectedComponents(const Graph& G) {
 	return connectedComponents(G, component);
 }
 
+//! Computes the connected components of \p G with several threads.
+/**
+ * @ingroup ga-connectivity
+ *
+ * The edges are distributed among the threads, which merge the components of
+ * their end nodes in a concurrent union-find structure: as in the algorithm
+ * of Shiloach and Vishkin, a root is always hooked to a root with a smaller
+ * index (by compare-and-swap), and paths are shortened by pointer jumping.
+ * The components are numbered exactly as by connectedComponents().
+ *
+ * @param G               is the input graph.
+ * @param component       is assigned a mapping from nodes to component numbers.
+ * @param numberOfThreads is the maximal number of threads; with at most one
+ *                        thread, connectedComponents() is called.
+ * @param isolated        if non-null, will contain the list of isolated nodes afterwards.
+ * @param reprs           if non-null, will contain a node from component c at index c afterwards.
+ * @return the number of connected components.
+ */
+OGDF_EXPORT int parallelConnectedComponents(const Graph& G, NodeArray<int>& component,
+		unsigned int numberOfThreads, List<node>* isolated = nullptr,
+		ArrayBuffer<node>* reprs = nullptr);
+
 
 OGDF_DEPRECATED("connectedComponents() should be used instead.")
 
@@ -605,6 +627,44 @@ inline int biconnectedComponents(const Graph& G, EdgeArray<int>& component) {
 	return biconnectedComponents(G, component, doNotNeedTheValue);
 }
 
+/**
+ * @ingroup ga-connectivity
+ * @copydoc ogdf::parallelBiconnectedComponents(const Graph&, EdgeArray<int>&, unsigned int)
+ * @param nonEmptyComponents is the number of non-empty components.
+ * The indices of \p component range from 0 to \p nonEmptyComponents - 1.
+ */
+OGDF_EXPORT int parallelBiconnectedComponents(const Graph& G, EdgeArray<int>& component,
+		int& nonEmptyComponents, unsigned int numberOfThreads);
+
+//! Computes the biconnected components of \p G with several threads.
+/**
+ * @ingroup ga-connectivity
+ *
+ * Implements the algorithm by Tarjan and Vishkin: after computing a rooted
+ * spanning forest (by breadth-first search) with preorder numbers, subtree
+ * sizes and the low and high values of all subtrees, the tree edges are
+ * merged in a concurrent union-find structure according to the non-tree edges
+ * and the tree edges leaving a subtree. Each non-tree edge joins the block of
+ * the tree edge above its lower end node. The passes over the edges are
+ * distributed among the threads; the passes over the spanning forest are
+ * sequential.
+ *
+ * The output is the same as of biconnectedComponents(), but the blocks may be
+ * numbered differently.
+ *
+ * @param G               is the input graph.
+ * @param component       is assigned a mapping from edges to component numbers.
+ * @param numberOfThreads is the maximal number of threads; with at most one
+ *                        thread, biconnectedComponents() is called.
+ * @return the number of biconnected components (including self-loops) + the
+ * number of nodes without neighbours.
+ */
+inline int parallelBiconnectedComponents(const Graph& G, EdgeArray<int>& component,
+		unsigned int numberOfThreads) {
+	int doNotNeedTheValue;
+	return parallelBiconnectedComponents(G, component, doNotNeedTheValue, numberOfThreads);
+}
+
 /**
  * @copydoc ogdf::isTwoEdgeConnected(const Graph&)
  * @param bridge If false is returned and \p graph is connected, \p bridge is assigned a bridge in \p graph,
@@ -874,6 +934,31 @@ OGDF_EXPORT void topologicalNumbering(const Graph& G, NodeArray<int>& num);
  */
 OGDF_EXPORT int strongComponents(const Graph& G, NodeArray<int>& component);
 
+//! Computes the strongly connected components of the digraph \p G with several threads.
+/**
+ * @ingroup ga-connectivity
+ *
+ * Implements the forward-backward algorithm with trimming:
+ *  -# Nodes without incoming or outgoing edges are removed repeatedly (in
+ *     parallel rounds); each of them is a component on its own.
+ *  -# The nodes reachable from and reaching a pivot of maximal degree form its
+ *     component. Both searches are level-synchronous and parallel.
+ *  -# The remaining nodes fall into three independent subproblems, which are
+ *     solved the same way (with random pivots) by a pool of threads. Small
+ *     subproblems are solved with Tarjan's algorithm.
+ *
+ * The output is the same as of strongComponents(), but the components may be
+ * numbered differently.
+ *
+ * @param G               is the input graph.
+ * @param component       is assigned a mapping from nodes to component numbers (0, 1, ...).
+ * @param numberOfThreads is the maximal number of threads; with at most one
+ *                        thread, strongComponents() is called.
+ * @return the number of strongly connected components.
+ */
+OGDF_EXPORT int parallelStrongComponents(const Graph& G, NodeArray<int>& component,
+		unsigned int numberOfThreads);
+
 
 //! Makes the digraph \p G bimodal.
 /**
@@ -0,0 +1,58 @@
+/** \file
+ * \brief Declaration of ogdf::buildSPQRTrees() which builds the SPQR-trees
+ *        of independent blocks in parallel.
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.md in the OGDF root directory for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, see
+ * http://www.gnu.org/copyleft/gpl.html
+ */
+
+#pragma once
+
+#include <ogdf/basic/Graph.h>
+#include <ogdf/basic/GraphList.h>
+#include <ogdf/basic/basic.h>
+#include <ogdf/decomposition/StaticSPQRTree.h>
+
+namespace ogdf {
+
+/**
+ * Builds a StaticSPQRTree for each graph in \p blockGraphs, e.g. for the blocks of a BCTree.
+ *
+ * @ingroup decomp
+ *
+ * The block graphs are independent of each other, hence their SPQR-trees are built by up to
+ * \p maxThreads threads. Larger blocks are handed out first to balance the work.
+ *
+ * @param blockGraphs assigns a biconnected graph (or \c nullptr) to each node of some tree,
+ *        typically the B-nodes of a BC-tree.
+ * @param spqrTrees is assigned the SPQR-tree of each block graph that has at least two nodes
+ *        and more than two edges, and \c nullptr for all others. The caller has to delete
+ *        the created trees.
+ * @param maxThreads is the maximal number of used threads.
+ */
+OGDF_EXPORT void buildSPQRTrees(const NodeArrayP<Graph>& blockGraphs,
+		NodeArray<StaticSPQRTree*>& spqrTrees, unsigned int maxThreads);
+
+}
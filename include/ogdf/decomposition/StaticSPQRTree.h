@@ -31,6 +31,7 @@
 
 #pragma once
 
+#include <ogdf/basic/ArrayBuffer.h>
 #include <ogdf/basic/Graph.h>
 #include <ogdf/basic/GraphList.h>
 #include <ogdf/basic/List.h>
@@ -204,7 +205,7 @@ protected:
 	//! Initialization (called by constructor).
 	void init(edge eRef, Triconnectivity& tricComp);
 
-	//! Recursively performs rooting of tree.
+	//! Performs rooting of the subtree of \p v, which is reached via \p ef.
 	void rootRec(node v, edge ef);
 
 	/**
@@ -212,19 +213,26 @@ protected:
 	 * to the pertinent graph \p Gp for each involved skeleton graph.
 	 */
 	void cpRec(node v, PertinentGraph& Gp) const override {
-		const Skeleton& S = skeleton(v);
-
-		for (edge e : S.getGraph().edges) {
-			edge eOrig = S.realEdge(e);
-			if (eOrig != nullptr) {
-				cpAddEdge(eOrig, Gp);
+		ArrayBuffer<node> stack;
+		stack.push(v);
+
+		while (!stack.empty()) {
+			v = stack.popRet();
+			const Skeleton& S = skeleton(v);
+
+			for (edge e : S.getGraph().edges) {
+				edge eOrig = S.realEdge(e);
+				if (eOrig != nullptr) {
+					cpAddEdge(eOrig, Gp);
+				}
 			}
-		}
 
-		for (adjEntry adj : v->adjEntries) {
-			node w = adj->theEdge()->target();
-			if (w != v) {
-				cpRec(w, Gp);
+			// push the children in reverse order to visit them in the original order
+			for (adjEntry adj = v->lastAdj(); adj != nullptr; adj = adj->pred()) {
+				node w = adj->theEdge()->target();
+				if (w != v) {
+					stack.push(w);
+				}
 			}
 		}
 	}
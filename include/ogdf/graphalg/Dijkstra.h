@@ -37,10 +37,16 @@
 #include <ogdf/basic/List.h>
 #include <ogdf/basic/PriorityQueue.h>
 #include <ogdf/basic/basic.h>
+#include <ogdf/basic/heap/DaryHeap.h>
 #include <ogdf/basic/heap/PairingHeap.h>
+#include <ogdf/basic/heap/RadixHeap.h>
 
+#include <algorithm>
 #include <functional>
 #include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace ogdf {
 
@@ -55,12 +61,169 @@ namespace ogdf {
  * to all others.
  * It optionally supports early termination if only the shortest path to a specific node
  * is required, or the maximum path length is to be limited.
+ *
+ * If \p H is DaryHeap, a specialized implementation is used that keeps all
+ * node data in flat arrays indexed by node index (reused between calls of the
+ * same instance) instead of NodeArrays and a PrioritizedMapQueue. For integral
+ * \p T, it uses a RadixHeap (with lazy deletion), otherwise a DaryHeap.
  */
 template<typename T, template<typename P, class C> class H = PairingHeap>
 class Dijkstra {
 protected:
 	EpsilonTest m_eps; //!< For floating point comparisons (if floating point is used)
 
+	//! Whether the implementation on flat arrays is used.
+	static constexpr bool c_flat =
+			std::is_same<H<T, std::less<T>>, DaryHeap<T, std::less<T>>>::value;
+
+	//! @name Workspace of the implementation on flat arrays
+	//! @{
+	std::vector<T> m_distance;
+	std::vector<edge> m_predecessor;
+	std::vector<char> m_settled;
+	std::vector<int*> m_handle;
+	//! @}
+
+	//! Heap entry of the implementation on flat arrays.
+	struct FlatEntry {
+		T distance;
+		unsigned int stamp; //!< Number of the improvement that created the entry.
+		node v;
+	};
+
+	//! Compares two heap entries; among equal distances, the latest improvement comes first.
+	struct FlatEntryLess {
+		bool operator()(const FlatEntry& a, const FlatEntry& b) const {
+			return a.distance < b.distance || (a.distance == b.distance && a.stamp > b.stamp);
+		}
+	};
+
+	//! Implementation of callUnbound() and callBound() on flat arrays.
+	void callFlat(const Graph& G, const EdgeArray<T>& weight, const List<node>& sources,
+			NodeArray<edge>& predecessor, NodeArray<T>& distance, bool directed, bool arcsReversed,
+			node target, T maxLength) {
+		const int n = G.maxNodeIndex() + 1;
+		m_distance.assign(n, std::numeric_limits<T>::max());
+		m_predecessor.assign(n, nullptr);
+		m_settled.assign(n, false);
+
+#ifdef OGDF_DEBUG
+		for (edge de : G.edges) {
+			OGDF_ASSERT(weight[de] >= 0);
+		}
+#endif
+
+		// Scans the edges of v and returns true iff v is the target.
+		// improve(w, d) is called whenever the distance of w drops to d.
+		auto scan = [&](node v, auto improve) {
+			if (v == target) {
+				return true;
+			}
+			const T dv = m_distance[v->index()];
+			for (adjEntry adj : v->adjEntries) {
+				edge e = adj->theEdge();
+				node w = adj->twinNode();
+				if (directed
+						&& ((!arcsReversed && e->target() == v)
+								|| (arcsReversed && e->target() != v))) {
+					continue;
+				}
+
+				const T newDistance = dv + weight[e];
+				if (m_eps.greater(newDistance, maxLength)) {
+					continue;
+				}
+				const int wi = w->index();
+				if (!m_settled[wi] && m_eps.greater(m_distance[wi], newDistance)) {
+					OGDF_ASSERT(std::numeric_limits<T>::max() - weight[e] >= dv);
+					m_distance[wi] = newDistance;
+					m_predecessor[wi] = e;
+					improve(w, newDistance);
+				}
+			}
+			return false;
+		};
+
+		if constexpr (std::is_integral<T>::value) {
+			// radix heaps are monotone, so outdated entries are skipped instead of decreased.
+			// To settle nodes in the same order as the DaryHeap below, all nodes of the next
+			// distance are collected in level, ordered by their stamps.
+			using Key = typename std::make_unsigned<T>::type;
+			RadixHeap<FlatEntry, Key> queue;
+			std::vector<FlatEntry> level;
+			T current = 0;
+			unsigned int stamp = 0;
+			for (node s : sources) {
+				m_distance[s->index()] = 0;
+				queue.push({0, stamp++, s}, 0);
+			}
+			auto improve = [&](node w, T d) {
+				if (d == current) {
+					// reached via a zero-weight edge, this is the latest improvement of the level
+					level.push_back({d, stamp++, w});
+				} else {
+					queue.push({d, stamp++, w}, static_cast<Key>(d));
+				}
+			};
+			for (;;) {
+				while (level.empty() && !queue.empty()) {
+					current = queue.top().distance;
+					while (!queue.empty() && queue.top().distance == current) {
+						FlatEntry entry = queue.pop();
+						const int vi = entry.v->index();
+						if (!m_settled[vi] && m_distance[vi] == current) {
+							level.push_back(entry);
+						}
+					}
+					std::sort(level.begin(), level.end(), [](const FlatEntry& a, const FlatEntry& b) {
+						return a.stamp < b.stamp;
+					});
+				}
+				if (level.empty()) {
+					break;
+				}
+				node v = level.back().v;
+				level.pop_back();
+				m_settled[v->index()] = true;
+				if (scan(v, improve)) {
+					break;
+				}
+			}
+		} else {
+			DaryHeap<FlatEntry, FlatEntryLess> queue;
+			m_handle.assign(n, nullptr);
+			unsigned int stamp = 0;
+			for (node s : sources) {
+				m_distance[s->index()] = 0;
+				m_handle[s->index()] = queue.push({0, stamp++, s});
+			}
+			auto improve = [&](node w, T d) {
+				int*& handle = m_handle[w->index()];
+				if (handle == nullptr) {
+					handle = queue.push({d, stamp++, w});
+				} else {
+					queue.decrease(handle, {d, stamp++, w});
+				}
+			};
+			while (!queue.empty()) {
+				node v = queue.top().v;
+				queue.pop();
+				m_handle[v->index()] = nullptr;
+				m_settled[v->index()] = true;
+				if (scan(v, improve)) {
+					break;
+				}
+			}
+		}
+
+		distance.init(G);
+		predecessor.init(G);
+		for (node v : G.nodes) {
+			distance[v] = m_distance[v->index()];
+			predecessor[v] = m_predecessor[v->index()];
+		}
+	}
+
 public:
 	//! Calculates, based on the graph G with corresponding edge costs and source nodes,
 	//! the shortest paths and distances to all other nodes by Dijkstra's algorithm.
@@ -77,6 +240,12 @@ public:
 	void callUnbound(const Graph& G, const EdgeArray<T>& weight, const List<node>& sources,
 			NodeArray<edge>& predecessor, NodeArray<T>& distance, bool directed = false,
 			bool arcsReversed = false) {
+		if (c_flat) {
+			callFlat(G, weight, sources, predecessor, distance, directed, arcsReversed, nullptr,
+					std::numeric_limits<T>::max());
+			return;
+		}
+
 		PrioritizedMapQueue<node, T, std::less<T>, H> queue(G);
 		distance.init(G, std::numeric_limits<T>::max());
 		predecessor.init(G, nullptr);
@@ -145,6 +314,12 @@ public:
 	void callBound(const Graph& G, const EdgeArray<T>& weight, const List<node>& sources,
 			NodeArray<edge>& predecessor, NodeArray<T>& distance, bool directed, bool arcsReversed,
 			node target, T maxLength = std::numeric_limits<T>::max()) {
+		if (c_flat) {
+			callFlat(G, weight, sources, predecessor, distance, directed, arcsReversed, target,
+					maxLength);
+			return;
+		}
+
 		PrioritizedMapQueue<node, T, std::less<T>, H> queue(G);
 		distance.init(G, std::numeric_limits<T>::max());
 		predecessor.init(G, nullptr);
@@ -0,0 +1,428 @@
+/** \file
+ * \brief Implementation of the approximate distance oracle of Thorup and Zwick.
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.md in the OGDF root directory for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, see
+ * http://www.gnu.org/copyleft/gpl.html
+ */
+
+#pragma once
+
+#include <ogdf/basic/Array.h>
+#include <ogdf/basic/Graph.h>
+#include <ogdf/basic/GraphList.h>
+#include <ogdf/basic/basic.h>
+#include <ogdf/basic/internal/parallel.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace ogdf {
+
+/**
+ * Approximate distance oracle of Thorup and Zwick.
+ *
+ * M. Thorup and U. Zwick. Approximate distance oracles. Journal of the ACM 52.1 (2005),
+ * S. 1-24. doi: https://doi.org/10.1145/1044731.1044732.
+ *
+ * For an undirected graph with non-negative edge weights and a parameter \f$k \geq 1\f$, the
+ * oracle stores \f$\mathcal{O}(kn^{1+1/k})\f$ distances in expectation and answers distance
+ * queries in time \f$\mathcal{O}(k)\f$ with a stretch of at most \f$2k-1\f$. Edge directions
+ * are ignored.
+ *
+ * The nodes are sampled into levels \f$V = A_0 \supseteq A_1 \supseteq \dots \supseteq
+ * A_{k-1}\f$. The bunch of a node \f$v\f$ contains each node \f$w \in A_i \setminus
+ * A_{i+1}\f$ that is closer to \f$v\f$ than all nodes of \f$A_{i+1}\f$. The bunches are stored
+ * as hash tables on flat arrays. The shortest path computations of the levels and of the
+ * clusters, i.e., the inverse bunches, run on up to maxThreads() threads. The construction
+ * takes expected time \f$\mathcal{O}(kmn^{1/k} \log n)\f$.
+ *
+ * @ingroup ga-sp
+ *
+ * @tparam TWeight The type of the edge weights.
+ */
+template<typename TWeight>
+class DistanceOracleThorupZwick : public internal::MaxThreadsOption {
+public:
+	//! Creates an empty oracle; call init() to build it for a graph.
+	DistanceOracleThorupZwick() = default;
+
+	/**
+	 * Builds the oracle.
+	 *
+	 * @param G The graph.
+	 * @param weight The non-negative weight of each edge of \p G.
+	 * @param k The trade-off parameter; distance() returns at most 2\p k-1 times the distance.
+	 */
+	void init(const Graph& G, const EdgeArray<TWeight>& weight, int k) {
+		OGDF_ASSERT(k >= 1);
+		m_graph = &G;
+		m_k = k;
+		m_n = G.numberOfNodes();
+		const int n = m_n;
+		m_index.init(G);
+		int i = 0;
+		for (node v : G.nodes) {
+			m_index[v] = i++;
+		}
+
+		// the graph as adjacency arrays without self-loops
+		m_offset.assign(n + 1, 0);
+		for (node v : G.nodes) {
+			int degree = 0;
+			for (adjEntry adj : v->adjEntries) {
+				if (adj->twinNode() != v) {
+					++degree;
+				}
+			}
+			m_offset[m_index[v] + 1] = m_offset[m_index[v]] + degree;
+		}
+		m_target.resize(m_offset[n]);
+		m_weight.resize(m_offset[n]);
+		for (node v : G.nodes) {
+			int pos = m_offset[m_index[v]];
+			for (adjEntry adj : v->adjEntries) {
+				if (adj->twinNode() != v) {
+					OGDF_ASSERT(weight[adj->theEdge()] >= 0);
+					m_target[pos] = m_index[adj->twinNode()];
+					m_weight[pos++] = weight[adj->theEdge()];
+				}
+			}
+		}
+
+		sampleLevels();
+		computePivots();
+		computeBunches();
+
+		// the adjacency arrays are only needed for the construction
+		m_offset = std::vector<int>();
+		m_target = std::vector<int>();
+		m_weight = std::vector<TWeight>();
+		m_workspaces.init();
+	}
+
+	/**
+	 * Returns an estimate of the distance between \p u and \p v in time \f$\mathcal{O}(k)\f$.
+	 *
+	 * The estimate is at least the distance and at most 2k-1 times the distance. It is
+	 * infinity, i.e., \c std::numeric_limits<TWeight>::max(), if \p u and \p v are not connected.
+	 */
+	TWeight distance(node u, node v) const {
+		OGDF_ASSERT(u->graphOf() == m_graph);
+		OGDF_ASSERT(v->graphOf() == m_graph);
+		int a = m_index[u];
+		int b = m_index[v];
+		int w = a;
+		TWeight toA = 0;
+		for (int i = 0;;) {
+			TWeight toB;
+			if (w >= 0 && lookup(b, w, toB)) {
+				return toA + toB;
+			}
+			if (++i == m_k) {
+				return infinity();
+			}
+			std::swap(a, b);
+			w = m_pivot[i * m_n + a];
+			toA = m_pivotDistance[i * m_n + a];
+		}
+	}
+
+	//! Returns the trade-off parameter k.
+	int k() const { return m_k; }
+
+	//! Returns the number of nodes in the bunch of \p v.
+	int bunchSize(node v) const { return m_bunchSize[m_index[v]]; }
+
+	//! Returns the number of distances stored in all bunches.
+	int64_t size() const { return m_size; }
+
+private:
+	//! Per-thread workspace of the shortest path computations.
+	struct Workspace {
+		std::vector<TWeight> distance; //!< Tentative distances, infinity for untouched nodes
+		std::vector<int> touched; //!< The nodes with finite #distance
+		std::vector<std::pair<TWeight, int>> heap; //!< Min-heap with outdated entries
+		std::vector<int> sources; //!< The sources of the current computation
+		std::vector<int> result; //!< The bunch entries found by this thread as pairs (v, w)
+		std::vector<TWeight> resultDistance; //!< The distance of each pair in #result
+	};
+
+	//! Number of consecutive cluster centers handed to a thread at once.
+	static constexpr int s_chunkSize = 16;
+
+	static TWeight infinity() { return std::numeric_limits<TWeight>::max(); }
+
+	//! Returns the hash slot of \p w in a table with \p mask + 1 slots.
+	static int slot(int w, int mask) {
+		return static_cast<int>((static_cast<uint32_t>(w) * 2654435761u) & mask);
+	}
+
+	//! Returns whether \p w is in the bunch of \p v and assigns its distance to \p dist.
+	bool lookup(int v, int w, TWeight& dist) const {
+		const int64_t start = m_bunchStart[v];
+		const int mask = static_cast<int>(m_bunchStart[v + 1] - start) - 1;
+		for (int j = slot(w, mask);; j = (j + 1) & mask) {
+			const int x = m_bunchNode[start + j];
+			if (x == w) {
+				dist = m_bunchDistance[start + j];
+				return true;
+			}
+			if (x < 0) {
+				return false;
+			}
+		}
+	}
+
+	//! Calls \p fun(i, workspace) for all \a i in [0, \p n) on up to #m_maxThreads threads.
+	template<typename Fun>
+	void parallelFor(int n, int chunkSize, const Fun& fun) {
+		const unsigned int threads = internal::parallelForThreads(m_maxThreads, n, chunkSize);
+		if (m_workspaces.size() < static_cast<int>(threads)) {
+			m_workspaces.init(threads);
+		}
+		internal::parallelFor(threads, n, chunkSize, [&](int begin, int end, unsigned int t) {
+			Workspace& ws = m_workspaces[t];
+			if (static_cast<int>(ws.distance.size()) != m_n) {
+				ws.distance.assign(m_n, infinity());
+			}
+			for (int i = begin; i < end; ++i) {
+				fun(i, ws);
+			}
+		});
+	}
+
+	/**
+	 * Runs Dijkstra's algorithm from \p sources in \p ws. A node \a v is only reached if its
+	 * distance is less than \p bound[v] (if \p bound is not \c nullptr). Calls
+	 * \p relax(v, w) whenever the tentative path to \a w via \a v is improved and
+	 * \p settle(v, dist) for each reached node \a v.
+	 */
+	template<typename Relax, typename Settle>
+	void dijkstra(Workspace& ws, const std::vector<int>& sources, const TWeight* bound,
+			const Relax& relax, const Settle& settle) const {
+		auto greater = [](const std::pair<TWeight, int>& a, const std::pair<TWeight, int>& b) {
+			return a.first > b.first;
+		};
+		for (int s : sources) {
+			ws.distance[s] = 0;
+			ws.touched.push_back(s);
+			ws.heap.emplace_back(0, s);
+		}
+		std::make_heap(ws.heap.begin(), ws.heap.end(), greater);
+		while (!ws.heap.empty()) {
+			std::pop_heap(ws.heap.begin(), ws.heap.end(), greater);
+			const TWeight d = ws.heap.back().first;
+			const int v = ws.heap.back().second;
+			ws.heap.pop_back();
+			if (d > ws.distance[v]) {
+				continue;
+			}
+			settle(v, d);
+			for (int j = m_offset[v]; j < m_offset[v + 1]; ++j) {
+				const int w = m_target[j];
+				const TWeight dw = d + m_weight[j];
+				if (dw < ws.distance[w] && (bound == nullptr || dw < bound[w])) {
+					if (ws.distance[w] == infinity()) {
+						ws.touched.push_back(w);
+					}
+					ws.distance[w] = dw;
+					relax(v, w);
+					ws.heap.emplace_back(dw, w);
+					std::push_heap(ws.heap.begin(), ws.heap.end(), greater);
+				}
+			}
+		}
+		for (int v : ws.touched) {
+			ws.distance[v] = infinity();
+		}
+		ws.touched.clear();
+	}
+
+	//! Samples the levels \f$A_1, \dots, A_{k-1}\f$ into #m_level.
+	void sampleLevels() {
+		const double probability = m_n > 0 ? pow(m_n, -1.0 / m_k) : 1.0;
+		m_level.assign(m_n, 0);
+		std::vector<int> top(m_n);
+		for (int v = 0; v < m_n; ++v) {
+			top[v] = v;
+		}
+		for (int i = 1; i < m_k && !top.empty(); ++i) {
+			std::vector<int> next;
+			for (int v : top) {
+				if (randomDouble(0.0, 1.0) <= probability) {
+					next.push_back(v);
+				}
+			}
+			if (next.empty() && i == m_k - 1) {
+				// the topmost level must not be empty
+				next.push_back(top[randomNumber(0, static_cast<int>(top.size()) - 1)]);
+			}
+			for (int v : next) {
+				m_level[v] = i;
+			}
+			top = std::move(next);
+		}
+	}
+
+	//! Computes the nearest node \f$p_i(v) \in A_i\f$ of each node \a v for all levels \a i.
+	void computePivots() {
+		m_pivot.assign(static_cast<size_t>(m_k) * m_n, -1);
+		m_pivotDistance.assign(static_cast<size_t>(m_k) * m_n, infinity());
+
+		// one multi-source Dijkstra per level
+		parallelFor(m_k, 1, [&](int i, Workspace& ws) {
+			int* pivot = m_pivot.data() + static_cast<size_t>(i) * m_n;
+			TWeight* dist = m_pivotDistance.data() + static_cast<size_t>(i) * m_n;
+			// the source of the current tentative path to each node
+			std::vector<int> via(m_n, -1);
+			std::vector<int> sources;
+			for (int v = 0; v < m_n; ++v) {
+				if (m_level[v] >= i) {
+					sources.push_back(v);
+					via[v] = v;
+				}
+			}
+			dijkstra(
+					ws, sources, nullptr, [&](int v, int w) { via[w] = via[v]; },
+					[&](int v, TWeight d) {
+						pivot[v] = via[v];
+						dist[v] = d;
+					});
+		});
+
+		// Nodes that are as close to A_{i+1} as to A_i get the pivot of level i+1
+		for (int i = m_k - 2; i >= 0; --i) {
+			for (int v = 0; v < m_n; ++v) {
+				const size_t below = static_cast<size_t>(i) * m_n + v;
+				const size_t above = below + m_n;
+				if (m_pivot[above] >= 0 && m_pivotDistance[below] == m_pivotDistance[above]) {
+					m_pivot[below] = m_pivot[above];
+				}
+			}
+		}
+	}
+
+	//! Computes the clusters of all nodes and stores them as the bunches of their members.
+	void computeBunches() {
+		for (Workspace& ws : m_workspaces) {
+			ws.result.clear();
+			ws.resultDistance.clear();
+		}
+
+		// The cluster of w in A_i \ A_{i+1} contains the nodes closer to w than to A_{i+1}
+		parallelFor(m_n, s_chunkSize, [&](int w, Workspace& ws) {
+			const int i = m_level[w];
+			const TWeight* bound = nullptr;
+			if (i + 1 < m_k) {
+				bound = m_pivotDistance.data() + static_cast<size_t>(i + 1) * m_n;
+			}
+			if (bound != nullptr && !(0 < bound[w])) {
+				return;
+			}
+			ws.sources.assign(1, w);
+			dijkstra(
+					ws, ws.sources, bound, [](int, int) {},
+					[&](int v, TWeight d) {
+						ws.result.push_back(v);
+						ws.result.push_back(w);
+						ws.resultDistance.push_back(d);
+					});
+		});
+
+		// Store the bunches as hash tables with at least twice as many slots as entries
+		m_bunchSize.assign(m_n, 0);
+		for (Workspace& ws : m_workspaces) {
+			for (size_t j = 0; j < ws.result.size(); j += 2) {
+				++m_bunchSize[ws.result[j]];
+			}
+		}
+		m_bunchStart.assign(m_n + 1, 0);
+		m_size = 0;
+		for (int v = 0; v < m_n; ++v) {
+			int capacity = 1;
+			while (capacity < 2 * m_bunchSize[v]) {
+				capacity *= 2;
+			}
+			m_bunchStart[v + 1] = m_bunchStart[v] + capacity;
+			m_size += m_bunchSize[v];
+		}
+		m_bunchNode.assign(m_bunchStart[m_n], -1);
+		m_bunchDistance.resize(m_bunchStart[m_n]);
+		for (Workspace& ws : m_workspaces) {
+			for (size_t j = 0; j < ws.result.size(); j += 2) {
+				const int v = ws.result[j];
+				const int w = ws.result[j + 1];
+				const int64_t start = m_bunchStart[v];
+				const int mask = static_cast<int>(m_bunchStart[v + 1] - start) - 1;
+				int s = slot(w, mask);
+				while (m_bunchNode[start + s] >= 0) {
+					s = (s + 1) & mask;
+				}
+				m_bunchNode[start + s] = w;
+				m_bunchDistance[start + s] = ws.resultDistance[j / 2];
+			}
+		}
+	}
+
+	const Graph* m_graph = nullptr; //!< The graph
+	int m_k = 0; //!< The trade-off parameter
+	int m_n = 0; //!< The number of nodes
+	NodeArray<int> m_index; //!< The index of each node
+
+	/**
+	 * The graph as adjacency arrays during the construction: the adjacencies of node \a v are
+	 * the indices m_offset[v], ..., m_offset[v+1]-1.
+	 * @{
+	 */
+	std::vector<int> m_offset;
+	std::vector<int> m_target; //!< The opposite node of each adjacency
+	std::vector<TWeight> m_weight; //!< The weight of each adjacency
+	//! @}
+
+	Array<Workspace> m_workspaces; //!< The workspaces of the threads during the construction
+
+	std::vector<int> m_level; //!< The largest \a i with \f$v \in A_i\f$ for each node \a v
+	std::vector<int> m_pivot; //!< \f$p_i(v)\f$ at index \f$i \cdot n + v\f$, or -1
+	std::vector<TWeight> m_pivotDistance; //!< \f$d(A_i, v)\f$ at index \f$i \cdot n + v\f$
+
+	/**
+	 * The bunch of node \a v is a hash table with linear probing in the slots
+	 * m_bunchStart[v], ..., m_bunchStart[v+1]-1; the number of slots is a power of two.
+	 * @{
+	 */
+	std::vector<int64_t> m_bunchStart;
+	std::vector<int> m_bunchNode; //!< The node in each slot, or -1 for empty slots
+	std::vector<TWeight> m_bunchDistance; //!< The distance to the node in each slot
+	std::vector<int> m_bunchSize; //!< The number of nodes in each bunch
+	//! @}
+
+	int64_t m_size = 0; //!< The number of distances stored in all bunches
+};
+
+}
@@ -38,6 +38,7 @@
 #include <ogdf/basic/GraphList.h>
 #include <ogdf/basic/Logger.h>
 #include <ogdf/basic/basic.h>
+#include <ogdf/basic/internal/parallel.h>
 #include <ogdf/graphalg/MatchingModule.h>
 #include <ogdf/graphalg/matching_blossom/AuxGraph.h>
 #include <ogdf/graphalg/matching_blossom/BlossomVHelper.h>
@@ -64,7 +65,7 @@ class MatchingBlossomV;
 } // namespace ogdf
 
 // Uncomment to print statistics
-#define OGDF_BLOSSOMV_PRINT_STATS
+// #define OGDF_BLOSSOMV_PRINT_STATS
 
 // Helper macros for statistics
 #ifdef OGDF_BLOSSOMV_PRINT_STATS
@@ -88,7 +89,7 @@ namespace ogdf {
  * Weight Perfect Matching.
  */
 template<typename TWeight>
-class MatchingBlossomV : public MatchingModule<TWeight> {
+class MatchingBlossomV : public MatchingModule<TWeight>, public internal::MaxThreadsOption {
 	BlossomVHelper<TWeight> m_helper;
 	AuxGraph<TWeight> m_auxGraph;
 
@@ -98,6 +99,52 @@ class MatchingBlossomV : public MatchingModule<TWeight> {
 	//! The epsilon test for floating point comparisons.
 	EpsilonTest m_eps;
 
+	/**
+	 * @name Workspace of the dual change step
+	 * These arrays live on the aux graph and are reused by all dual change steps.
+	 */
+	//! @{
+
+	//! The bound for the delta of each tree given by its own priority queues.
+	NodeArray<TWeight> m_treeBound;
+
+	//! The delta of each tree.
+	NodeArray<TWeight> m_treeDelta;
+
+	//! The index of the component of each tree.
+	NodeArray<int> m_treeComponent;
+
+	//! The real top priority of the even-even edges of each aux edge.
+	EdgeArray<TWeight> m_evenEvenTop;
+
+	//! The real top priority of the even-odd edges of each aux edge.
+	EdgeArray<TWeight> m_evenOddTop;
+
+	//! The real top priority of the odd-even edges of each aux edge.
+	EdgeArray<TWeight> m_oddEvenTop;
+
+	/**
+	 * The minimal number of aux nodes and edges per thread in computeDualBounds().
+	 *
+	 * Threads are started anew for every dual change, which only pays off if each of them
+	 * reads many priority queues. Smaller aux graphs are handled by the calling thread.
+	 */
+	static constexpr int s_minDualItemsPerThread = 1 << 16;
+
+	//! The aux nodes, as handed out to the threads.
+	std::vector<node> m_dualNodes;
+
+	//! The aux edges, as handed out to the threads.
+	std::vector<edge> m_dualEdges;
+
+	//! The trees grouped by component.
+	std::vector<node> m_componentOrder;
+
+	//! The start of each component in #m_componentOrder, followed by the number of trees.
+	std::vector<int> m_componentStart;
+
+	//! @}
+
 #ifdef OGDF_BLOSSOMV_PRINT_STATS
 	//! Structure to store statistics.
 	struct stats {
@@ -279,7 +326,16 @@ public:
 	 *
 	 * @param greedyInit whether or not to use the greedy initialization
 	 */
-	MatchingBlossomV(bool greedyInit = true) : m_helper(greedyInit), m_auxGraph(m_helper) { }
+	MatchingBlossomV(bool greedyInit = true)
+		: m_helper(greedyInit)
+		, m_auxGraph(m_helper)
+		, m_treeBound(m_auxGraph.graph())
+		, m_treeDelta(m_auxGraph.graph())
+		, m_treeComponent(m_auxGraph.graph())
+		, m_evenEvenTop(m_auxGraph.graph())
+		, m_evenOddTop(m_auxGraph.graph())
+		, m_oddEvenTop(m_auxGraph.graph()) {
+	}
 
 private:
 	bool doCall(const Graph& G, const EdgeArray<TWeight>& weights,
@@ -471,49 +527,86 @@ private:
 		return false;
 	}
 
+	/**
+	 * @brief Computes all bounds for the next dual change that depend on a single tree or aux edge.
+	 *
+	 * The priority queues are only read, so the aux nodes and edges are distributed over up to
+	 * #m_maxThreads threads, at least #s_minDualItemsPerThread per thread.
+	 */
+	void computeDualBounds() {
+		const GraphCopySimple& auxGraph = m_auxGraph.graph();
+		m_dualNodes.clear();
+		m_dualEdges.clear();
+		for (node v : auxGraph.nodes) {
+			m_dualNodes.push_back(v);
+		}
+		for (edge e : auxGraph.edges) {
+			m_dualEdges.push_back(e);
+		}
+
+		const int n = static_cast<int>(m_dualNodes.size());
+		const int total = n + static_cast<int>(m_dualEdges.size());
+		internal::parallelFor(m_maxThreads, total, s_minDualItemsPerThread,
+				[&](int begin, int end, unsigned int) {
+					for (int i = begin; i < end; ++i) {
+						if (i < n) {
+							node v = m_dualNodes[i];
+							AuxNode<TWeight>* auxNode = m_auxGraph.auxNode(v);
+							TWeight bound = std::min(
+									m_helper.getRealTopPriority(auxNode->evenFreeEdges()),
+									m_helper.getRealTopPriority(auxNode->oddPseudonodes()));
+							if (!auxNode->evenEvenEdges().empty()) {
+								bound = std::min(bound,
+										m_helper.getRealTopPriority(auxNode->evenEvenEdges()) / 2);
+							}
+							m_treeBound[v] = bound;
+							m_treeDelta[v] = 0;
+						} else {
+							edge e = m_dualEdges[i - n];
+							AuxEdge<TWeight>* auxEdge = m_auxGraph.auxEdge(e);
+							m_evenEvenTop[e] = m_helper.getRealTopPriority(auxEdge->evenEvenEdges());
+							m_evenOddTop[e] = m_helper.getRealTopPriority(auxEdge->evenOddEdges());
+							m_oddEvenTop[e] = m_helper.getRealTopPriority(auxEdge->oddEvenEdges());
+						}
+					}
+				});
+	}
+
 	//! Executes a dual change step.
 	bool dualChange() {
 		OGDF_BLOSSOMV_START_TIMER();
-		NodeArray<TWeight> deltas(m_auxGraph.graph(), 0);
-		TWeight delta, otherDelta;
-		AuxEdge<TWeight>* auxEdge;
-		node w;
+		computeDualBounds();
 
 		// Calculates the connected components of the aux graph and sets the same delta for nodes in
 		// the same component.
-		std::vector<std::unordered_set<node>> components;
-		m_auxGraph.connectedComponents(components);
-		for (auto& component : components) {
-			delta = infinity<TWeight>();
-			AuxNode<TWeight>* auxNode;
-			for (node v : component) {
-				auxNode = m_auxGraph.auxNode(v);
-				if (!auxNode->evenEvenEdges().empty()) {
-					delta = std::min(delta,
-							m_helper.getRealTopPriority(auxNode->evenEvenEdges()) / 2);
-				}
-				delta = std::min({delta, m_helper.getRealTopPriority(auxNode->evenFreeEdges()),
-						m_helper.getRealTopPriority(auxNode->oddPseudonodes())});
-				for (auto& adj : v->adjEntries) {
-					w = adj->twinNode();
-					auxEdge = m_auxGraph.auxEdge(adj->theEdge());
-					if (component.find(w) != component.end()) {
+		auto isTight = [&](edge e) {
+			return m_helper.isZero(m_evenOddTop[e]) || m_helper.isZero(m_oddEvenTop[e]);
+		};
+		m_auxGraph.connectedComponents(isTight, m_treeComponent, m_componentOrder,
+				m_componentStart);
+		const int components = static_cast<int>(m_componentStart.size()) - 1;
+		for (int c = 0; c < components; ++c) {
+			TWeight delta = infinity<TWeight>();
+			for (int i = m_componentStart[c]; i < m_componentStart[c + 1]; ++i) {
+				node v = m_componentOrder[i];
+				delta = std::min(delta, m_treeBound[v]);
+				for (adjEntry adj : v->adjEntries) {
+					edge e = adj->theEdge();
+					node w = adj->twinNode();
+					TWeight evenEven = m_evenEvenTop[e];
+					if (m_treeComponent[w] == c) {
 						// same component = same delta
-						if (!auxEdge->evenEvenEdges().empty()) {
-							delta = std::min(delta,
-									m_helper.getRealTopPriority(auxEdge->evenEvenEdges()) / 2);
+						if (evenEven < infinity<TWeight>()) {
+							delta = std::min(delta, evenEven / 2);
 						}
 					} else {
-						otherDelta = deltas[w];
-						if (!auxEdge->evenEvenEdges().empty()) {
-							delta = std::min(delta,
-									m_helper.getRealTopPriority(auxEdge->evenEvenEdges())
-											- otherDelta);
+						TWeight otherDelta = m_treeDelta[w];
+						if (evenEven < infinity<TWeight>()) {
+							delta = std::min(delta, evenEven - otherDelta);
 						}
-						auto& evenOddPQ = auxEdge->evenOddEdgesFromPerspective(auxNode);
-						if (!evenOddPQ.empty()) {
-							delta = std::min(delta,
-									m_helper.getRealTopPriority(evenOddPQ) + otherDelta);
+						TWeight evenOdd = e->source() == v ? m_evenOddTop[e] : m_oddEvenTop[e];
+						if (evenOdd < infinity<TWeight>()) {
+							delta = std::min(delta, evenOdd + otherDelta);
 						}
 					}
 					// if already at zero, no dual change can be made in this tree
@@ -524,15 +617,16 @@ private:
 			}
 			// apply delta to all nodes of the component
 			if (delta > 0 && delta < infinity<TWeight>()) {
-				for (auto& v : component) {
-					deltas[v] = delta;
+				for (int i = m_componentStart[c]; i < m_componentStart[c + 1]; ++i) {
+					m_treeDelta[m_componentOrder[i]] = delta;
 				}
 			}
 		}
 
 		bool dualChange = false;
-		for (auto& auxNode : m_auxGraph.nodes()) {
-			delta = deltas[auxNode->graphNode()];
+		for (node v : m_dualNodes) {
+			TWeight delta = m_treeDelta[v];
+			AuxNode<TWeight>* auxNode = m_auxGraph.auxNode(v);
 			if (delta > 0) {
 				dualChange = true;
 				auxNode->addDelta(delta);
@@ -0,0 +1,400 @@
+/** \file
+ * \brief Declaration and implementation of class MaxFlowPushRelabel, a
+ * highest-label push-relabel algorithm on a flat residual graph.
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.md in the OGDF root directory for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, see
+ * http://www.gnu.org/copyleft/gpl.html
+ */
+
+#pragma once
+
+#include <ogdf/basic/Array.h>
+#include <ogdf/basic/Graph.h>
+#include <ogdf/basic/Math.h>
+#include <ogdf/basic/basic.h>
+#include <ogdf/basic/internal/parallel.h>
+#include <ogdf/graphalg/MaxFlowModule.h>
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace ogdf {
+
+//! Computes a max flow with the highest-label push-relabel algorithm.
+/**
+ * @ingroup ga-flow
+ *
+ * The graph is copied into a flat residual graph: the arcs of each node are
+ * stored consecutively, and each arc knows the index of its reverse arc.
+ * Active nodes are kept in buckets by label and always the one with highest
+ * label is discharged. Additionally, all nodes are kept in doubly linked
+ * bucket lists by label, which makes the gap heuristic cheap: if no node has
+ * label \a l any more, all nodes with larger labels are cut off from the
+ * sink.
+ *
+ * The labels are recomputed by a breadth-first search from the sink (global
+ * relabeling) at the start and whenever the work since the last global
+ * relabeling exceeds #c_globalRelabelFactor times the number of nodes plus
+ * the number of arcs. Large levels of this search are expanded by several
+ * threads.
+ *
+ * The first stage, computeValue(), computes a maximum preflow. The second
+ * stage, computeFlowAfterValue(), returns the excess of all nodes that cannot
+ * reach the sink back to the source by another push-relabel pass.
+ *
+ * As in MaxFlowGoldbergTarjan, edges entering the source are ignored.
+ *
+ * <H3>Optional parameters</H3>
+ *
+ * <table>
+ *   <tr>
+ *     <th><i>Option</i><th><i>Type</i><th><i>Default</i><th><i>Description</i>
+ *   </tr><tr>
+ *     <td><i>maxThreads</i><td>int<td>System::numberOfProcessors()
+ *     <td>The maximal number of threads used by global relabeling. At most
+ *     one thread is used per #c_minArcsPerThread arcs of a level.
+ *   </tr>
+ * </table>
+ */
+template<typename TCap>
+class MaxFlowPushRelabel : public MaxFlowModule<TCap>, public internal::MaxThreadsOption {
+public:
+	//! Frequency of global relabeling, see class description.
+	static constexpr int c_globalRelabelFactor = 6;
+
+	//! The minimal number of arcs per thread in global relabeling.
+	static constexpr int c_minArcsPerThread = 1 << 14;
+
+	using MaxFlowModule<TCap>::MaxFlowModule;
+
+	//! Computes a maximum preflow and returns its value.
+	TCap computeValue(const EdgeArray<TCap>& cap, const node& s, const node& t) override {
+		this->m_s = &s;
+		this->m_t = &t;
+		this->m_cap = &cap;
+		this->m_flow->init(*this->m_G, (TCap)0);
+		OGDF_ASSERT(this->isFeasibleInstance());
+
+		buildResidualGraph();
+		m_source = s->index();
+		m_sink = t->index();
+		if (s == t) {
+			return (TCap)0;
+		}
+
+		// saturate all arcs leaving the source
+		for (int a = m_begin[m_source]; a < m_begin[m_source + 1]; ++a) {
+			const TCap r = m_residual[a];
+			m_residual[a] = 0;
+			m_residual[m_mate[a]] += r;
+			m_excess[m_head[a]] += r;
+		}
+		m_excess[m_source] = 0;
+
+		discharge(m_sink, m_source, m_nodes, true);
+		return m_excess[m_sink];
+	}
+
+	//! Turns the maximum preflow into a maximum flow and stores it in the flow array.
+	void computeFlowAfterValue() override {
+		if (m_source != m_sink) {
+			// the sink is blocked and the excess flows back to the source
+			discharge(m_source, m_sink, 2 * m_nodes, false);
+		}
+
+		for (edge e : this->m_G->edges) {
+			const int a = m_forward[e->index()];
+			(*this->m_flow)[e] = a < 0 ? (TCap)0 : m_capacity[a] - m_residual[a];
+		}
+	}
+
+	using MaxFlowModule<TCap>::useEpsilonTest;
+	using MaxFlowModule<TCap>::init;
+	using MaxFlowModule<TCap>::computeFlow;
+	using MaxFlowModule<TCap>::computeFlowAfterValue;
+
+private:
+	int m_n = 0; //!< Size of all node arrays (maximal node index + 1).
+	int m_source = -1, m_sink = -1;
+	int m_nodes = 0; //!< Number of nodes; labels of at least this value mean "cut off".
+
+	// residual graph; the arcs of node v are m_begin[v], ..., m_begin[v+1]-1
+	std::vector<int> m_begin;
+	std::vector<int> m_head;
+	std::vector<int> m_mate; //!< Index of the reverse arc.
+	std::vector<TCap> m_residual;
+	std::vector<TCap> m_capacity;
+	std::vector<int> m_forward; //!< Forward arc of each edge (-1 for ignored edges).
+	std::vector<char> m_exists; //!< Whether a node has the index.
+
+	std::vector<TCap> m_excess;
+	std::vector<int> m_label;
+	std::vector<int> m_current; //!< Current arc of each node.
+
+	// buckets: a stack of active nodes and a doubly linked list of all nodes per label
+	std::vector<int> m_activeFirst, m_activeNext;
+	std::vector<int> m_allFirst, m_allNext, m_allPrev;
+	int m_maxActive = 0; //!< No active node has a larger label.
+	int m_maxLabel = 0; //!< No node in the bucket lists has a larger label.
+
+	std::unique_ptr<std::atomic<int>[]> m_distance; //!< Used by global relabeling.
+
+	bool positive(TCap x) const { return this->m_et->greater(x, (TCap)0); }
+
+	void buildResidualGraph() {
+		const Graph& G = *this->m_G;
+		m_n = G.maxNodeIndex() + 1;
+		m_nodes = G.numberOfNodes();
+		m_exists.assign(m_n, false);
+		m_begin.assign(m_n + 1, 0);
+		for (node v : G.nodes) {
+			m_exists[v->index()] = true;
+		}
+		for (edge e : G.edges) {
+			if (!e->isSelfLoop()) {
+				++m_begin[e->source()->index() + 1];
+				++m_begin[e->target()->index() + 1];
+			}
+		}
+		for (int v = 0; v < m_n; ++v) {
+			m_begin[v + 1] += m_begin[v];
+		}
+
+		const int arcs = m_begin[m_n];
+		m_head.resize(arcs);
+		m_mate.resize(arcs);
+		m_residual.resize(arcs);
+		m_capacity.resize(arcs);
+		m_forward.assign(G.maxEdgeIndex() + 1, -1);
+		std::vector<int> pos(m_begin.begin(), m_begin.end() - 1);
+		for (edge e : G.edges) {
+			if (e->isSelfLoop()) {
+				continue;
+			}
+			const int u = e->source()->index(), v = e->target()->index();
+			const int a = pos[u]++, b = pos[v]++;
+			const TCap cap = e->target() == *this->m_s ? (TCap)0 : (*this->m_cap)[e];
+			m_head[a] = v;
+			m_mate[a] = b;
+			m_residual[a] = m_capacity[a] = cap;
+			m_head[b] = u;
+			m_mate[b] = a;
+			m_residual[b] = m_capacity[b] = 0;
+			m_forward[e->index()] = a;
+		}
+
+		m_excess.assign(m_n, 0);
+		m_label.assign(m_n, 0);
+		m_current.assign(m_n, 0);
+		m_activeNext.assign(m_n, -1);
+		m_allNext.assign(m_n, -1);
+		m_allPrev.assign(m_n, -1);
+		m_distance.reset(new std::atomic<int>[m_n]);
+	}
+
+	void addActive(int v) {
+		m_activeNext[v] = m_activeFirst[m_label[v]];
+		m_activeFirst[m_label[v]] = v;
+		Math::updateMax(m_maxActive, m_label[v]);
+	}
+
+	void addToBucket(int v) {
+		const int l = m_label[v];
+		m_allPrev[v] = -1;
+		m_allNext[v] = m_allFirst[l];
+		if (m_allFirst[l] >= 0) {
+			m_allPrev[m_allFirst[l]] = v;
+		}
+		m_allFirst[l] = v;
+		Math::updateMax(m_maxLabel, l);
+	}
+
+	void removeFromBucket(int v) {
+		if (m_allPrev[v] >= 0) {
+			m_allNext[m_allPrev[v]] = m_allNext[v];
+		} else {
+			m_allFirst[m_label[v]] = m_allNext[v];
+		}
+		if (m_allNext[v] >= 0) {
+			m_allPrev[m_allNext[v]] = m_allPrev[v];
+		}
+	}
+
+	/**
+	 * Sets the label of every node to its distance to \p sink in the residual
+	 * graph (or to \p bound) and rebuilds the buckets. The labels of \p sink
+	 * and \p blocked are fixed.
+	 */
+	void globalRelabel(int sink, int blocked, int bound) {
+		for (int v = 0; v < m_n; ++v) {
+			m_distance[v].store(bound, std::memory_order_relaxed);
+		}
+		m_distance[sink].store(0, std::memory_order_relaxed);
+		m_distance[blocked].store(bound, std::memory_order_relaxed);
+
+		std::vector<int> frontier {sink};
+		std::vector<std::vector<int>> next(m_maxThreads);
+		for (int level = 1; !frontier.empty(); ++level) {
+			int64_t arcs = 0;
+			for (int w : frontier) {
+				arcs += m_begin[w + 1] - m_begin[w];
+			}
+			const unsigned int nThreads = static_cast<unsigned int>(
+					min<int64_t>(m_maxThreads, max<int64_t>(1, arcs / c_minArcsPerThread)));
+
+			// u gets the next label if the arc from u to w has residual capacity
+			std::function<void(unsigned int)> worker = [&](unsigned int id) {
+				const int64_t size = frontier.size();
+				const int last = static_cast<int>(size * (id + 1) / nThreads);
+				for (int i = static_cast<int>(size * id / nThreads); i < last; ++i) {
+					const int w = frontier[i];
+					for (int a = m_begin[w]; a < m_begin[w + 1]; ++a) {
+						const int u = m_head[a];
+						int unreached = bound;
+						if (u != blocked && positive(m_residual[m_mate[a]])
+								&& m_distance[u].load(std::memory_order_relaxed) == bound
+								&& m_distance[u].compare_exchange_strong(unreached, level,
+										std::memory_order_relaxed)) {
+							next[id].push_back(u);
+						}
+					}
+				}
+			};
+
+			internal::runThreads(nThreads, worker);
+
+			frontier.clear();
+			for (unsigned int t = 0; t < nThreads; ++t) {
+				frontier.insert(frontier.end(), next[t].begin(), next[t].end());
+				next[t].clear();
+			}
+		}
+
+		m_activeFirst.assign(bound + 1, -1);
+		m_allFirst.assign(bound + 1, -1);
+		m_maxActive = m_maxLabel = 0;
+		for (int v = 0; v < m_n; ++v) {
+			if (!m_exists[v] || v == sink || v == blocked) {
+				continue;
+			}
+			m_label[v] = m_distance[v].load(std::memory_order_relaxed);
+			m_current[v] = m_begin[v];
+			if (m_label[v] < bound) {
+				addToBucket(v);
+				if (positive(m_excess[v])) {
+					addActive(v);
+				}
+			}
+		}
+		m_label[sink] = 0;
+		m_label[blocked] = bound;
+	}
+
+	/**
+	 * Pushes all excess that can reach \p sink to it. Nodes with label
+	 * \p bound are ignored. If \p gap is true, the gap heuristic is used
+	 * (which requires that \p bound is the number of nodes).
+	 */
+	void discharge(int sink, int blocked, int bound, bool gap) {
+		const int64_t relabelWork = int64_t(c_globalRelabelFactor) * m_nodes + m_begin[m_n];
+		int64_t work = 0;
+		globalRelabel(sink, blocked, bound);
+
+		for (;;) {
+			while (m_maxActive > 0 && m_activeFirst[m_maxActive] < 0) {
+				--m_maxActive;
+			}
+			if (m_maxActive <= 0) {
+				break;
+			}
+			const int v = m_activeFirst[m_maxActive];
+			m_activeFirst[m_maxActive] = m_activeNext[v];
+
+			int l = m_label[v];
+			while (positive(m_excess[v])) {
+				// find an admissible arc, starting with the current one
+				int a = m_current[v];
+				while (a < m_begin[v + 1]
+						&& !(positive(m_residual[a]) && m_label[m_head[a]] == l - 1)) {
+					++a;
+				}
+
+				if (a < m_begin[v + 1]) {
+					m_current[v] = a;
+					const int w = m_head[a];
+					const TCap delta = min(m_excess[v], m_residual[a]);
+					const bool wasActive = positive(m_excess[w]);
+					m_residual[a] -= delta;
+					m_residual[m_mate[a]] += delta;
+					m_excess[v] -= delta;
+					m_excess[w] += delta;
+					if (!wasActive && w != sink && w != blocked) {
+						addActive(w);
+					}
+					continue;
+				}
+
+				// relabel
+				int newLabel = bound;
+				for (a = m_begin[v]; a < m_begin[v + 1]; ++a) {
+					if (positive(m_residual[a])) {
+						Math::updateMin(newLabel, m_label[m_head[a]] + 1);
+					}
+				}
+				work += m_begin[v + 1] - m_begin[v] + c_globalRelabelFactor;
+				removeFromBucket(v);
+
+				if (gap && m_allFirst[l] < 0) {
+					// no node has label l any more, so v and all nodes above are cut off
+					for (int k = l + 1; k <= m_maxLabel; ++k) {
+						for (int u = m_allFirst[k]; u >= 0; u = m_allNext[u]) {
+							m_label[u] = bound;
+						}
+						m_allFirst[k] = -1;
+					}
+					m_maxLabel = l - 1;
+					newLabel = bound;
+				}
+
+				m_label[v] = l = min(newLabel, bound);
+				if (l == bound) {
+					break;
+				}
+				m_current[v] = m_begin[v];
+				addToBucket(v);
+			}
+
+			if (work > relabelWork) {
+				work = 0;
+				globalRelabel(sink, blocked, bound);
+			}
+		}
+	}
+};
+
+}
@@ -0,0 +1,395 @@
+/** \file
+ * \brief Definition of ogdf::MinCostFlowCostScaling class template
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.md in the OGDF root directory for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, see
+ * http://www.gnu.org/copyleft/gpl.html
+ */
+
+#pragma once
+
+#include <ogdf/basic/Graph.h>
+#include <ogdf/basic/GraphList.h>
+#include <ogdf/basic/Math.h>
+#include <ogdf/basic/basic.h>
+#include <ogdf/graphalg/MinCostFlowModule.h>
+
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+namespace ogdf {
+
+//! Computes a min-cost flow with Goldberg's cost-scaling push-relabel algorithm.
+/**
+ * @ingroup ga-flow
+ *
+ * The costs are multiplied by \a n + 1 (where \a n is the number of nodes)
+ * and the algorithm maintains a pseudoflow together with node prices
+ * \a p such that every residual arc (\a v, \a w) has reduced cost
+ * cost(\a v, \a w) - \a p(\a v) + \a p(\a w) >= -\a eps. Each scaling phase
+ * divides \a eps by #c_scalingFactor and restores this invariant by
+ * pushing flow along arcs with negative reduced cost and relabeling nodes
+ * with excess. When \a eps reaches 1, the flow is optimal for the original
+ * costs.
+ *
+ * The residual graph is stored in flat arrays: the arcs of each node are
+ * consecutive, and each arc knows the index of its reverse arc.
+ *
+ * After the last phase, the prices are turned into exact optimal dual
+ * values: for every edge \a e = (\a v, \a w) with flow below its upper
+ * bound, \a cost[\a e] - \a dual[\a v] + \a dual[\a w] >= 0, and for every
+ * edge with flow above its lower bound, this value is at most 0.
+ *
+ * Infeasible instances are detected during the first phase: if a feasible
+ * flow exists, no price can grow by more than (\a n + 1) times the sum of
+ * the largest absolute initial reduced cost and \a eps.
+ *
+ * The cost type must be integral.
+ *
+ * <H3>Optional parameters</H3>
+ *
+ * <table>
+ *   <tr>
+ *     <th><i>Option</i><th><i>Type</i><th><i>Default</i><th><i>Description</i>
+ *   </tr><tr>
+ *     <td><i>warmStart</i><td>bool<td>false
+ *     <td>If set, the arrays \a flow and \a dual passed to call() are used as
+ *     starting solution if they belong to the input graph. The flow is
+ *     clamped to the bounds and the remaining imbalance is routed by the
+ *     first phase, which starts with the smallest \a eps for which the
+ *     starting solution is \a eps-optimal. If only a few bounds, costs or
+ *     supplies changed since the previous call, this is much faster than
+ *     starting from scratch.
+ *   </tr>
+ * </table>
+ */
+template<typename TCost>
+class MinCostFlowCostScaling : public MinCostFlowModule<TCost> {
+	static_assert(std::is_integral<TCost>::value,
+			"MinCostFlowCostScaling requires an integral cost type");
+
+public:
+	//! The factor by which \a eps is divided in each scaling phase.
+	static constexpr int c_scalingFactor = 16;
+
+	MinCostFlowCostScaling() { }
+
+	using MinCostFlowModule<TCost>::call;
+
+	/**
+	 * \brief Computes a min-cost flow in the directed graph \p G using cost scaling.
+	 *
+	 * \pre \p G must be connected, \p lowerBound[\a e] <= \p upperBound[\a e]
+	 *      for all edges \a e, and the sum over all supplies must be zero.
+	 *
+	 * @param G is the directed input graph.
+	 * @param lowerBound gives the lower bound for the flow on each edge.
+	 * @param upperBound gives the upper bound for the flow on each edge.
+	 * @param cost gives the costs for each edge.
+	 * @param supply gives the supply (or demand if negative) of each node.
+	 * @param flow is assigned the computed flow on each edge. If #warmStart is
+	 *        set, it also provides the starting flow.
+	 * @param dual is assigned the computed dual variables. If #warmStart is
+	 *        set, it also provides the starting prices.
+	 * \return true iff a feasible min-cost flow exists.
+	 */
+	virtual bool call(const Graph& G, const EdgeArray<int>& lowerBound,
+			const EdgeArray<int>& upperBound, const EdgeArray<TCost>& cost,
+			const NodeArray<int>& supply, EdgeArray<int>& flow, NodeArray<TCost>& dual) override;
+
+	int infinity() const { return std::numeric_limits<int>::max(); }
+
+	//! Returns whether the flow and dual values passed to call() are used as starting solution.
+	bool warmStart() const { return m_warmStart; }
+
+	//! Sets whether the flow and dual values passed to call() are used as starting solution.
+	void warmStart(bool b) { m_warmStart = b; }
+
+private:
+	bool m_warmStart = false;
+
+	int m_n = 0; //!< Size of all node arrays (maximal node index + 1).
+
+	// residual graph; the arcs of node v are m_begin[v], ..., m_begin[v+1]-1
+	std::vector<int> m_begin;
+	std::vector<int> m_head;
+	std::vector<int> m_mate; //!< Index of the reverse arc.
+	std::vector<int64_t> m_residual;
+	std::vector<int64_t> m_cost; //!< Scaled cost of each arc.
+	std::vector<int> m_forward; //!< Forward arc of each edge (-1 for self-loops).
+
+	std::vector<int64_t> m_excess;
+	std::vector<int64_t> m_price;
+	std::vector<int> m_current; //!< Current arc of each node.
+	std::vector<int> m_queue; //!< Ring buffer of active nodes.
+
+	int64_t reducedCost(int v, int a) const { return m_cost[a] - m_price[v] + m_price[m_head[a]]; }
+
+	void push(int a, int64_t delta) {
+		m_residual[a] -= delta;
+		m_residual[m_mate[a]] += delta;
+		m_excess[m_head[m_mate[a]]] -= delta;
+		m_excess[m_head[a]] += delta;
+	}
+
+	/**
+	 * Restores \p eps-optimality of the prices starting from a 0-optimal pseudoflow.
+	 * Returns false if a price grows by more than \p limit.
+	 */
+	bool refine(int64_t eps, int64_t limit);
+
+	//! Computes exact dual values (in original costs) from the prices.
+	void computeDuals(int64_t scale);
+};
+
+}
+
+// Implementation
+
+namespace ogdf {
+
+template<typename TCost>
+bool MinCostFlowCostScaling<TCost>::call(const Graph& G, const EdgeArray<int>& lowerBound,
+		const EdgeArray<int>& upperBound, const EdgeArray<TCost>& cost,
+		const NodeArray<int>& supply, EdgeArray<int>& flow, NodeArray<TCost>& dual) {
+	OGDF_ASSERT(this->checkProblem(G, lowerBound, upperBound, supply));
+
+	const bool warmFlow = m_warmStart && flow.graphOf() == &G;
+	const bool warmDual = m_warmStart && dual.graphOf() == &G;
+	if (!warmFlow) {
+		flow.init(G);
+	}
+	if (!warmDual) {
+		dual.init(G);
+	}
+
+	// costs are scaled by n+1, so 1-optimality implies optimality
+	const int64_t scale = G.numberOfNodes() + 1;
+
+	m_n = G.maxNodeIndex() + 1;
+	m_begin.assign(m_n + 1, 0);
+	for (edge e : G.edges) {
+		if (!e->isSelfLoop()) {
+			++m_begin[e->source()->index() + 1];
+			++m_begin[e->target()->index() + 1];
+		}
+	}
+	for (int v = 0; v < m_n; ++v) {
+		m_begin[v + 1] += m_begin[v];
+	}
+
+	const int arcs = m_begin[m_n];
+	m_head.resize(arcs);
+	m_mate.resize(arcs);
+	m_residual.resize(arcs);
+	m_cost.resize(arcs);
+	m_forward.assign(G.maxEdgeIndex() + 1, -1);
+	m_excess.assign(m_n, 0);
+	m_price.assign(m_n, 0);
+
+	for (node v : G.nodes) {
+		m_excess[v->index()] = supply[v];
+		if (warmDual) {
+			m_price[v->index()] = static_cast<int64_t>(dual[v]) * scale;
+		}
+	}
+
+	// the flow on arc a is lowerBound + m_residual[m_mate[a]]
+	std::vector<int> pos(m_begin.begin(), m_begin.end() - 1);
+	for (edge e : G.edges) {
+		if (e->isSelfLoop()) {
+			continue;
+		}
+		const int u = e->source()->index(), v = e->target()->index();
+		const int a = pos[u]++, b = pos[v]++;
+		const int64_t lb = lowerBound[e];
+		const int64_t cap = static_cast<int64_t>(upperBound[e]) - lb;
+		int64_t x = 0;
+		if (warmFlow) {
+			x = min<int64_t>(max<int64_t>(flow[e] - lb, 0), cap);
+		}
+
+		m_head[a] = v;
+		m_mate[a] = b;
+		m_residual[a] = cap - x;
+		m_cost[a] = static_cast<int64_t>(cost[e]) * scale;
+		m_head[b] = u;
+		m_mate[b] = a;
+		m_residual[b] = x;
+		m_cost[b] = -m_cost[a];
+		m_forward[e->index()] = a;
+
+		m_excess[u] -= lb + x;
+		m_excess[v] += lb + x;
+	}
+
+	// The starting solution is eps-optimal. Every feasible flow is maxAbs-optimal with
+	// respect to the starting prices, which bounds the price increase in the first phase.
+	int64_t eps = 1, maxAbs = 0;
+	for (int v = 0; v < m_n; ++v) {
+		for (int a = m_begin[v]; a < m_begin[v + 1]; ++a) {
+			const int64_t c = reducedCost(v, a);
+			Math::updateMax(maxAbs, c < 0 ? -c : c);
+			if (m_residual[a] > 0) {
+				Math::updateMax(eps, -c);
+			}
+		}
+	}
+
+	m_current.resize(m_n);
+	m_queue.resize(m_n);
+
+	bool feasible = true;
+	bool first = true;
+	do {
+		eps = max<int64_t>(1, eps / c_scalingFactor);
+
+		int64_t limit = std::numeric_limits<int64_t>::max();
+		if (first && maxAbs + eps <= limit / scale) {
+			limit = (maxAbs + eps) * scale;
+		}
+		feasible = refine(eps, limit);
+		first = false;
+	} while (feasible && eps > 1);
+
+	for (edge e : G.edges) {
+		const int a = m_forward[e->index()];
+		flow[e] = lowerBound[e] + (a < 0 ? 0 : static_cast<int>(m_residual[m_mate[a]]));
+	}
+
+	if (feasible) {
+		computeDuals(scale);
+		for (node v : G.nodes) {
+			dual[v] = static_cast<TCost>(m_price[v->index()]);
+		}
+	}
+
+	return feasible;
+}
+
+template<typename TCost>
+bool MinCostFlowCostScaling<TCost>::refine(int64_t eps, int64_t limit) {
+	// saturate all arcs with negative reduced cost
+	for (int v = 0; v < m_n; ++v) {
+		for (int a = m_begin[v]; a < m_begin[v + 1]; ++a) {
+			if (m_residual[a] > 0 && reducedCost(v, a) < 0) {
+				push(a, m_residual[a]);
+			}
+		}
+	}
+
+	const std::vector<int64_t> startPrice(m_price);
+	int first = 0, size = 0;
+	for (int v = 0; v < m_n; ++v) {
+		m_current[v] = m_begin[v];
+		if (m_excess[v] > 0) {
+			m_queue[size++] = v;
+		}
+	}
+
+	while (size > 0) {
+		const int v = m_queue[first];
+		first = first + 1 == m_n ? 0 : first + 1;
+		--size;
+
+		while (m_excess[v] > 0) {
+			int& a = m_current[v];
+			for (; a < m_begin[v + 1]; ++a) {
+				if (m_residual[a] > 0 && reducedCost(v, a) < 0) {
+					const int w = m_head[a];
+					const bool wasActive = m_excess[w] > 0;
+					push(a, min(m_excess[v], m_residual[a]));
+					if (!wasActive && m_excess[w] > 0) {
+						int last = first + size;
+						m_queue[last >= m_n ? last - m_n : last] = w;
+						++size;
+					}
+					if (m_excess[v] == 0) {
+						break;
+					}
+				}
+			}
+
+			if (m_excess[v] > 0) {
+				// relabel: the cheapest residual arc gets reduced cost -eps
+				int64_t best = std::numeric_limits<int64_t>::max();
+				for (int b = m_begin[v]; b < m_begin[v + 1]; ++b) {
+					if (m_residual[b] > 0) {
+						Math::updateMin(best, m_cost[b] + m_price[m_head[b]]);
+					}
+				}
+				if (best == std::numeric_limits<int64_t>::max()
+						|| best + eps - startPrice[v] > limit) {
+					return false;
+				}
+				m_price[v] = best + eps;
+				a = m_begin[v];
+			}
+		}
+	}
+
+	return true;
+}
+
+template<typename TCost>
+void MinCostFlowCostScaling<TCost>::computeDuals(int64_t scale) {
+	// Rounding the prices down violates the dual constraints by at most one. Since the
+	// flow is optimal, the residual graph has no negative cycle and the violations are
+	// repaired by label-correcting along reverse residual arcs.
+	std::vector<char> queued(m_n, true);
+	int first = 0, size = m_n;
+	for (int v = 0; v < m_n; ++v) {
+		const int64_t p = m_price[v];
+		m_price[v] = p >= 0 ? p / scale : -((-p + scale - 1) / scale);
+		m_queue[v] = v;
+	}
+	for (int a = 0; a < (int)m_cost.size(); ++a) {
+		m_cost[a] /= scale;
+	}
+
+	while (size > 0) {
+		const int w = m_queue[first];
+		first = first + 1 == m_n ? 0 : first + 1;
+		--size;
+		queued[w] = false;
+
+		for (int b = m_begin[w]; b < m_begin[w + 1]; ++b) {
+			const int a = m_mate[b];
+			const int v = m_head[b];
+			if (m_residual[a] > 0 && m_price[v] > m_cost[a] + m_price[w]) {
+				m_price[v] = m_cost[a] + m_price[w];
+				if (!queued[v]) {
+					queued[v] = true;
+					int last = first + size;
+					m_queue[last >= m_n ? last - m_n : last] = v;
+					++size;
+				}
+			}
+		}
+	}
+}
+
+}
@@ -49,6 +49,7 @@
 #include <ogdf/graphalg/steiner_tree/FullComponentStore.h>
 #include <ogdf/graphalg/steiner_tree/SaveStatic.h>
 #include <ogdf/graphalg/steiner_tree/common_algorithms.h>
+#include <ogdf/tree/LCA.h>
 
 #include <algorithm>
 #include <memory>
@@ -74,8 +75,11 @@ namespace ogdf {
  *
  * (G. Robins, A. Zelikovsky, Improved Steiner Tree Approximation in Graphs,
  * SODA 2000, pages 770-779, SIAM, 2000)
+ *
+ * The LCA data structure used for the save calculation is chosen by \p LCAType,
+ * e.g., LCA or LCALinear.
  */
-template<typename T>
+template<typename T, typename LCAType = LCA>
 class MinSteinerTreeRZLoss : public MinSteinerTreeModule<T> {
 	int m_restricted;
 
@@ -136,10 +140,10 @@ protected:
 	}
 };
 
-template<typename T>
-class MinSteinerTreeRZLoss<T>::Main {
+template<typename T, typename LCAType>
+class MinSteinerTreeRZLoss<T, LCAType>::Main {
 	template<typename TYPE>
-	using SaveStatic = steiner_tree::SaveStatic<TYPE>;
+	using SaveStatic = steiner_tree::SaveStatic<TYPE, LCAType>;
 
 	//! \name Finding full components
 	//! @{
@@ -180,7 +184,7 @@ class MinSteinerTreeRZLoss<T>::Main {
 				&& steiner_tree::FullComponentDecisions::shouldUseErickson(m_G.numberOfNodes(),
 						m_G.numberOfEdges())) {
 			steiner_tree::constructTerminalSpanningTreeUsingVoronoiRegions(tree, m_G, m_terminals);
-			m_save.reset(new steiner_tree::SaveStatic<T>(tree));
+			m_save.reset(new steiner_tree::SaveStatic<T, LCAType>(tree));
 			findFullComponentsEMV(tree);
 		} else {
 			NodeArray<NodeArray<T>> distance;
@@ -190,7 +194,7 @@ class MinSteinerTreeRZLoss<T>::Main {
 					m_G, m_terminals, m_isTerminal, m_restricted);
 
 			generateInitialTerminalSpanningTree(tree, distance, pred);
-			m_save.reset(new steiner_tree::SaveStatic<T>(tree));
+			m_save.reset(new steiner_tree::SaveStatic<T, LCAType>(tree));
 
 			if (m_restricted >= 4) { // use Dreyfus-Wagner based full component generation
 				findFullComponentsDW(tree, distance, pred);
@@ -237,7 +241,7 @@ class MinSteinerTreeRZLoss<T>::Main {
 	const NodeArray<bool>& m_isTerminal; //!< Incidence vector for terminal nodes
 	List<node> m_terminals; //!< List of terminal nodes (will be copied and sorted)
 	int m_restricted; //!< Parameter for the number of terminals in a full component
-	std::unique_ptr<steiner_tree::SaveStatic<T>> m_save; //!< The save data structure
+	std::unique_ptr<steiner_tree::SaveStatic<T, LCAType>> m_save; //!< The save data structure
 	steiner_tree::FullComponentWithLossStore<T> m_fullCompStore; //!< All generated full components
 	NodeArray<bool> m_isNewTerminal; //!< Incidence vector for nonterminal nodes marked as terminals for improvement
 
@@ -265,9 +269,9 @@ public:
 	long numberOfComponentLookUps() { return m_componentsLookUps; }
 };
 
-template<typename T>
-MinSteinerTreeRZLoss<T>::Main::Main(const EdgeWeightedGraph<T>& G, const List<node>& terminals,
-		const NodeArray<bool>& isTerminal, int restricted)
+template<typename T, typename LCAType>
+MinSteinerTreeRZLoss<T, LCAType>::Main::Main(const EdgeWeightedGraph<T>& G,
+		const List<node>& terminals, const NodeArray<bool>& isTerminal, int restricted)
 	: m_G(G)
 	, m_isTerminal(isTerminal)
 	, m_terminals(terminals)
@@ -295,8 +299,8 @@ MinSteinerTreeRZLoss<T>::Main::Main(const EdgeWeightedGraph<T>& G, const List<no
 	m_save.reset();
 }
 
-template<typename T>
-void MinSteinerTreeRZLoss<T>::Main::generateInitialTerminalSpanningTree(
+template<typename T, typename LCAType>
+void MinSteinerTreeRZLoss<T, LCAType>::Main::generateInitialTerminalSpanningTree(
 		EdgeWeightedGraphCopy<T>& steinerTree, const NodeArray<NodeArray<T>>& distance,
 		const NodeArray<NodeArray<edge>>& pred) {
 	// generate complete graph
@@ -319,9 +323,10 @@ void MinSteinerTreeRZLoss<T>::Main::generateInitialTerminalSpanningTree(
 	OGDF_ASSERT(steinerTree.numberOfNodes() == steinerTree.numberOfEdges() + 1);
 }
 
-template<typename T>
-void MinSteinerTreeRZLoss<T>::Main::findFull3Components(const EdgeWeightedGraphCopy<T>& tree,
-		const NodeArray<NodeArray<T>>& distance, const NodeArray<NodeArray<edge>>& pred) {
+template<typename T, typename LCAType>
+void MinSteinerTreeRZLoss<T, LCAType>::Main::findFull3Components(
+		const EdgeWeightedGraphCopy<T>& tree, const NodeArray<NodeArray<T>>& distance,
+		const NodeArray<NodeArray<edge>>& pred) {
 	steiner_tree::Full3ComponentGeneratorVoronoi<T> fcg;
 	fcg.call(m_G, m_terminals, m_isTerminal, distance, pred,
 			[&](node t0, node t1, node t2, node minCenter, T minCost) {
@@ -343,9 +348,9 @@ void MinSteinerTreeRZLoss<T>::Main::findFull3Components(const EdgeWeightedGraphC
 			});
 }
 
-template<typename T>
+template<typename T, typename LCAType>
 template<typename FCG>
-void MinSteinerTreeRZLoss<T>::Main::retrieveComponents(const FCG& fcg,
+void MinSteinerTreeRZLoss<T, LCAType>::Main::retrieveComponents(const FCG& fcg,
 		const EdgeWeightedGraphCopy<T>& tree) {
 	SubsetEnumerator<node> terminalSubset(m_terminals);
 	for (terminalSubset.begin(3, m_restricted); terminalSubset.valid(); terminalSubset.next()) {
@@ -366,25 +371,27 @@ void MinSteinerTreeRZLoss<T>::Main::retrieveComponents(const FCG& fcg,
 	}
 }
 
-template<typename T>
-void MinSteinerTreeRZLoss<T>::Main::findFullComponentsDW(const EdgeWeightedGraphCopy<T>& tree,
-		const NodeArray<NodeArray<T>>& distance, const NodeArray<NodeArray<edge>>& pred) {
+template<typename T, typename LCAType>
+void MinSteinerTreeRZLoss<T, LCAType>::Main::findFullComponentsDW(
+		const EdgeWeightedGraphCopy<T>& tree, const NodeArray<NodeArray<T>>& distance,
+		const NodeArray<NodeArray<edge>>& pred) {
 	steiner_tree::FullComponentGeneratorDreyfusWagner<T> fcg(m_G, m_terminals, m_isTerminal,
 			distance, pred);
 	fcg.call(m_restricted);
 	retrieveComponents(fcg, tree);
 }
 
-template<typename T>
-void MinSteinerTreeRZLoss<T>::Main::findFullComponentsEMV(const EdgeWeightedGraphCopy<T>& tree) {
+template<typename T, typename LCAType>
+void MinSteinerTreeRZLoss<T, LCAType>::Main::findFullComponentsEMV(
+		const EdgeWeightedGraphCopy<T>& tree) {
 	steiner_tree::FullComponentGeneratorDreyfusWagnerWithoutMatrix<T> fcg(m_G, m_terminals,
 			m_isTerminal);
 	fcg.call(m_restricted);
 	retrieveComponents(fcg, tree);
 }
 
-template<typename T>
-void MinSteinerTreeRZLoss<T>::Main::multiPass(EdgeWeightedGraphCopy<T>& steinerTree) {
+template<typename T, typename LCAType>
+void MinSteinerTreeRZLoss<T, LCAType>::Main::multiPass(EdgeWeightedGraphCopy<T>& steinerTree) {
 	while (!m_fullCompStore.isEmpty()) {
 		int maxCompId;
 		double r = extractMaxComponent(steinerTree, maxCompId);
@@ -406,8 +413,8 @@ void MinSteinerTreeRZLoss<T>::Main::multiPass(EdgeWeightedGraphCopy<T>& steinerT
 	}
 }
 
-template<typename T>
-double MinSteinerTreeRZLoss<T>::Main::extractMaxComponent(
+template<typename T, typename LCAType>
+double MinSteinerTreeRZLoss<T, LCAType>::Main::extractMaxComponent(
 		const EdgeWeightedGraphCopy<T>& steinerTree, int& maxCompId) {
 	maxCompId = -1;
 	double max(0);
@@ -433,9 +440,9 @@ double MinSteinerTreeRZLoss<T>::Main::extractMaxComponent(
 	return max;
 }
 
-template<typename T>
+template<typename T, typename LCAType>
 template<typename TERMINAL_CONTAINER>
-T MinSteinerTreeRZLoss<T>::Main::gain(const TERMINAL_CONTAINER& terminals,
+T MinSteinerTreeRZLoss<T, LCAType>::Main::gain(const TERMINAL_CONTAINER& terminals,
 		const EdgeWeightedGraphCopy<T>& steinerTree) {
 	std::set<edge> saveEdges;
 	T result(0);
@@ -456,8 +463,9 @@ T MinSteinerTreeRZLoss<T>::Main::gain(const TERMINAL_CONTAINER& terminals,
 	return result;
 }
 
-template<typename T>
-void MinSteinerTreeRZLoss<T>::Main::contractLoss(EdgeWeightedGraphCopy<T>& steinerTree, int compId) {
+template<typename T, typename LCAType>
+void MinSteinerTreeRZLoss<T, LCAType>::Main::contractLoss(EdgeWeightedGraphCopy<T>& steinerTree,
+		int compId) {
 	// for every non-loss edge {st} in the component,
 	// where s belongs to the loss component of terminal u
 	//   and t belongs to the loss component of terminal v,
@@ -48,6 +48,7 @@
 #include <ogdf/graphalg/steiner_tree/SaveStatic.h>
 #include <ogdf/graphalg/steiner_tree/Triple.h>
 #include <ogdf/graphalg/steiner_tree/common_algorithms.h>
+#include <ogdf/tree/LCA.h>
 
 #include <limits>
 
@@ -76,8 +77,11 @@ class EdgeWeightedGraph;
  *
  * (A. Zelikovsky, Better approximation bound for the network and euclidean Steiner
  * tree problems, Technical Report, 2006)
+ *
+ * The LCA data structure used by the static and dynamic LCA tree save calculations is chosen
+ * by \p LCAType, e.g., LCA or LCALinear.
  */
-template<typename T>
+template<typename T, typename LCAType = LCA>
 class MinSteinerTreeZelikovsky : public MinSteinerTreeModule<T> {
 public:
 	template<typename TYPE>
@@ -411,8 +415,8 @@ private:
 	long m_tripleLookUps; //!< Number of triple lookups
 };
 
-template<typename T>
-T MinSteinerTreeZelikovsky<T>::computeSteinerTree(const EdgeWeightedGraph<T>& G,
+template<typename T, typename LCAType>
+T MinSteinerTreeZelikovsky<T, LCAType>::computeSteinerTree(const EdgeWeightedGraph<T>& G,
 		const List<node>& terminals, const NodeArray<bool>& isTerminal,
 		EdgeWeightedGraphCopy<T>*& finalSteinerTree) {
 	OGDF_ASSERT(tripleGeneration()
@@ -444,11 +448,11 @@ T MinSteinerTreeZelikovsky<T>::computeSteinerTree(const EdgeWeightedGraph<T>& G,
 			save = new steiner_tree::SaveEnum<T>(steinerTree);
 			break;
 		case SaveCalculation::staticLCATree:
-			save = new steiner_tree::SaveStatic<T>(steinerTree);
+			save = new steiner_tree::SaveStatic<T, LCAType>(steinerTree);
 			break;
 		case SaveCalculation::dynamicLCATree:
 		case SaveCalculation::hybrid:
-			save = new steiner_tree::SaveDynamic<T>(steinerTree);
+			save = new steiner_tree::SaveDynamic<T, LCAType>(steinerTree);
 			break;
 		}
 		OGDF_ASSERT(save);
@@ -480,8 +484,8 @@ T MinSteinerTreeZelikovsky<T>::computeSteinerTree(const EdgeWeightedGraph<T>& G,
 	return steiner_tree::obtainFinalSteinerTree(G, isNewTerminal, isTerminal, finalSteinerTree);
 }
 
-template<typename T>
-void MinSteinerTreeZelikovsky<T>::computeDistanceMatrix() {
+template<typename T, typename LCAType>
+void MinSteinerTreeZelikovsky<T, LCAType>::computeDistanceMatrix() {
 	if (m_ssspDistances) {
 		MinSteinerTreeModule<T>::allTerminalShortestPaths(*m_originalGraph, *m_terminals,
 				*m_isTerminal, m_distance, m_pred);
@@ -491,8 +495,9 @@ void MinSteinerTreeZelikovsky<T>::computeDistanceMatrix() {
 	}
 }
 
-template<typename T>
-void MinSteinerTreeZelikovsky<T>::tripleOnDemand(Save<T>& save, NodeArray<bool>& isNewTerminal) {
+template<typename T, typename LCAType>
+void MinSteinerTreeZelikovsky<T, LCAType>::tripleOnDemand(Save<T>& save,
+		NodeArray<bool>& isNewTerminal) {
 	Triple<T> maxTriple;
 	ArrayBuffer<node> nonterminals;
 	MinSteinerTreeModule<T>::getNonterminals(nonterminals, *m_originalGraph, *m_isTerminal);
@@ -510,8 +515,8 @@ void MinSteinerTreeZelikovsky<T>::tripleOnDemand(Save<T>& save, NodeArray<bool>&
 	} while (maxTriple.win() > 0);
 }
 
-template<typename T>
-void MinSteinerTreeZelikovsky<T>::onePass(Save<T>& save, NodeArray<bool>& isNewTerminal) {
+template<typename T, typename LCAType>
+void MinSteinerTreeZelikovsky<T, LCAType>::onePass(Save<T>& save, NodeArray<bool>& isNewTerminal) {
 	m_triples.quicksort(GenericComparer<Triple<T>, double>(
 			[](const Triple<T>& x) -> double { return -x.win(); }));
 
@@ -523,8 +528,9 @@ void MinSteinerTreeZelikovsky<T>::onePass(Save<T>& save, NodeArray<bool>& isNewT
 	}
 }
 
-template<typename T>
-void MinSteinerTreeZelikovsky<T>::multiPass(Save<T>& save, NodeArray<bool>& isNewTerminal) {
+template<typename T, typename LCAType>
+void MinSteinerTreeZelikovsky<T, LCAType>::multiPass(Save<T>& save,
+		NodeArray<bool>& isNewTerminal) {
 	double win = 0;
 	ListIterator<Triple<T>> maxTriple;
 
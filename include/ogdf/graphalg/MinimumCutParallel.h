@@ -0,0 +1,659 @@
+/** \file
+ * \brief Declaration and implementation of ogdf::MinimumCutParallel
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.md in the OGDF root directory for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, see
+ * http://www.gnu.org/copyleft/gpl.html
+ */
+
+#pragma once
+
+#include <ogdf/basic/Array.h>
+#include <ogdf/basic/ArrayBuffer.h>
+#include <ogdf/basic/Graph.h>
+#include <ogdf/basic/GraphList.h>
+#include <ogdf/basic/basic.h>
+#include <ogdf/basic/internal/parallel.h>
+#include <ogdf/graphalg/MinimumCutModule.h>
+
+#include <chrono>
+#include <limits>
+#include <queue>
+#include <utility>
+#include <vector>
+
+namespace ogdf {
+
+/**
+ * Computes an exact minimum cut of a graph by parallel contraction.
+ *
+ * @ingroup ga-cut
+ *
+ * The algorithm follows the shared-memory approach of Henzinger, Noe, Schulz and Strash
+ * (2018, 2020) and works on a compact adjacency array representation of the graph:
+ *
+ * 1. Label propagation clusters densely connected nodes, the clusters are contracted and the
+ *    minimum weighted degree of each contracted graph is a cut of the input graph. This is
+ *    repeated as long as the graph shrinks notably. The contracted kernel is then solved
+ *    exactly as in step 2, which yields a good upper bound \f$\hat\lambda\f$.
+ * 2. Starting again from the input graph, edges are contracted that cannot be crossed by a cut
+ *    smaller than \f$\hat\lambda\f$: first by the Padberg-Rinaldi conditions, and if those do
+ *    not shrink the graph any more, by the connectivity certificate of a maximum adjacency
+ *    ordering (CAPFOREST, Nagamochi, Ono and Ibaraki 1994). Every contracted graph updates
+ *    \f$\hat\lambda\f$ by its minimum weighted degree.
+ *
+ * Step 1 only influences the running time, step 2 guarantees that the returned value is the
+ * exact minimum cut value. Label propagation, the Padberg-Rinaldi tests and the contractions
+ * are distributed over up to maxThreads() threads; the maximum adjacency orderings are
+ * sequential. The wall-clock time spent in each Phase is reported by seconds().
+ *
+ * Self-loops are ignored and parallel edges are merged. As for the other implementations, the
+ * value of a graph with less than two nodes is the maximal value of \p T.
+ *
+ * @tparam T The type of the edge weights
+ */
+template<typename T = double>
+class MinimumCutParallel : public MinimumCutModule<T>, public internal::MaxThreadsOption {
+public:
+	//! The phases of the algorithm whose running time is reported by seconds().
+	enum class Phase {
+		labelPropagation, //!< Clustering the graph to compute the upper bound
+		padbergRinaldi, //!< Testing the Padberg-Rinaldi conditions
+		capforest, //!< Computing maximum adjacency orderings
+		contraction //!< Building the contracted graphs
+	};
+
+	//! The number of phases.
+	static constexpr int numberOfPhases = 4;
+
+	//! Computes a minimum cut on graph \p G.
+	virtual T call(const Graph& G) override {
+		EdgeArray<T> weights(G, 1);
+		return call(G, weights);
+	}
+
+	//! Computes a minimum cut on graph \p G with non-negative \p weights on edges.
+	virtual T call(const Graph& G, const EdgeArray<T>& weights) override;
+
+	/**
+	 * Computes the edges defining the computed mincut and returns them.
+	 * When calling this method multiple times, the cut edges are only
+	 * recomputed if the main min cut algorithm has been called in between.
+	 */
+	virtual const ArrayBuffer<edge>& edges() override {
+		if (!m_cutEdges.empty() || m_graph == nullptr) {
+			return m_cutEdges;
+		}
+
+		NodeArray<bool> inPartition(*m_graph, false);
+		for (node v : m_partition) {
+			inPartition[v] = true;
+		}
+		for (node v : m_partition) {
+			for (adjEntry adj : v->adjEntries) {
+				if (!inPartition[adj->twinNode()]) {
+					m_cutEdges.push(adj->theEdge());
+				}
+			}
+		}
+		return m_cutEdges;
+	}
+
+	//! Returns a const-reference to the list of nodes belonging to one side of the bipartition.
+	virtual const ArrayBuffer<node>& nodes() override { return m_partition; }
+
+	virtual T value() const override { return m_minCut; }
+
+	//! Returns the wall-clock time in seconds that the last call spent in phase \p phase.
+	double seconds(Phase phase) const { return m_seconds[static_cast<int>(phase)]; }
+
+protected:
+	//! A weighted graph on the nodes 0, ..., n-1 stored as adjacency arrays.
+	//! Each edge is stored at both of its end nodes.
+	struct CompactGraph {
+		int n = 0; //!< The number of nodes
+		std::vector<int> offset; //!< The adjacencies of \a v are offset[v], ..., offset[v+1]-1
+		std::vector<int> target; //!< The opposite node of each adjacency
+		std::vector<T> weight; //!< The edge weight of each adjacency
+		std::vector<T> degree; //!< The weighted degree of each node
+
+		//! Returns whether the graph has no edges.
+		bool empty() const { return target.empty(); }
+	};
+
+	//! Per-thread buffers for summing up edge weights by the label of the opposite node.
+	struct Workspace {
+		std::vector<int> position; //!< The position of each label in #labels or -1
+		std::vector<int> labels; //!< The labels seen so far
+		std::vector<T> sums; //!< The summed up weight of each label in #labels
+
+		//! Prepares the workspace for labels 0, ..., \p n-1.
+		void init(int n) {
+			position.assign(n, -1);
+			labels.clear();
+			sums.clear();
+		}
+
+		//! Adds \p w to the weight of \p label.
+		void add(int label, T w) {
+			if (position[label] < 0) {
+				position[label] = static_cast<int>(labels.size());
+				labels.push_back(label);
+				sums.push_back(w);
+			} else {
+				sums[position[label]] += w;
+			}
+		}
+
+		//! Forgets all labels seen so far.
+		void clear() {
+			for (int label : labels) {
+				position[label] = -1;
+			}
+			labels.clear();
+			sums.clear();
+		}
+	};
+
+	//! Adds the time between its construction and destruction to a phase.
+	class PhaseTimer {
+		double& m_seconds;
+		std::chrono::steady_clock::time_point m_start;
+
+	public:
+		explicit PhaseTimer(double& seconds)
+			: m_seconds(seconds), m_start(std::chrono::steady_clock::now()) { }
+
+		~PhaseTimer() {
+			std::chrono::duration<double> time = std::chrono::steady_clock::now() - m_start;
+			m_seconds += time.count();
+		}
+	};
+
+	//! Number of label propagation iterations per contraction.
+	static constexpr int s_labelPropagationRounds = 2;
+
+	//! Number of consecutive nodes handed to a thread at once.
+	static constexpr int s_chunkSize = 1024;
+
+	//! Stores the value of the minimum cut
+	T m_minCut = std::numeric_limits<T>::max();
+
+	//! The input graph of the last call
+	const Graph* m_graph = nullptr;
+
+	//! Store one side of the computed bipartition.
+	ArrayBuffer<node> m_partition;
+
+	//! Store cut edges if computed.
+	ArrayBuffer<edge> m_cutEdges;
+
+	//! The running time of each phase in seconds
+	double m_seconds[numberOfPhases];
+
+	//! The node of the current contracted graph containing each input node
+	std::vector<int> m_block;
+
+	//! A copy of #m_block when the best cut so far was found
+	std::vector<int> m_bestBlock;
+
+	//! The node of the contracted graph whose trivial cut is the best cut so far
+	int m_bestNode = -1;
+
+	//! The buffers of the threads
+	std::vector<Workspace> m_workspace;
+
+	//! Returns the running time of phase \p phase.
+	double& time(Phase phase) { return m_seconds[static_cast<int>(phase)]; }
+
+	/**
+	 * Calls \p fun(begin, end, workspace) for consecutive chunks [begin, end) of [0, \p n).
+	 * The chunks are distributed over up to #m_maxThreads threads.
+	 * The chunk boundaries do not depend on the number of threads.
+	 */
+	template<typename Fun>
+	void parallelFor(int n, const Fun& fun) {
+		const unsigned int threads = internal::parallelForThreads(m_maxThreads, n, s_chunkSize);
+		if (m_workspace.size() < threads) {
+			m_workspace.resize(threads);
+		}
+		internal::parallelFor(threads, n, s_chunkSize,
+				[&](int begin, int end, unsigned int i) { fun(begin, end, m_workspace[i]); });
+	}
+
+	//! Prepares the buffers of all threads for labels 0, ..., \p n-1.
+	void initWorkspaces(int n) {
+		m_workspace.resize(m_maxThreads);
+		for (Workspace& ws : m_workspace) {
+			ws.init(n);
+		}
+	}
+
+	/**
+	 * Contracts each set of nodes of \p g with the same label into a single node.
+	 *
+	 * @param g The graph to be contracted
+	 * @param label The label of each node, which must be one of 0, ..., \p k-1
+	 * @param k The number of labels
+	 * @param result Is assigned the contracted graph, where node \a i represents label \a i
+	 */
+	void contract(const CompactGraph& g, const std::vector<int>& label, int k,
+			CompactGraph& result);
+
+	//! Computes a label for each node of \p g by label propagation and returns the number of
+	//! labels.
+	int labelPropagation(const CompactGraph& g, std::vector<int>& label);
+
+	//! Assigns a label to each node of \p g such that nodes which may be contracted according to
+	//! the Padberg-Rinaldi conditions get the same label, and returns the number of labels.
+	int padbergRinaldi(const CompactGraph& g, std::vector<int>& label);
+
+	//! Assigns a label to each node of \p g such that nodes which cannot be separated by a cut
+	//! smaller than #m_minCut according to a maximum adjacency ordering get the same label, and
+	//! returns the number of labels.
+	int capforest(const CompactGraph& g, std::vector<int>& label);
+
+	//! Replaces \p g by its contraction according to \p label and updates #m_block and the
+	//! best cut.
+	void contractAndUpdate(CompactGraph& g, const std::vector<int>& label, int k) {
+		CompactGraph contracted;
+		contract(g, label, k, contracted);
+		std::swap(g, contracted);
+
+		PhaseTimer timer(time(Phase::contraction));
+		parallelFor(static_cast<int>(m_block.size()), [&](int begin, int end, Workspace&) {
+			for (int i = begin; i < end; ++i) {
+				m_block[i] = label[m_block[i]];
+			}
+		});
+		updateBound(g);
+	}
+
+	//! Updates the best cut by the trivial cuts of \p g.
+	void updateBound(const CompactGraph& g) {
+		if (g.n < 2) {
+			return;
+		}
+		int best = -1;
+		for (int v = 0; v < g.n; ++v) {
+			if (g.degree[v] < m_minCut && (best < 0 || g.degree[v] < g.degree[best])) {
+				best = v;
+			}
+		}
+		if (best >= 0) {
+			m_minCut = g.degree[best];
+			m_bestBlock = m_block;
+			m_bestNode = best;
+		}
+	}
+
+	//! Contracts \p g until it has a single node, using only contractions that are safe with
+	//! respect to cuts smaller than #m_minCut.
+	void contractExactly(CompactGraph& g) {
+		std::vector<int> label;
+		while (g.n > 1 && !g.empty() && m_minCut > T {}) {
+			int k = padbergRinaldi(g, label);
+			if (k > g.n - max(1, g.n / 100)) {
+				k = capforest(g, label);
+			}
+			contractAndUpdate(g, label, k);
+		}
+	}
+
+	//! Returns the representative of \p v in the union-find structure \p parent.
+	static int find(std::vector<int>& parent, int v) {
+		while (parent[v] != v) {
+			parent[v] = parent[parent[v]];
+			v = parent[v];
+		}
+		return v;
+	}
+
+	//! Numbers the representatives of \p parent consecutively and stores the number of the
+	//! representative of each node in \p label. Returns the number of representatives.
+	static int compress(std::vector<int>& parent, std::vector<int>& label) {
+		const int n = static_cast<int>(parent.size());
+		label.assign(n, -1);
+		int k = 0;
+		for (int v = 0; v < n; ++v) {
+			int r = find(parent, v);
+			if (label[r] < 0) {
+				label[r] = k++;
+			}
+			label[v] = label[r];
+		}
+		return k;
+	}
+};
+
+template<typename T>
+T MinimumCutParallel<T>::call(const Graph& G, const EdgeArray<T>& weights) {
+	m_minCut = std::numeric_limits<T>::max();
+	m_graph = &G;
+	m_partition.clear();
+	m_cutEdges.clear();
+	m_bestNode = -1;
+	for (double& seconds : m_seconds) {
+		seconds = 0;
+	}
+
+	const int n = G.numberOfNodes();
+	if (n < 2) {
+		return m_minCut;
+	}
+
+	Array<node> original(n);
+	NodeArray<int> index(G);
+	CompactGraph raw;
+	{
+		PhaseTimer timer(time(Phase::contraction));
+		int i = 0;
+		for (node v : G.nodes) {
+			original[i] = v;
+			index[v] = i++;
+		}
+
+		raw.n = n;
+		raw.offset.assign(n + 1, 0);
+		for (node v : G.nodes) {
+			raw.offset[index[v] + 1] = v->degree();
+		}
+		for (int v = 0; v < n; ++v) {
+			raw.offset[v + 1] += raw.offset[v];
+		}
+		raw.target.resize(raw.offset[n]);
+		raw.weight.resize(raw.offset[n]);
+		for (node v : G.nodes) {
+			int pos = raw.offset[index[v]];
+			for (adjEntry adj : v->adjEntries) {
+				OGDF_ASSERT(weights[adj->theEdge()] >= T {});
+				raw.target[pos] = index[adj->twinNode()];
+				raw.weight[pos++] = weights[adj->theEdge()];
+			}
+		}
+	}
+	m_block.resize(n);
+	for (int v = 0; v < n; ++v) {
+		m_block[v] = v;
+	}
+	// The input may contain self-loops and parallel edges, contract() removes them.
+	CompactGraph input;
+	contract(raw, m_block, n, input);
+	raw = CompactGraph();
+	updateBound(input);
+
+	// Compute an upper bound by contracting clusters of a copy of the input.
+	CompactGraph g = input;
+	std::vector<int> label;
+	while (g.n > 2 && !g.empty() && m_minCut > T {}) {
+		int k = labelPropagation(g, label);
+		if (k < 2 || k > g.n - max(1, g.n / 10)) {
+			break;
+		}
+		contractAndUpdate(g, label, k);
+		k = padbergRinaldi(g, label);
+		if (k < g.n) {
+			contractAndUpdate(g, label, k);
+		}
+	}
+	contractExactly(g);
+
+	// Contract the input exactly with respect to the upper bound.
+	for (int v = 0; v < n; ++v) {
+		m_block[v] = v;
+	}
+	contractExactly(input);
+
+	OGDF_ASSERT(m_bestNode >= 0);
+	for (int v = 0; v < n; ++v) {
+		if (m_bestBlock[v] == m_bestNode) {
+			m_partition.push(original[v]);
+		}
+	}
+	return m_minCut;
+}
+
+template<typename T>
+void MinimumCutParallel<T>::contract(const CompactGraph& g, const std::vector<int>& label, int k,
+		CompactGraph& result) {
+	PhaseTimer timer(time(Phase::contraction));
+
+	// sort the nodes by label
+	std::vector<int> first(k + 1, 0);
+	for (int v = 0; v < g.n; ++v) {
+		++first[label[v] + 1];
+	}
+	for (int c = 0; c < k; ++c) {
+		first[c + 1] += first[c];
+	}
+	std::vector<int> members(g.n);
+	std::vector<int> fill(first.begin(), first.end() - 1);
+	for (int v = 0; v < g.n; ++v) {
+		members[fill[label[v]]++] = v;
+	}
+
+	// Sums up the weights of the edges from the members of c to each other label and calls
+	// emit(label, weight) for each of them.
+	auto aggregate = [&](int c, Workspace& ws, auto&& emit) {
+		for (int i = first[c]; i < first[c + 1]; ++i) {
+			const int v = members[i];
+			for (int j = g.offset[v]; j < g.offset[v + 1]; ++j) {
+				const int d = label[g.target[j]];
+				if (d != c) {
+					ws.add(d, g.weight[j]);
+				}
+			}
+		}
+		for (size_t i = 0; i < ws.labels.size(); ++i) {
+			emit(ws.labels[i], ws.sums[i]);
+		}
+		ws.clear();
+	};
+
+	result.n = k;
+	result.offset.assign(k + 1, 0);
+	result.degree.assign(k, T {});
+	initWorkspaces(k);
+	parallelFor(k, [&](int begin, int end, Workspace& ws) {
+		for (int c = begin; c < end; ++c) {
+			aggregate(c, ws, [&](int, T w) {
+				++result.offset[c + 1];
+				result.degree[c] += w;
+			});
+		}
+	});
+	for (int c = 0; c < k; ++c) {
+		result.offset[c + 1] += result.offset[c];
+	}
+	result.target.resize(result.offset[k]);
+	result.weight.resize(result.offset[k]);
+	parallelFor(k, [&](int begin, int end, Workspace& ws) {
+		for (int c = begin; c < end; ++c) {
+			int pos = result.offset[c];
+			aggregate(c, ws, [&](int d, T w) {
+				result.target[pos] = d;
+				result.weight[pos++] = w;
+			});
+		}
+	});
+}
+
+template<typename T>
+int MinimumCutParallel<T>::labelPropagation(const CompactGraph& g, std::vector<int>& label) {
+	PhaseTimer timer(time(Phase::labelPropagation));
+
+	std::vector<int> current(g.n);
+	for (int v = 0; v < g.n; ++v) {
+		current[v] = v;
+	}
+	std::vector<int> next(g.n);
+	initWorkspaces(g.n);
+	for (int round = 0; round < s_labelPropagationRounds; ++round) {
+		// Within a chunk, nodes see the new labels of the preceding nodes of the same chunk.
+		// This avoids that two adjacent nodes just swap their labels.
+		parallelFor(g.n, [&](int begin, int end, Workspace& ws) {
+			for (int v = begin; v < end; ++v) {
+				for (int j = g.offset[v]; j < g.offset[v + 1]; ++j) {
+					const int w = g.target[j];
+					ws.add(begin <= w && w < v ? next[w] : current[w], g.weight[j]);
+				}
+				// take the heaviest label, preferring the own label and then smaller labels on ties
+				int best = -1;
+				T bestWeight = T {};
+				for (size_t i = 0; i < ws.labels.size(); ++i) {
+					const int l = ws.labels[i];
+					const T w = ws.sums[i];
+					if (best < 0 || w > bestWeight
+							|| (w == bestWeight && best != current[v]
+									&& (l == current[v] || l < best))) {
+						best = l;
+						bestWeight = w;
+					}
+				}
+				next[v] = best < 0 ? current[v] : best;
+				ws.clear();
+			}
+		});
+		std::swap(current, next);
+	}
+
+	// number the labels consecutively
+	label.assign(g.n, -1);
+	std::vector<int> number(g.n, -1);
+	int k = 0;
+	for (int v = 0; v < g.n; ++v) {
+		int& l = number[current[v]];
+		if (l < 0) {
+			l = k++;
+		}
+		label[v] = l;
+	}
+	return k;
+}
+
+template<typename T>
+int MinimumCutParallel<T>::padbergRinaldi(const CompactGraph& g, std::vector<int>& label) {
+	PhaseTimer timer(time(Phase::padbergRinaldi));
+
+	// 1: the edge weight is at least the best cut, 2: the edge weight is at least half the
+	// smaller degree of its end nodes
+	std::vector<char> condition(g.target.size(), 0);
+	parallelFor(g.n, [&](int begin, int end, Workspace&) {
+		for (int v = begin; v < end; ++v) {
+			for (int j = g.offset[v]; j < g.offset[v + 1]; ++j) {
+				const int w = g.target[j];
+				if (v < w) {
+					const T c = g.weight[j];
+					if (c >= m_minCut) {
+						condition[j] = 1;
+					} else if (2 * c >= min(g.degree[v], g.degree[w])) {
+						condition[j] = 2;
+					}
+				}
+			}
+		}
+	});
+
+	// Contracting all edges of condition 1 is safe. Any minimum cut smaller than #m_minCut that
+	// separates the end nodes of an edge of condition 2 can be turned into one that does not by
+	// moving one end node to the other side. This only holds for all those edges at once if
+	// they form a matching.
+	std::vector<int> parent(g.n);
+	for (int v = 0; v < g.n; ++v) {
+		parent[v] = v;
+	}
+	std::vector<bool> matched(g.n, false);
+	for (int pass = 1; pass <= 2; ++pass) {
+		for (int v = 0; v < g.n; ++v) {
+			for (int j = g.offset[v]; j < g.offset[v + 1]; ++j) {
+				if (condition[j] != pass) {
+					continue;
+				}
+				const int w = g.target[j];
+				if (pass == 2) {
+					if (matched[v] || matched[w]) {
+						continue;
+					}
+					matched[v] = matched[w] = true;
+				}
+				parent[find(parent, v)] = find(parent, w);
+			}
+		}
+	}
+	return compress(parent, label);
+}
+
+template<typename T>
+int MinimumCutParallel<T>::capforest(const CompactGraph& g, std::vector<int>& label) {
+	PhaseTimer timer(time(Phase::capforest));
+
+	std::vector<int> parent(g.n);
+	for (int v = 0; v < g.n; ++v) {
+		parent[v] = v;
+	}
+	// r[v] is the weight of the edges between v and the already scanned nodes
+	std::vector<T> r(g.n, T {});
+	std::vector<bool> scanned(g.n, false);
+	std::priority_queue<std::pair<T, int>> queue;
+	int last = -1, secondToLast = -1;
+	bool contracted = false;
+	for (int s = 0; s < g.n; ++s) {
+		if (scanned[s]) {
+			continue;
+		}
+		queue.emplace(T {}, s);
+		while (!queue.empty()) {
+			const int v = queue.top().second;
+			const T rv = queue.top().first;
+			queue.pop();
+			if (scanned[v] || rv != r[v]) {
+				continue;
+			}
+			scanned[v] = true;
+			secondToLast = last;
+			last = v;
+			for (int j = g.offset[v]; j < g.offset[v + 1]; ++j) {
+				const int w = g.target[j];
+				if (!scanned[w]) {
+					r[w] += g.weight[j];
+					// r[w] is a lower bound on the connectivity of v and w
+					if (r[w] >= m_minCut) {
+						parent[find(parent, v)] = find(parent, w);
+						contracted = true;
+					}
+					queue.emplace(r[w], w);
+				}
+			}
+		}
+	}
+	// By rounding errors, r may stay slightly below the minimum degree. The last two nodes of a
+	// maximum adjacency ordering can always be contracted once the trivial cut of the last node
+	// is known [Stoer, Wagner 1997].
+	if (!contracted && secondToLast >= 0) {
+		parent[secondToLast] = last;
+	}
+	return compress(parent, label);
+}
+
+}
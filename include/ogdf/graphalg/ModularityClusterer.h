@@ -0,0 +1,169 @@
+/** \file
+ * \brief Declaration of ogdf::ModularityClusterer
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.md in the OGDF root directory for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, see
+ * http://www.gnu.org/copyleft/gpl.html
+ */
+
+#pragma once
+
+#include <ogdf/basic/Graph.h>
+#include <ogdf/basic/GraphList.h>
+#include <ogdf/basic/SList.h>
+#include <ogdf/basic/basic.h>
+#include <ogdf/basic/internal/parallel.h>
+#include <ogdf/graphalg/ClustererModule.h>
+
+#include <functional>
+#include <vector>
+
+namespace ogdf {
+class ClusterGraph;
+
+/**
+ * Hierarchical clustering by modularity maximization with the Leiden algorithm.
+ *
+ * @ingroup ga-clustering
+ *
+ * The algorithm of Traag, Waltman and van Eck (2019) repeats three steps until the clustering
+ * does not change any more:
+ *
+ * 1. Local moving: nodes move to the neighboring cluster that increases the modularity most.
+ * 2. Refinement: each cluster is split into subclusters, which are grown from single nodes
+ *    by merging only adjacent subclusters within the same cluster. Hence all subclusters are
+ *    connected.
+ * 3. Aggregation: each subcluster becomes a node of a new graph, which starts with the
+ *    clustering of step 1.
+ *
+ * The subclusters of the successive aggregation levels are nested in each other and in the
+ * final clusters. createClusterGraph() and computeClustering() turn this into a cluster
+ * hierarchy whose top level contains the final clusters. Clusters consisting of a single node or
+ * of the same nodes as their parent are omitted.
+ *
+ * Local moving evaluates the moves of many nodes against the same state on up to maxThreads()
+ * threads and applies them afterwards; the clusters are refined in parallel, too. The result
+ * does not depend on the number of threads.
+ *
+ * The clustering is computed on first use and reused by all methods until the graph, the edge
+ * weights or the resolution change. Modifications of the graph are detected automatically, but
+ * after changing the values of the edge weight array, setEdgeWeights() has to be called again.
+ */
+class OGDF_EXPORT ModularityClusterer : public ClustererModule, public internal::MaxThreadsOption {
+public:
+	//! Constructor taking a graph \p G to be clustered.
+	explicit ModularityClusterer(const Graph& G);
+
+	//! Default constructor allowing to cluster multiple graphs with the same instance.
+	ModularityClusterer();
+
+	virtual ~ModularityClusterer() { }
+
+	virtual void computeClustering(SList<SimpleCluster*>& sl) override;
+
+	virtual void createClusterGraph(ClusterGraph& C) override;
+
+	//! Returns the fraction of the edge weight at \p v that stays within the cluster of \p v.
+	virtual double computeCIndex(node v) override { return computeCIndex(*m_pGraph, v); }
+
+	//! Returns the fraction of the edge weight at \p v that stays within the cluster of \p v.
+	//! \pre \p G is the graph to be clustered.
+	virtual double computeCIndex(const Graph& G, node v) override;
+
+	//! Sets the edge weights; all edges have weight 1 if \p weights is \c nullptr.
+	//! The weights have to be non-negative and must stay valid while the clusterer is used.
+	void setEdgeWeights(const EdgeArray<double>* weights) {
+		m_weights = weights;
+		m_computed = false;
+	}
+
+	//! Returns the resolution parameter, larger values result in smaller clusters.
+	double resolution() const { return m_resolution; }
+
+	//! Sets the resolution parameter to \p gamma > 0.
+	void resolution(double gamma) {
+		OGDF_ASSERT(gamma > 0);
+		m_resolution = gamma;
+		m_computed = false;
+	}
+
+	//! Computes the clustering if necessary and returns the top-level cluster of each node.
+	const NodeArray<int>& clusters();
+
+	//! Computes the clustering if necessary and returns the number of top-level clusters.
+	int numberOfClusters();
+
+	//! Computes the clustering if necessary and returns its modularity.
+	double modularity();
+
+protected:
+	//! Invalidates the computed clustering when the observed graph changes.
+	class ChangeObserver : public GraphObserver {
+		bool& m_computed;
+
+	public:
+		explicit ChangeObserver(bool& computed) : m_computed(computed) { }
+
+		void nodeDeleted(node) override { m_computed = false; }
+
+		void nodeAdded(node) override { m_computed = false; }
+
+		void edgeDeleted(edge) override { m_computed = false; }
+
+		void edgeAdded(edge) override { m_computed = false; }
+
+		void cleared() override { m_computed = false; }
+
+		void registrationChanged(const Graph*) override { m_computed = false; }
+	};
+
+	//! Computes the clustering of #m_pGraph unless it is still valid.
+	void compute();
+
+	/**
+	 * Walks the cluster hierarchy top-down and calls \p createCluster(\a members, \a parent)
+	 * for each cluster to be created, where \a members are the node indices of the cluster and
+	 * \a parent is the id of its parent cluster (0 for the root). The callback returns the id of
+	 * the new cluster, ids are consecutive starting at 1.
+	 *
+	 * @return the id of the innermost cluster of each node (by index in the node list).
+	 */
+	std::vector<int> buildHierarchy(
+			const std::function<int(const std::vector<int>&, int)>& createCluster) const;
+
+	const EdgeArray<double>* m_weights = nullptr; //!< The edge weights or \c nullptr
+	double m_resolution = 1.0; //!< The resolution parameter
+
+	bool m_computed = false; //!< Whether the following members are valid for #m_changes
+	ChangeObserver m_changes {m_computed}; //!< Observes the graph the following members belong to
+	NodeArray<int> m_cluster; //!< The top-level cluster of each node
+	int m_numberOfClusters = 0; //!< The number of top-level clusters
+	double m_modularity = 0; //!< The modularity of the top-level clustering
+
+	//! The subcluster of each node (by index in the node list) on each aggregation level,
+	//! from the finest to the coarsest level.
+	std::vector<std::vector<int>> m_levels;
+};
+
+}
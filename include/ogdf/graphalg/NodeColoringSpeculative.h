@@ -0,0 +1,68 @@
+/** \file
+ * \brief Parallel speculative greedy node coloring.
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.md in the OGDF root directory for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, see
+ * http://www.gnu.org/copyleft/gpl.html
+ */
+
+#pragma once
+
+#include <ogdf/basic/Graph.h>
+#include <ogdf/basic/basic.h>
+#include <ogdf/basic/internal/parallel.h>
+#include <ogdf/graphalg/NodeColoringModule.h>
+
+namespace ogdf {
+
+/**
+ * Approximation algorithms for the node coloring problem in graphs.
+ * This class colors the nodes greedily in parallel by the speculative scheme of
+ * Gebremedhin and Manne.
+ *
+ * The nodes are processed by decreasing degree. In each round, the threads assign to all
+ * uncolored nodes the smallest color not used by a neighbor, reading the colors of the
+ * neighbors while other threads may change them. Afterwards, of two adjacent nodes with the
+ * same color, the node processed later is uncolored again and recolored in the next round.
+ * The forbidden colors of a node are collected in a bit set of one machine word for nodes of
+ * small degree and in a per-thread bit set scanned with SSE instructions otherwise.
+ *
+ * With a single thread, this is the sequential coloring algorithm processing the nodes by
+ * decreasing degree. With several threads, the resulting coloring may vary between calls.
+ */
+class OGDF_EXPORT NodeColoringSpeculative : public NodeColoringModule,
+											public internal::MaxThreadsOption {
+public:
+	NodeColoringSpeculative() = default;
+
+	virtual NodeColor call(const Graph& graph, NodeArray<NodeColor>& colors,
+			NodeColor start = 0) override;
+
+	//! Returns the number of rounds the last call needed to resolve all conflicts.
+	int rounds() const { return m_rounds; }
+
+private:
+	int m_rounds = 0; //!< The number of rounds of the last call
+};
+}
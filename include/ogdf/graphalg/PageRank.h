@@ -1,5 +1,5 @@
 /** \file
- * \brief Declaration of basic page rank.
+ * \brief Declaration of basic page rank and of the PageRank engine.
  *
  * \author Martin Gronemann
  *
@@ -31,7 +31,13 @@
 
 #pragma once
 
+#include <ogdf/basic/ArrayBuffer.h>
 #include <ogdf/basic/Graph.h>
+#include <ogdf/basic/basic.h>
+#include <ogdf/basic/internal/parallel.h>
+
+#include <utility>
+#include <vector>
 
 namespace ogdf {
 
@@ -86,4 +92,164 @@ private:
 	double m_threshold;
 };
 
+//! PageRank engine with parallel, personalized and incremental computation.
+/**
+ * @ingroup graph-algs
+ *
+ * The constructor copies the graph into flat arrays of incoming and outgoing
+ * arcs, whose weights are normalized by the total weight leaving their tail.
+ * Internally, the engine solves the linear system
+ * \f$ y = (1 - d) \mathbf{1} + d P^T y \f$,
+ * where \f$ d \f$ is the damping factor and the rows of \f$ P \f$ belonging
+ * to nodes without outgoing arcs (dangling nodes) are zero. The PageRank
+ * vector, in which dangling nodes jump to a random node, is \f$ y \f$
+ * normalized to sum 1; this is what score() returns.
+ *
+ * - compute() iterates until the relative change (in the 1-norm) drops below
+ *   the tolerance. The Jacobi iteration computes all new values from the
+ *   previous ones. The Gauss-Seidel iteration uses new values as soon as they
+ *   are known and needs fewer iterations: every thread sweeps its range of
+ *   nodes in place and reads the nodes of other threads from the previous
+ *   sweep. Both pull the values along incoming arcs, so threads never write
+ *   to the same memory. If scores are known from a previous run, they are
+ *   the starting point.
+ * - update() re-reads the graph after edges (or nodes) were added or removed.
+ *   Only the nodes whose incoming arcs changed get a residual, which is then
+ *   pushed along outgoing arcs until it is below the tolerance everywhere.
+ *   For small changes, this touches only a small part of the graph.
+ * - personalized() computes the personalized PageRank of a single node by
+ *   the push algorithm of Andersen, Chung and Lang, which only touches the
+ *   nodes with a significant score.
+ *
+ * <H3>Optional parameters</H3>
+ *
+ * <table>
+ *   <tr>
+ *     <th><i>Option</i><th><i>Type</i><th><i>Default</i><th><i>Description</i>
+ *   </tr><tr>
+ *     <td><i>dampingFactor</i><td>double<td>0.85
+ *     <td>The probability of following an arc instead of jumping.
+ *   </tr><tr>
+ *     <td><i>tolerance</i><td>double<td>1e-10
+ *     <td>The relative error at which compute() and update() stop.
+ *   </tr><tr>
+ *     <td><i>maxIterations</i><td>int<td>1000
+ *     <td>The maximal number of iterations of compute().
+ *   </tr><tr>
+ *     <td><i>method</i><td>Method<td>Method::GaussSeidel
+ *     <td>The iteration used by compute().
+ *   </tr><tr>
+ *     <td><i>maxThreads</i><td>int<td>System::numberOfProcessors()
+ *     <td>The maximal number of threads used by compute(). At most one thread is
+ *     used per #c_minArcsPerThread arcs.
+ *   </tr>
+ * </table>
+ */
+class OGDF_EXPORT PageRank : public internal::MaxThreadsOption {
+public:
+	//! The iteration used by compute().
+	enum class Method {
+		Jacobi, //!< Power iteration; new values are computed from the old ones only.
+		GaussSeidel //!< New values are used as soon as they are computed.
+	};
+
+	//! The minimal number of arcs per thread.
+	static constexpr int c_minArcsPerThread = 1 << 14;
+
+	/**
+	 * Creates an engine for \p G.
+	 *
+	 * @param G is the graph.
+	 * @param weight are positive edge weights; if nullptr, all weights are 1.
+	 *        The array must be kept alive while the engine is used.
+	 * @param directed is true iff edges point from source to target;
+	 *        otherwise, every edge is used in both directions.
+	 */
+	explicit PageRank(const Graph& G, const EdgeArray<double>* weight = nullptr,
+			bool directed = true);
+
+	//! Computes the PageRank of all nodes and returns the number of iterations.
+	int compute();
+
+	//! Updates the scores after edges or nodes of the graph were added or removed.
+	/**
+	 * If no scores have been computed, this only re-reads the graph.
+	 * Returns the number of performed push operations.
+	 */
+	int update();
+
+	//! Returns the PageRank of \p v; the scores of all nodes sum to 1.
+	double score(node v) const {
+		OGDF_ASSERT(v->graphOf() == &m_G);
+		return m_sum > 0 ? m_rank[v->index()] / m_sum : 0;
+	}
+
+	//! Assigns the PageRank of all nodes to \p result.
+	void scores(NodeArray<double>& result) const;
+
+	//! Computes the personalized PageRank of \p s.
+	/**
+	 * The computation stops when every node \a u keeps a residual of at most
+	 * \p epsilon times the outdegree of \a u. The scores sum to 1.
+	 *
+	 * @param s is the node all random jumps go to.
+	 * @param result is assigned all nodes with positive score and their
+	 *        scores, in decreasing order of scores.
+	 * @param epsilon is the tolerance.
+	 */
+	void personalized(node s, ArrayBuffer<std::pair<node, double>>& result,
+			double epsilon = 1e-7) const;
+
+	//! Returns the damping factor.
+	double dampingFactor() const { return m_dampingFactor; }
+
+	//! Sets the damping factor to \p d; this discards the computed scores.
+	void dampingFactor(double d) {
+		OGDF_ASSERT(d > 0 && d < 1);
+		m_dampingFactor = d;
+		m_rank.clear();
+		m_sum = 0;
+	}
+
+	//! Returns the tolerance.
+	double tolerance() const { return m_tolerance; }
+
+	//! Sets the tolerance to \p t.
+	void tolerance(double t) { m_tolerance = t; }
+
+	//! Returns the maximal number of iterations.
+	int maxIterations() const { return m_maxIterations; }
+
+	//! Sets the maximal number of iterations to \p n.
+	void maxIterations(int n) { m_maxIterations = n; }
+
+	//! Returns the iteration used by compute().
+	Method method() const { return m_method; }
+
+	//! Sets the iteration used by compute() to \p m.
+	void method(Method m) { m_method = m; }
+
+private:
+	const Graph& m_G;
+	const EdgeArray<double>* m_weight;
+	bool m_directed;
+
+	double m_dampingFactor = 0.85;
+	double m_tolerance = 1e-10;
+	int m_maxIterations = 1000;
+	Method m_method = Method::GaussSeidel;
+
+	int m_n = 0; //!< Size of all node arrays (maximal node index + 1).
+	std::vector<node> m_nodes; //!< Node of each index (nullptr for unused indices).
+	std::vector<int> m_outBegin, m_outHead; //!< Outgoing arcs.
+	std::vector<int> m_inBegin, m_inTail; //!< Incoming arcs.
+	std::vector<double> m_outWeight, m_inWeight; //!< Normalized arc weights.
+
+	std::vector<double> m_rank; //!< Solution y of the linear system (empty if not computed).
+	double m_sum = 0; //!< Sum of #m_rank.
+
+	//! Copies the graph into the arc arrays.
+	void readGraph();
+};
+
 }
@@ -0,0 +1,784 @@
+/** \file
+ * \brief Declaration and implementation of class PointToPointShortestPath,
+ * a query engine for shortest paths between two nodes of a static graph.
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.md in the OGDF root directory for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, see
+ * http://www.gnu.org/copyleft/gpl.html
+ */
+
+#pragma once
+
+#include <ogdf/basic/Array.h>
+#include <ogdf/basic/EpsilonTest.h>
+#include <ogdf/basic/Graph.h>
+#include <ogdf/basic/List.h>
+#include <ogdf/basic/basic.h>
+#include <ogdf/basic/heap/DaryHeap.h>
+#include <ogdf/basic/internal/parallel.h>
+
+#include <atomic>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace ogdf {
+
+//! Engine for repeated shortest path queries between two nodes of a static graph.
+/**
+ * @ingroup ga-sp
+ *
+ * The engine copies the graph and its edge weights into flat arrays once.
+ * Afterwards, any number of point-to-point queries can be answered with one
+ * of the following algorithms:
+ *   - Algorithm::Bidirectional: bidirectional %Dijkstra, alternating between
+ *     a forward search from the source and a backward search from the target.
+ *   - Algorithm::ALT: A* search whose lower bounds are derived from the
+ *     distances to and from a set of landmarks via the triangle inequality
+ *     (Goldberg and Harrelson). Requires computeLandmarks(); the landmark
+ *     distances are computed in parallel.
+ *   - Algorithm::CH: bidirectional upward search in a contraction hierarchy
+ *     (Geisberger et al.). Requires contract().
+ *
+ * All query state lives in a Workspace. Its arrays are allocated once and
+ * only the entries touched by the previous query are reset, so a query costs
+ * time proportional to the explored part of the graph rather than to the
+ * number of nodes. Queries are const, hence different threads may query the
+ * same engine concurrently as long as each thread uses its own Workspace.
+ * Preprocessing (computeLandmarks(), contract()) must not run concurrently
+ * with queries.
+ *
+ * The graph must not be modified while the engine is used. Edge weights must
+ * be non-negative. Unreachable targets have distance
+ * <tt>std::numeric_limits<T>::max()</tt>.
+ *
+ * <H3>Optional parameters</H3>
+ *
+ * <table>
+ *   <tr>
+ *     <th><i>Option</i><th><i>Type</i><th><i>Default</i><th><i>Description</i>
+ *   </tr><tr>
+ *     <td><i>maxThreads</i><td>int<td>System::numberOfProcessors()
+ *     <td>The maximal number of threads used for computing landmark distances.
+ *   </tr>
+ * </table>
+ *
+ * @tparam T The type of edge weights.
+ */
+template<typename T>
+class PointToPointShortestPath : public internal::MaxThreadsOption {
+	//! Compares heap entries by their key.
+	struct EntryLess {
+		bool operator()(const std::pair<T, int>& a, const std::pair<T, int>& b) const {
+			return a.first < b.first;
+		}
+	};
+
+	//! State of a single (forward or backward) search.
+	struct Search {
+		std::vector<T> distance; //!< Tentative distances (infinity() if untouched).
+		std::vector<int> pred; //!< Arc used to reach a node (-1 if none).
+		std::vector<int*> handle; //!< Heap handles (nullptr if not in the heap).
+		std::vector<int> touched; //!< Nodes whose distance is not infinity().
+		DaryHeap<std::pair<T, int>, EntryLess> heap;
+
+		void init(int n) {
+			distance.assign(n, infinity());
+			pred.assign(n, -1);
+			handle.assign(n, nullptr);
+			touched.clear();
+			heap.clear();
+		}
+
+		//! Resets all touched entries.
+		void reset() {
+			for (int v : touched) {
+				distance[v] = infinity();
+				pred[v] = -1;
+				handle[v] = nullptr;
+			}
+			touched.clear();
+			heap.clear();
+		}
+
+		bool empty() const { return heap.empty(); }
+
+		T topKey() const { return heap.top().first; }
+
+		int pop() {
+			int v = heap.top().second;
+			heap.pop();
+			handle[v] = nullptr;
+			return v;
+		}
+
+		//! Sets the distance of \p v to \p d via \p arc and (re)inserts it with \p key.
+		void update(int v, T d, int arc, T key) {
+			if (distance[v] == infinity()) {
+				touched.push_back(v);
+			}
+			distance[v] = d;
+			pred[v] = arc;
+			if (handle[v] == nullptr) {
+				handle[v] = heap.push({key, v});
+			} else {
+				heap.decrease(handle[v], {key, v});
+			}
+		}
+	};
+
+	//! An arc of the flat adjacency arrays.
+	struct Arc {
+		int from; //!< The node whose adjacency contains the arc.
+		int to; //!< The node reached via the arc.
+		T weight;
+		edge original; //!< The corresponding edge of the graph.
+	};
+
+	//! An arc of the contraction hierarchy, i.e., an edge or a shortcut.
+	struct HierarchyArc {
+		int tail;
+		int head;
+		T weight;
+		edge original; //!< The corresponding edge (nullptr for shortcuts).
+		int first; //!< First arc bypassed by a shortcut.
+		int second; //!< Second arc bypassed by a shortcut.
+	};
+
+public:
+	//! The algorithms for answering queries.
+	enum class Algorithm {
+		Bidirectional, //!< Bidirectional %Dijkstra.
+		ALT, //!< A* search with landmark lower bounds.
+		CH, //!< Bidirectional search in the contraction hierarchy.
+	};
+
+	//! The query state of one thread.
+	class Workspace {
+		friend class PointToPointShortestPath<T>;
+
+		Search m_forward;
+		Search m_backward;
+
+	public:
+		//! Creates a workspace for queries of \p engine.
+		explicit Workspace(const PointToPointShortestPath<T>& engine) {
+			m_forward.init(engine.m_n);
+			m_backward.init(engine.m_n);
+		}
+
+		//! Returns the number of nodes touched by the last query.
+		int numberOfTouchedNodes() const {
+			return static_cast<int>(m_forward.touched.size() + m_backward.touched.size());
+		}
+	};
+
+	//! Returns the distance of unreachable nodes.
+	static constexpr T infinity() { return std::numeric_limits<T>::max(); }
+
+	/**
+	 * Creates an engine for \p G with edge weights \p weight.
+	 *
+	 * @param G The graph; it must not be modified while the engine is used
+	 * @param weight The non-negative edge weights; they are copied
+	 * @param directed Whether edges may only be traversed from source to target
+	 * @param et The ::ogdf::EpsilonTest used for comparing distances
+	 */
+	PointToPointShortestPath(const Graph& G, const EdgeArray<T>& weight, bool directed = false,
+			const EpsilonTest& et = EpsilonTest())
+		: m_G(G), m_n(G.maxNodeIndex() + 1), m_directed(directed), m_eps(et) {
+		std::vector<int> outDegree(m_n, 0), inDegree(m_n, 0);
+		for (edge e : G.edges) {
+			OGDF_ASSERT(weight[e] >= 0);
+			++outDegree[e->source()->index()];
+			++inDegree[e->target()->index()];
+			if (!directed) {
+				++outDegree[e->target()->index()];
+				++inDegree[e->source()->index()];
+			}
+		}
+
+		auto prefixSums = [&](std::vector<int>& begin, const std::vector<int>& degree) {
+			begin.assign(m_n + 1, 0);
+			for (int v = 0; v < m_n; ++v) {
+				begin[v + 1] = begin[v] + degree[v];
+			}
+		};
+		prefixSums(m_outBegin, outDegree);
+		prefixSums(m_inBegin, inDegree);
+		m_out.resize(m_outBegin[m_n]);
+		m_in.resize(m_inBegin[m_n]);
+
+		std::vector<int> nextOut(m_outBegin.begin(), m_outBegin.end() - 1);
+		std::vector<int> nextIn(m_inBegin.begin(), m_inBegin.end() - 1);
+		auto addArc = [&](int u, int v, edge e) {
+			m_out[nextOut[u]++] = {u, v, weight[e], e};
+			m_in[nextIn[v]++] = {v, u, weight[e], e};
+		};
+		for (edge e : G.edges) {
+			int u = e->source()->index(), v = e->target()->index();
+			addArc(u, v, e);
+			if (!directed) {
+				addArc(v, u, e);
+			}
+		}
+	}
+
+	/**
+	 * Selects \p k landmarks and computes their distances.
+	 *
+	 * Landmarks are chosen greedily such that each new landmark is farthest
+	 * (in the number of edges) from the landmarks chosen so far, which spreads
+	 * them over the periphery of the graph and over all connected components.
+	 */
+	void computeLandmarks(int k) {
+		OGDF_ASSERT(k >= 0);
+		List<node> landmarks;
+		std::vector<int> hops(m_n, -1);
+		std::vector<int> queue;
+		queue.reserve(m_n);
+
+		for (int i = 0; i < k && landmarks.size() < m_G.numberOfNodes(); ++i) {
+			// the first landmark is the node farthest from an arbitrary one
+			node next = nullptr;
+			if (i == 0) {
+				hops.assign(m_n, -1);
+				breadthFirstSearch(m_G.firstNode()->index(), hops, queue);
+			}
+			int maxHops = -1;
+			for (node v : m_G.nodes) {
+				int h = hops[v->index()] < 0 ? std::numeric_limits<int>::max() : hops[v->index()];
+				if (h > maxHops) {
+					maxHops = h;
+					next = v;
+				}
+			}
+			if (maxHops == 0) {
+				break;
+			}
+
+			landmarks.pushBack(next);
+			if (i == 0) {
+				hops.assign(m_n, -1);
+			}
+			breadthFirstSearch(next->index(), hops, queue);
+		}
+
+		computeLandmarks(landmarks);
+	}
+
+	//! Uses the nodes in \p landmarks as landmarks and computes their distances in parallel.
+	void computeLandmarks(const List<node>& landmarks) {
+		m_landmarks.clear();
+		for (node v : landmarks) {
+			OGDF_ASSERT(v->graphOf() == &m_G);
+			m_landmarks.push_back(v->index());
+		}
+
+		const int k = numberOfLandmarks();
+		m_landmarkFrom.assign(static_cast<size_t>(k) * m_n, infinity());
+		m_landmarkTo.assign(m_directed ? static_cast<size_t>(k) * m_n : 0, infinity());
+
+		// one job per landmark and direction
+		const int jobs = m_directed ? 2 * k : k;
+		std::atomic<int> next(0);
+		unsigned int nThreads = max(1u, min(m_maxThreads, static_cast<unsigned int>(jobs)));
+
+		internal::runThreads(nThreads, [&](unsigned int) {
+			Search search;
+			search.init(m_n);
+			for (int j; (j = next++) < jobs;) {
+				bool forward = j < k;
+				int l = forward ? j : j - k;
+				std::vector<T>& distance = forward ? m_landmarkFrom : m_landmarkTo;
+				search.reset();
+				fullSearch(m_landmarks[l], forward, search);
+				for (int v : search.touched) {
+					distance[static_cast<size_t>(l) * m_n + v] = search.distance[v];
+				}
+			}
+		});
+	}
+
+	/**
+	 * Builds a contraction hierarchy.
+	 *
+	 * Nodes are contracted in the order of their edge difference (number of
+	 * added shortcuts minus number of removed arcs) plus the number of already
+	 * contracted neighbors, updated lazily. A shortcut is omitted if a witness
+	 * search, limited to #c_witnessSettleLimit settled nodes, finds a path that
+	 * is not longer.
+	 */
+	void contract() {
+		m_arcs.clear();
+		std::vector<std::vector<int>> out(m_n), in(m_n);
+
+		auto addArc = [&](int u, int w, T weight, edge e, int first, int second) {
+			for (int a : out[u]) {
+				HierarchyArc& arc = m_arcs[a];
+				if (arc.head == w) {
+					if (m_eps.less(weight, arc.weight)) {
+						arc = {u, w, weight, e, first, second};
+					}
+					return;
+				}
+			}
+			out[u].push_back(static_cast<int>(m_arcs.size()));
+			in[w].push_back(static_cast<int>(m_arcs.size()));
+			m_arcs.push_back({u, w, weight, e, first, second});
+		};
+		for (const Arc& arc : m_out) {
+			if (arc.from != arc.to) {
+				addArc(arc.from, arc.to, arc.weight, arc.original, -1, -1);
+			}
+		}
+
+		std::vector<char> contracted(m_n, false);
+		std::vector<int> contractedNeighbors(m_n, 0);
+		Search witness;
+		witness.init(m_n);
+
+		struct Shortcut {
+			int tail, head;
+			T weight;
+			int first, second;
+		};
+		std::vector<Shortcut> shortcuts;
+
+		// collects the shortcuts needed for contracting v and returns its priority
+		auto simulate = [&](int v) {
+			shortcuts.clear();
+			int degree = 0;
+			for (int b : out[v]) {
+				degree += !contracted[m_arcs[b].head];
+			}
+			for (int a : in[v]) {
+				const int u = m_arcs[a].tail;
+				if (contracted[u]) {
+					continue;
+				}
+				++degree;
+
+				T bound = 0;
+				for (int b : out[v]) {
+					int w = m_arcs[b].head;
+					if (!contracted[w] && w != u) {
+						bound = max(bound, m_arcs[a].weight + m_arcs[b].weight);
+					}
+				}
+				witnessSearch(u, v, bound, out, contracted, witness);
+
+				for (int b : out[v]) {
+					int w = m_arcs[b].head;
+					T via = m_arcs[a].weight + m_arcs[b].weight;
+					if (!contracted[w] && w != u && m_eps.greater(witness.distance[w], via)) {
+						shortcuts.push_back({u, w, via, a, b});
+					}
+				}
+			}
+			return static_cast<int>(shortcuts.size()) - degree + contractedNeighbors[v];
+		};
+
+		DaryHeap<std::pair<int, int>> order;
+		for (node v : m_G.nodes) {
+			order.push({simulate(v->index()), v->index()});
+		}
+
+		m_rank.assign(m_n, -1);
+		int rank = 0;
+		while (!order.empty()) {
+			int v = order.top().second;
+			order.pop();
+
+			int priority = simulate(v);
+			if (!order.empty() && priority > order.top().first) {
+				order.push({priority, v});
+				continue;
+			}
+
+			m_rank[v] = rank++;
+			contracted[v] = true;
+			for (const Shortcut& s : shortcuts) {
+				addArc(s.tail, s.head, s.weight, nullptr, s.first, s.second);
+			}
+			for (int a : out[v]) {
+				++contractedNeighbors[m_arcs[a].head];
+			}
+			for (int a : in[v]) {
+				++contractedNeighbors[m_arcs[a].tail];
+			}
+		}
+
+		// Upward arcs are scanned by the forward search at their tail, downward
+		// arcs are scanned (in reverse) by the backward search at their head.
+		std::vector<int> upDegree(m_n, 0), downDegree(m_n, 0);
+		for (const HierarchyArc& arc : m_arcs) {
+			if (m_rank[arc.head] > m_rank[arc.tail]) {
+				++upDegree[arc.tail];
+			} else {
+				++downDegree[arc.head];
+			}
+		}
+		m_upBegin.assign(m_n + 1, 0);
+		m_downBegin.assign(m_n + 1, 0);
+		for (int v = 0; v < m_n; ++v) {
+			m_upBegin[v + 1] = m_upBegin[v] + upDegree[v];
+			m_downBegin[v + 1] = m_downBegin[v] + downDegree[v];
+		}
+		m_up.resize(m_upBegin[m_n]);
+		m_down.resize(m_downBegin[m_n]);
+		std::vector<int> nextUp(m_upBegin.begin(), m_upBegin.end() - 1);
+		std::vector<int> nextDown(m_downBegin.begin(), m_downBegin.end() - 1);
+		for (int a = 0; a < static_cast<int>(m_arcs.size()); ++a) {
+			const HierarchyArc& arc = m_arcs[a];
+			if (m_rank[arc.head] > m_rank[arc.tail]) {
+				m_up[nextUp[arc.tail]++] = a;
+			} else {
+				m_down[nextDown[arc.head]++] = a;
+			}
+		}
+
+		m_hasHierarchy = true;
+	}
+
+	/**
+	 * Computes the distance from \p s to \p t.
+	 *
+	 * @param s The source node
+	 * @param t The target node
+	 * @param workspace The query state; it is reset at the beginning of the query
+	 * @param algorithm The algorithm used for the query
+	 * @param path If not nullptr, is assigned the edges of a shortest path from \p s to \p t
+	 *        (empty if there is none)
+	 * @return The length of a shortest path from \p s to \p t, or infinity() if there is none
+	 */
+	T query(node s, node t, Workspace& workspace, Algorithm algorithm = Algorithm::Bidirectional,
+			List<edge>* path = nullptr) const {
+		OGDF_ASSERT(s->graphOf() == &m_G);
+		OGDF_ASSERT(t->graphOf() == &m_G);
+		OGDF_ASSERT(static_cast<int>(workspace.m_forward.distance.size()) == m_n);
+
+		workspace.m_forward.reset();
+		workspace.m_backward.reset();
+		if (path != nullptr) {
+			path->clear();
+		}
+
+		switch (algorithm) {
+		case Algorithm::ALT:
+			OGDF_ASSERT(numberOfLandmarks() > 0);
+			return queryALT(s->index(), t->index(), workspace, path);
+		case Algorithm::CH:
+			OGDF_ASSERT(hasHierarchy());
+			return queryHierarchy(s->index(), t->index(), workspace, path);
+		default:
+			return queryBidirectional(s->index(), t->index(), workspace, path);
+		}
+	}
+
+	//! Computes the distance from \p s to \p t using a temporary workspace.
+	/**
+	 * This takes time linear in the number of nodes for allocating the
+	 * workspace; use query(node, node, Workspace&, Algorithm, List<edge>*) for
+	 * repeated queries.
+	 */
+	T query(node s, node t, Algorithm algorithm = Algorithm::Bidirectional,
+			List<edge>* path = nullptr) const {
+		Workspace workspace(*this);
+		return query(s, t, workspace, algorithm, path);
+	}
+
+	//! Returns the number of landmarks.
+	int numberOfLandmarks() const { return static_cast<int>(m_landmarks.size()); }
+
+	//! Returns true iff contract() has been called.
+	bool hasHierarchy() const { return m_hasHierarchy; }
+
+	//! Returns the number of shortcuts added by contract().
+	int numberOfShortcuts() const {
+		int count = 0;
+		for (const HierarchyArc& arc : m_arcs) {
+			count += arc.original == nullptr;
+		}
+		return count;
+	}
+
+	//! The maximal number of nodes settled by a witness search of contract().
+	static constexpr int c_witnessSettleLimit = 100;
+
+private:
+	const Graph& m_G;
+	int m_n; //!< Size of all node arrays (maximal node index + 1).
+	bool m_directed;
+	EpsilonTest m_eps;
+
+	std::vector<int> m_outBegin; //!< Start of the outgoing arcs of each node in #m_out.
+	std::vector<Arc> m_out;
+	std::vector<int> m_inBegin; //!< Start of the incoming arcs of each node in #m_in.
+	std::vector<Arc> m_in;
+
+	std::vector<int> m_landmarks;
+	std::vector<T> m_landmarkFrom; //!< Distances from the landmarks, row by row.
+	std::vector<T> m_landmarkTo; //!< Distances to the landmarks (only if directed).
+
+	bool m_hasHierarchy = false;
+	std::vector<int> m_rank; //!< Contraction order.
+	std::vector<HierarchyArc> m_arcs;
+	std::vector<int> m_upBegin;
+	std::vector<int> m_up; //!< Arcs to higher ranked nodes, grouped by tail.
+	std::vector<int> m_downBegin;
+	std::vector<int> m_down; //!< Arcs from higher ranked nodes, grouped by head.
+
+	//! Returns true iff \p a + \p b is less than \p bound, avoiding overflows.
+	bool sumLess(T a, T b, T bound) const { return b < bound && m_eps.less(a, bound - b); }
+
+	//! Runs an unbounded forward or backward search from \p s.
+	void fullSearch(int s, bool forward, Search& search) const {
+		const std::vector<int>& begin = forward ? m_outBegin : m_inBegin;
+		const std::vector<Arc>& arcs = forward ? m_out : m_in;
+
+		search.update(s, 0, -1, 0);
+		while (!search.empty()) {
+			int v = search.pop();
+			for (int i = begin[v]; i < begin[v + 1]; ++i) {
+				T d = search.distance[v] + arcs[i].weight;
+				if (m_eps.less(d, search.distance[arcs[i].to])) {
+					search.update(arcs[i].to, d, i, d);
+				}
+			}
+		}
+	}
+
+	//! Computes hop distances from \p s, ignoring edge directions and already reached nodes.
+	void breadthFirstSearch(int s, std::vector<int>& hops, std::vector<int>& queue) const {
+		queue.clear();
+		queue.push_back(s);
+		hops[s] = 0;
+		for (size_t i = 0; i < queue.size(); ++i) {
+			int v = queue[i];
+			auto visit = [&](const Arc& arc) {
+				if (hops[arc.to] < 0 || hops[arc.to] > hops[v] + 1) {
+					hops[arc.to] = hops[v] + 1;
+					queue.push_back(arc.to);
+				}
+			};
+			for (int j = m_outBegin[v]; j < m_outBegin[v + 1]; ++j) {
+				visit(m_out[j]);
+			}
+			for (int j = m_inBegin[v]; j < m_inBegin[v + 1]; ++j) {
+				visit(m_in[j]);
+			}
+		}
+	}
+
+	//! Returns a lower bound on the distance from \p v to \p t derived from the landmarks.
+	T lowerBound(int v, int t) const {
+		const std::vector<T>& to = m_directed ? m_landmarkTo : m_landmarkFrom;
+		T bound = 0;
+		for (int l = 0; l < numberOfLandmarks(); ++l) {
+			const size_t row = static_cast<size_t>(l) * m_n;
+			// d(v,t) >= d(l,t) - d(l,v)
+			T lt = m_landmarkFrom[row + t], lv = m_landmarkFrom[row + v];
+			if (lt != infinity() && lv != infinity() && lt > lv) {
+				bound = max(bound, lt - lv);
+			}
+			// d(v,t) >= d(v,l) - d(t,l)
+			T vl = to[row + v], tl = to[row + t];
+			if (vl != infinity() && tl != infinity() && vl > tl) {
+				bound = max(bound, vl - tl);
+			}
+		}
+		return bound;
+	}
+
+	//! Appends the edges of the path from the search root to \p v to \p path.
+	void appendPath(int v, const Search& search, const std::vector<Arc>& arcs,
+			List<edge>& path, bool reversed) const {
+		for (int a; (a = search.pred[v]) != -1; v = arcs[a].from) {
+			if (reversed) {
+				path.pushBack(arcs[a].original);
+			} else {
+				path.pushFront(arcs[a].original);
+			}
+		}
+	}
+
+	T queryBidirectional(int s, int t, Workspace& workspace, List<edge>* path) const {
+		Search& forward = workspace.m_forward;
+		Search& backward = workspace.m_backward;
+
+		forward.update(s, 0, -1, 0);
+		backward.update(t, 0, -1, 0);
+		T best = s == t ? 0 : infinity();
+		int meet = s == t ? s : -1;
+
+		while (!forward.empty() && !backward.empty()
+				&& sumLess(forward.topKey(), backward.topKey(), best)) {
+			const bool isForward = forward.topKey() <= backward.topKey();
+			Search& search = isForward ? forward : backward;
+			const Search& other = isForward ? backward : forward;
+			const std::vector<int>& begin = isForward ? m_outBegin : m_inBegin;
+			const std::vector<Arc>& arcs = isForward ? m_out : m_in;
+
+			int v = search.pop();
+			for (int i = begin[v]; i < begin[v + 1]; ++i) {
+				const int w = arcs[i].to;
+				const T d = search.distance[v] + arcs[i].weight;
+				if (m_eps.less(d, search.distance[w])) {
+					search.update(w, d, i, d);
+					if (other.distance[w] != infinity() && sumLess(d, other.distance[w], best)) {
+						best = d + other.distance[w];
+						meet = w;
+					}
+				}
+			}
+		}
+
+		if (path != nullptr && meet != -1) {
+			appendPath(meet, forward, m_out, *path, false);
+			appendPath(meet, backward, m_in, *path, true);
+		}
+		return best;
+	}
+
+	T queryALT(int s, int t, Workspace& workspace, List<edge>* path) const {
+		Search& search = workspace.m_forward;
+
+		search.update(s, 0, -1, lowerBound(s, t));
+		while (!search.empty()) {
+			int v = search.pop();
+			if (v == t) {
+				break;
+			}
+
+			for (int i = m_outBegin[v]; i < m_outBegin[v + 1]; ++i) {
+				const int w = m_out[i].to;
+				const T d = search.distance[v] + m_out[i].weight;
+				if (m_eps.less(d, search.distance[w])) {
+					// a node is reinserted if it improves after being popped
+					search.update(w, d, i, d + lowerBound(w, t));
+				}
+			}
+		}
+
+		if (path != nullptr && search.distance[t] != infinity()) {
+			appendPath(t, search, m_out, *path, false);
+		}
+		return search.distance[t];
+	}
+
+	T queryHierarchy(int s, int t, Workspace& workspace, List<edge>* path) const {
+		Search& forward = workspace.m_forward;
+		Search& backward = workspace.m_backward;
+
+		forward.update(s, 0, -1, 0);
+		backward.update(t, 0, -1, 0);
+		T best = s == t ? 0 : infinity();
+		int meet = s == t ? s : -1;
+
+		// both searches only go upwards, so each continues until its queue exceeds best
+		for (;;) {
+			bool forwardActive = !forward.empty() && m_eps.less(forward.topKey(), best);
+			bool backwardActive = !backward.empty() && m_eps.less(backward.topKey(), best);
+			if (!forwardActive && !backwardActive) {
+				break;
+			}
+
+			const bool isForward = forwardActive
+					&& (!backwardActive || forward.topKey() <= backward.topKey());
+			Search& search = isForward ? forward : backward;
+			const Search& other = isForward ? backward : forward;
+			const std::vector<int>& begin = isForward ? m_upBegin : m_downBegin;
+			const std::vector<int>& arcs = isForward ? m_up : m_down;
+
+			int v = search.pop();
+			for (int i = begin[v]; i < begin[v + 1]; ++i) {
+				const HierarchyArc& arc = m_arcs[arcs[i]];
+				const int w = isForward ? arc.head : arc.tail;
+				const T d = search.distance[v] + arc.weight;
+				if (m_eps.less(d, search.distance[w])) {
+					search.update(w, d, arcs[i], d);
+					if (other.distance[w] != infinity() && sumLess(d, other.distance[w], best)) {
+						best = d + other.distance[w];
+						meet = w;
+					}
+				}
+			}
+		}
+
+		if (path != nullptr && meet != -1) {
+			std::vector<int> upward;
+			for (int v = meet, a; (a = forward.pred[v]) != -1; v = m_arcs[a].tail) {
+				upward.push_back(a);
+			}
+			for (auto it = upward.rbegin(); it != upward.rend(); ++it) {
+				unpack(*it, *path);
+			}
+			for (int v = meet, a; (a = backward.pred[v]) != -1; v = m_arcs[a].head) {
+				unpack(a, *path);
+			}
+		}
+		return best;
+	}
+
+	//! Appends the edges represented by hierarchy arc \p a to \p path.
+	void unpack(int a, List<edge>& path) const {
+		std::vector<int> stack {a};
+		while (!stack.empty()) {
+			const HierarchyArc& arc = m_arcs[stack.back()];
+			stack.pop_back();
+			if (arc.original != nullptr) {
+				path.pushBack(arc.original);
+			} else {
+				stack.push_back(arc.second);
+				stack.push_back(arc.first);
+			}
+		}
+	}
+
+	//! Runs a limited search from \p u that avoids \p v and stops beyond distance \p bound.
+	void witnessSearch(int u, int v, T bound, const std::vector<std::vector<int>>& out,
+			const std::vector<char>& contracted, Search& search) const {
+		search.reset();
+		search.update(u, 0, -1, 0);
+		for (int settled = 0; !search.empty() && settled < c_witnessSettleLimit; ++settled) {
+			if (m_eps.greater(search.topKey(), bound)) {
+				break;
+			}
+			int x = search.pop();
+			for (int a : out[x]) {
+				const HierarchyArc& arc = m_arcs[a];
+				if (contracted[arc.head] || arc.head == v) {
+					continue;
+				}
+				const T d = search.distance[x] + arc.weight;
+				if (m_eps.less(d, search.distance[arc.head])) {
+					search.update(arc.head, d, a, d);
+				}
+			}
+		}
+	}
+};
+
+}
@@ -31,6 +31,7 @@
 
 #pragma once
 
+#include <ogdf/basic/BreadthFirstSearch.h>
 #include <ogdf/basic/Graph.h>
 #include <ogdf/basic/GraphAttributes.h>
 #include <ogdf/basic/GraphList.h>
@@ -58,6 +59,8 @@ void bfs_SPAP(const Graph& G, NodeArray<NodeArray<TCost>>& distance, TCost edgeC
  * @ingroup ga-sp
  *
  * The cost of each edge are \p edgeCost and the result is stored in \p distanceArray.
+ * The search is sequential; callers running many searches on the same graph should
+ * keep a BreadthFirstSearch engine and use the overload below.
  */
 template<typename TCost>
 void bfs_SPSS(node s, const Graph& G, NodeArray<TCost>& distanceArray, TCost edgeCosts) {
@@ -81,6 +84,28 @@ void bfs_SPSS(node s, const Graph& G, NodeArray<TCost>& distanceArray, TCost edg
 	}
 }
 
+//! Computes single-source shortest paths from \p s using the breadth-first search engine \p bfs.
+/**
+ * @ingroup ga-sp
+ *
+ * The cost of each edge are \p edgeCost and the result is stored in \p distanceArray.
+ * Entries of unreachable nodes are not changed. The engine runs with its own thread
+ * setting, see BreadthFirstSearch::maxThreads().
+ */
+template<typename TCost>
+void bfs_SPSS(node s, BreadthFirstSearch& bfs, NodeArray<TCost>& distanceArray, TCost edgeCosts) {
+	bfs.run(s);
+
+	// distances are accumulated level by level, as by a sequential BFS
+	TCost d = TCost(0);
+	for (int level = 0; level < bfs.numberOfLevels(); ++level) {
+		for (int i = bfs.levelBegin(level); i < bfs.levelBegin(level + 1); ++i) {
+			distanceArray[bfs.reachedNode(i)] = d;
+		}
+		d += edgeCosts;
+	}
+}
+
 //! Computes all-pairs shortest paths in \p GA using %Dijkstra's algorithm.
 /**
  * @ingroup ga-sp
@@ -0,0 +1,134 @@
+/** \file
+ * \brief Declaration of class ShortestPathDeltaStepping, a parallel
+ * single-source shortest path algorithm.
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.md in the OGDF root directory for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, see
+ * http://www.gnu.org/copyleft/gpl.html
+ */
+
+#pragma once
+
+#include <ogdf/basic/Graph.h>
+#include <ogdf/basic/basic.h>
+#include <ogdf/basic/internal/parallel.h>
+#include <ogdf/graphalg/ShortestPathModule.h>
+
+namespace ogdf {
+
+//! Computes single-source shortest paths with the parallel delta-stepping algorithm.
+/**
+ * @ingroup ga-sp
+ *
+ * Implements delta-stepping by Meyer and Sanders. Nodes are kept in buckets
+ * of width \a delta according to their tentative distance. The buckets are
+ * processed in increasing order; the light edges (length at most \a delta)
+ * of all nodes in the current bucket are relaxed in parallel until the
+ * bucket stays empty, then the heavy edges of the removed nodes are relaxed
+ * once.
+ *
+ * Every node is owned by one thread, which alone stores its distance and
+ * bucket entries. A relaxation only appends a request to a buffer of the
+ * relaxing thread for the owner of the target node; the owners apply the
+ * requests after a barrier, so no locks or atomic operations are needed on
+ * node data.
+ *
+ * Edge lengths must be non-negative. With unit lengths and \a delta = 1,
+ * the algorithm is a level-synchronous parallel breadth-first search; see
+ * call(const Graph&, node, NodeArray<int>&, NodeArray<edge>&).
+ *
+ * The distances are the same for any number of threads, the predecessors
+ * may differ if there are several shortest paths. Unreachable nodes get
+ * distance <tt>std::numeric_limits<int>::max()</tt> and no predecessor.
+ *
+ * <H3>Optional parameters</H3>
+ *
+ * <table>
+ *   <tr>
+ *     <th><i>Option</i><th><i>Type</i><th><i>Default</i><th><i>Description</i>
+ *   </tr><tr>
+ *     <td><i>delta</i><td>int<td>0
+ *     <td>The bucket width. If 0, the rounded up average edge length is used.
+ *     The width is increased if more than #c_maxBuckets buckets would be needed.
+ *   </tr><tr>
+ *     <td><i>directed</i><td>bool<td>true
+ *     <td>Whether edges may only be traversed from source to target.
+ *   </tr><tr>
+ *     <td><i>maxThreads</i><td>int<td>System::numberOfProcessors()
+ *     <td>The maximal number of threads. At most one thread is used per
+ *     #c_minArcsPerThread arcs.
+ *   </tr>
+ * </table>
+ */
+class OGDF_EXPORT ShortestPathDeltaStepping : public ShortestPathModule,
+											  public internal::MaxThreadsOption {
+public:
+	//! The maximal number of (cyclically reused) buckets.
+	static constexpr int c_maxBuckets = 1 << 16;
+
+	//! The minimal number of arcs per thread.
+	static constexpr int c_minArcsPerThread = 1024;
+
+	ShortestPathDeltaStepping() = default;
+
+	//! Computes shortest paths from \p s with respect to \p length.
+	/**
+	 * @param G is the input graph.
+	 * @param s is the source node.
+	 * @param length are the non-negative edge lengths.
+	 * @param d is assigned the shortest path distances.
+	 * @param pi is assigned the last edge of a shortest path to each node.
+	 * @return false iff an edge has negative length; then \p d and \p pi are not changed.
+	 */
+	virtual bool call(const Graph& G, const node s, const EdgeArray<int>& length,
+			NodeArray<int>& d, NodeArray<edge>& pi) override;
+
+	//! Computes shortest paths from \p s with respect to unit edge lengths (parallel BFS).
+	void call(const Graph& G, const node s, NodeArray<int>& d, NodeArray<edge>& pi);
+
+	//! Returns the bucket width (0 for automatic).
+	int delta() const { return m_delta; }
+
+	//! Sets the bucket width to \p delta (0 for automatic).
+	void delta(int delta) {
+		OGDF_ASSERT(delta >= 0);
+		m_delta = delta;
+	}
+
+	//! Returns whether edges are directed.
+	bool directed() const { return m_directed; }
+
+	//! Sets whether edges are directed.
+	void directed(bool directed) { m_directed = directed; }
+
+private:
+	int m_delta = 0; //!< The bucket width (0 for automatic).
+	bool m_directed = true; //!< Whether edges are directed.
+
+	//! Runs delta-stepping; \p length == nullptr means unit lengths.
+	void run(const Graph& G, node s, const EdgeArray<int>* length, NodeArray<int>& d,
+			NodeArray<edge>& pi) const;
+};
+
+}
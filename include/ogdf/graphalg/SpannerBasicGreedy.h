@@ -35,10 +35,15 @@
 #include <ogdf/basic/EpsilonTest.h>
 #include <ogdf/basic/Graph.h>
 #include <ogdf/basic/GraphAttributes.h>
+#include <ogdf/basic/Math.h>
 #include <ogdf/basic/basic.h>
 #include <ogdf/graphalg/SpannerModule.h>
 
+#include <algorithm>
+#include <limits>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace ogdf {
 class GraphCopySimple;
@@ -65,7 +70,20 @@ class GraphCopySimple;
  */
 template<typename TWeight>
 class SpannerBasicGreedy : public SpannerModule<TWeight> {
-	EdgeArray<TWeight> m_spannerWeights;
+	//! The adjacency list of each spanner node (by index) as pairs of neighbor and weight.
+	std::vector<std::vector<std::pair<int, TWeight>>> m_adjacent;
+
+	/**
+	 * Workspace of the bounded bidirectional Dijkstra in distanceInSpanner(), which is reused
+	 * for all edges. Index 0 belongs to the search from the source, index 1 to the search from
+	 * the target.
+	 * @{
+	 */
+	std::vector<TWeight> m_distance[2]; //!< Tentative distances, infinity for untouched nodes
+	std::vector<int> m_touched[2]; //!< The nodes with finite #m_distance
+	std::vector<std::pair<TWeight, int>> m_heap[2]; //!< Min-heaps with outdated entries
+	//! @}
+
 	EpsilonTest m_eps;
 
 public:
@@ -87,7 +105,13 @@ private:
 	virtual void init(const GraphAttributes& GA, double stretch, GraphCopySimple& spanner,
 			EdgeArray<bool>& inSpanner) override {
 		SpannerModule<TWeight>::init(GA, stretch, spanner, inSpanner);
-		m_spannerWeights.init(spanner);
+		m_adjacent.assign(spanner.maxNodeIndex() + 1, {});
+		for (int side : {0, 1}) {
+			m_distance[side].assign(spanner.maxNodeIndex() + 1,
+					std::numeric_limits<TWeight>::max());
+			m_touched[side].clear();
+			m_heap[side].clear();
+		}
 	}
 
 	virtual typename SpannerModule<TWeight>::ReturnType execute() override {
@@ -106,8 +130,9 @@ private:
 			double maxDistance = m_stretch * weight(e);
 			double currentSpannerDistance = distanceInSpanner(u, v, maxDistance);
 			if (m_eps.greater(currentSpannerDistance, maxDistance)) {
-				edge newEdge = m_spanner->newEdge(e);
-				m_spannerWeights[newEdge] = weight(e);
+				m_spanner->newEdge(e);
+				m_adjacent[u->index()].emplace_back(v->index(), weight(e));
+				m_adjacent[v->index()].emplace_back(u->index(), weight(e));
 				(*m_inSpanner)[e] = true;
 			}
 			assertTimeLeft();
@@ -118,6 +143,75 @@ private:
 
 	OGDF_EXPORT double distanceInSpanner(node s, node t, double maxLookupDist);
 
+	/**
+	 * Returns the distance from \p s to \p t in the spanner if it is at most \p bound and
+	 * infinity otherwise. Two Dijkstra searches grow from \p s and \p t alternately until they
+	 * cannot find a shorter path anymore, so each only visits the nodes up to about half of
+	 * the distance.
+	 */
+	TWeight boundedDistance(int s, int t, TWeight bound) {
+		const TWeight infinity = std::numeric_limits<TWeight>::max();
+		auto greater = [](const std::pair<TWeight, int>& a, const std::pair<TWeight, int>& b) {
+			return a.first > b.first;
+		};
+		TWeight best = s == t ? 0 : infinity;
+		for (int side : {0, 1}) {
+			const int source = side == 0 ? s : t;
+			m_distance[side][source] = 0;
+			m_touched[side].push_back(source);
+			m_heap[side].emplace_back(0, source);
+		}
+		while (best > 0) {
+			// drop outdated entries
+			for (int side : {0, 1}) {
+				std::vector<std::pair<TWeight, int>>& heap = m_heap[side];
+				while (!heap.empty() && heap.front().first > m_distance[side][heap.front().second]) {
+					std::pop_heap(heap.begin(), heap.end(), greater);
+					heap.pop_back();
+				}
+			}
+			if (m_heap[0].empty() || m_heap[1].empty()) {
+				break;
+			}
+			const TWeight sum = m_heap[0].front().first + m_heap[1].front().first;
+			if (sum >= best || sum > bound) {
+				break;
+			}
+
+			// grow the search with the smaller radius
+			const int side = m_heap[0].front().first <= m_heap[1].front().first ? 0 : 1;
+			std::vector<TWeight>& distance = m_distance[side];
+			const std::vector<TWeight>& other = m_distance[1 - side];
+			std::pop_heap(m_heap[side].begin(), m_heap[side].end(), greater);
+			const TWeight d = m_heap[side].back().first;
+			const int v = m_heap[side].back().second;
+			m_heap[side].pop_back();
+			for (const auto& neighbor : m_adjacent[v]) {
+				const int w = neighbor.first;
+				const TWeight dw = d + neighbor.second;
+				if (dw <= bound && dw < distance[w]) {
+					if (distance[w] == infinity) {
+						m_touched[side].push_back(w);
+					}
+					distance[w] = dw;
+					m_heap[side].emplace_back(dw, w);
+					std::push_heap(m_heap[side].begin(), m_heap[side].end(), greater);
+					if (other[w] != infinity) {
+						Math::updateMin(best, dw + other[w]);
+					}
+				}
+			}
+		}
+		for (int side : {0, 1}) {
+			for (int v : m_touched[side]) {
+				m_distance[side][v] = infinity;
+			}
+			m_touched[side].clear();
+			m_heap[side].clear();
+		}
+		return best <= bound ? best : infinity;
+	}
+
 	/**
 	 * \returns the weights of an edge \p e from m_G
 	 */
@@ -32,14 +32,14 @@
 
 #pragma once
 
+#include <ogdf/basic/Array.h>
 #include <ogdf/basic/EpsilonTest.h>
 #include <ogdf/basic/Graph.h>
 #include <ogdf/basic/GraphAttributes.h>
 #include <ogdf/basic/GraphCopy.h>
 #include <ogdf/basic/GraphList.h>
-#include <ogdf/basic/GraphSets.h>
-#include <ogdf/basic/List.h>
 #include <ogdf/basic/basic.h>
+#include <ogdf/basic/internal/parallel.h>
 #include <ogdf/graphalg/SpannerIteratedWrapper.h>
 #include <ogdf/graphalg/SpannerModule.h>
 
@@ -47,6 +47,7 @@
 #include <limits>
 #include <string>
 #include <utility>
+#include <vector>
 
 namespace ogdf {
 
@@ -68,14 +69,48 @@ namespace ogdf {
  * Calculates a \f$(2k-1)\f$-spanner with size \f$\mathcal{O}(kn^{1+1/k})\f$. There are
  * no guarantees for the lightness. The \e expected runtime is \f$\mathcal{O}(km)\f$.
  *
+ * As in the distributed formulation of the algorithm, all nodes of an iteration decide
+ * simultaneously based on the clusters and edges of the previous iteration. They are processed
+ * on adjacency arrays by up to maxThreads() threads.
+ *
  * @ingroup ga-spanner
  */
 template<typename TWeight>
-class SpannerBaswanaSen : public SpannerModule<TWeight> {
-	//! The copy of GA.constGraph() to work on. Edges will be removed in each iteration.
-	GraphCopySimple m_G;
-	//! the current cluster for each iteration in phase 1 and the final cluster from phase 1 which is used in phase 2
-	NodeArray<node> m_cluster;
+class SpannerBaswanaSen : public SpannerModule<TWeight>, public internal::MaxThreadsOption {
+	//! Number of consecutive nodes handed to a thread at once.
+	static constexpr int s_chunkSize = 256;
+
+	/**
+	 * The graph as adjacency arrays: the adjacencies of node \a v are the indices
+	 * m_offset[v], ..., m_offset[v+1]-1.
+	 * @{
+	 */
+	std::vector<int> m_offset;
+	std::vector<int> m_adjNode; //!< The opposite node of each adjacency
+	std::vector<int> m_adjEdge; //!< The edge of each adjacency
+	std::vector<int> m_twin; //!< The adjacency of the same edge at the opposite node
+	//! @}
+
+	Array<edge> m_edges; //!< The original edge of each edge index
+	std::vector<TWeight> m_weight; //!< The weight of each edge index
+
+	//! Whether an adjacency was removed by its node; an edge is removed if one of its
+	//! adjacencies is removed.
+	std::vector<char> m_removed;
+
+	//! The adjacencies removed in the current iteration, which become #m_removed afterwards.
+	//! Each node only sets the flags of its own adjacencies.
+	std::vector<char> m_removedNow;
+
+	//! the current cluster center for each iteration in phase 1 and the final cluster from phase
+	//! 1 which is used in phase 2
+	std::vector<int> m_cluster;
+
+	//! The edges added to the spanner by each thread in the current round
+	Array<std::vector<int>> m_added;
+
+	//! Per-thread buffers of the least-weight adjacency to each cluster center (or -1)
+	Array<std::vector<int>> m_least;
 
 	EpsilonTest m_eps;
 
@@ -108,9 +143,49 @@ private:
 	virtual void init(const GraphAttributes& GA, double stretch, GraphCopySimple& spanner,
 			EdgeArray<bool>& inSpanner) override {
 		SpannerModule<TWeight>::init(GA, stretch, spanner, inSpanner);
-		m_G.clear();
-		m_G.init(GA.constGraph());
-		m_cluster.init(m_G);
+		const Graph& G = GA.constGraph();
+		const int n = G.numberOfNodes();
+
+		NodeArray<int> index(G);
+		int i = 0;
+		for (node v : G.nodes) {
+			index[v] = i++;
+		}
+		m_edges.init(G.numberOfEdges());
+		m_weight.resize(G.numberOfEdges());
+		EdgeArray<int> edgeIndex(G);
+		i = 0;
+		for (edge e : G.edges) {
+			m_edges[i] = e;
+			m_weight[i] = getWeight(GA, e);
+			edgeIndex[e] = i++;
+		}
+
+		m_offset.assign(n + 1, 0);
+		AdjEntryArray<int> position(G);
+		for (node v : G.nodes) {
+			m_offset[index[v] + 1] = m_offset[index[v]] + v->degree();
+			int pos = m_offset[index[v]];
+			for (adjEntry adj : v->adjEntries) {
+				position[adj] = pos++;
+			}
+		}
+		m_adjNode.resize(m_offset[n]);
+		m_adjEdge.resize(m_offset[n]);
+		m_twin.resize(m_offset[n]);
+		for (node v : G.nodes) {
+			for (adjEntry adj : v->adjEntries) {
+				m_adjNode[position[adj]] = index[adj->twinNode()];
+				m_adjEdge[position[adj]] = edgeIndex[adj->theEdge()];
+				m_twin[position[adj]] = position[adj->twin()];
+			}
+		}
+		m_removed.assign(m_offset[n], 0);
+		m_removedNow.assign(m_offset[n], 0);
+		m_cluster.resize(n);
+
+		m_added.init(m_maxThreads);
+		m_least.init(m_maxThreads);
 	}
 
 	virtual typename SpannerModule<TWeight>::ReturnType execute() override {
@@ -119,150 +194,156 @@ private:
 		return SpannerModule<TWeight>::ReturnType::Feasible;
 	}
 
-	/**
-	 * Adds \p e from \e m_G to the spanner and sets inSpanner
-	 */
-	inline void addToSpanner(edge e) {
-		m_spanner->newEdge(m_G.original(e));
-		(*m_inSpanner)[m_G.original(e)] = true;
-	}
+	//! Returns whether the edge of adjacency \p j was not removed so far.
+	bool alive(int j) const { return !m_removed[j] && !m_removed[m_twin[j]]; }
 
 	/**
-	 * \returns the weights of an edge \p e from m_G
+	 * Calls \p fun(v, thread) for all nodes \a v on up to #m_maxThreads threads and adds the
+	 * edges collected in #m_added afterwards to the spanner.
 	 */
-	inline TWeight weight(edge e) { return getWeight(*m_GA, m_G.original(e)); }
+	template<typename Fun>
+	void forAllNodes(const Fun& fun) {
+		const int n = static_cast<int>(m_cluster.size());
+		const unsigned int threads = internal::parallelForThreads(m_maxThreads, n, s_chunkSize);
+		for (unsigned int t = 0; t < threads; ++t) {
+			m_least[t].resize(n, -1);
+		}
+		internal::parallelFor(threads, n, s_chunkSize, [&](int begin, int end, unsigned int t) {
+			for (int v = begin; v < end; ++v) {
+				fun(v, t);
+			}
+		});
+
+		// both endpoints of an edge may have chosen it
+		for (std::vector<int>& added : m_added) {
+			for (int e : added) {
+				if (!(*m_inSpanner)[m_edges[e]]) {
+					m_spanner->newEdge(m_edges[e]);
+					(*m_inSpanner)[m_edges[e]] = true;
+				}
+			}
+			added.clear();
+		}
+	}
 
 	/**
 	 * Phase 1: Forming clusters
 	 */
 	void phase1() {
+		const int n = static_cast<int>(m_cluster.size());
 		// init
-		NodeSet<true> clusterCenters(m_G);
-		for (node v : m_G.nodes) {
+		std::vector<int> clusterCenters(n);
+		for (int v = 0; v < n; ++v) {
 			m_cluster[v] = v; // At the beginning each node is it's own cluster
-			clusterCenters.insert(v);
+			clusterCenters[v] = v;
 		}
-
-		// A and B will be explained below. They are created here, so they can be reused.
-		NodeArray<edge> A(m_G, nullptr);
-		NodeArray<bool> B(m_G, false);
+		std::vector<char> sampled(n, 0);
 
 		// stretch = 2k-1
 		// the stretch must be integer and uneven.
 		// => k=(stretch+1)/2
 		int k = (static_cast<int>(m_stretch) + 1) / 2;
-		const double probability = pow(m_G.numberOfNodes(), -1.0 / k);
+		const double probability = pow(n, -1.0 / k);
 		for (int iteration = 1; iteration <= k - 1; iteration++) {
 			assertTimeLeft();
 
-			NodeArray<node> oldCluster = m_cluster; // oldCluster is the cluster of iteration i-1
+			const std::vector<int> oldCluster = m_cluster; // the cluster of iteration i-1
 
 			// 1: Sample new cluster centers
-			NodeSet<true> sampledClusterCenters(m_G);
-			for (node oldCenter : clusterCenters.nodes()) {
+			std::vector<int> sampledClusterCenters;
+			for (int oldCenter : clusterCenters) {
 				if (randomDouble(0.0, 1.0) <= probability) {
-					sampledClusterCenters.insert(oldCenter);
+					sampledClusterCenters.push_back(oldCenter);
+					sampled[oldCenter] = 1;
 				}
 			}
 
 			// 2 & 3: Nearest neighbors and growing clusters
-			for (node v : m_G.nodes) {
-				if (sampledClusterCenters.isMember(oldCluster[v])) {
-					continue;
+			forAllNodes([&](int v, unsigned int thread) {
+				if (sampled[oldCluster[v]]) {
+					return;
 				}
 
 				// v is not a member of a sampled cluster, so we have to search for a nearest
 				// neighbor
 				// - v will be added to the cluster of the NN
-				// - A[x] saves the least weight edge from v to the cluster member of the cluster x
-				//   (or nullptr if there is no such edge.)
+				// - A[x] saves the least weight adjacency from v to the cluster x (or -1)
+				// - afterwards, A[x] == -2 stores that all edges to cluster x are removed
 
 				// both "min" values are with respect to sampled clusters, not for all adjacent
 				// clusters
+				std::vector<int>& A = m_least[thread];
 				TWeight minWeight = std::numeric_limits<TWeight>::max();
-				edge minEdge = nullptr;
+				int minAdj = -1;
 
-				for (adjEntry a : v->adjEntries) {
-					node center = oldCluster[a->twinNode()];
-					edge e = a->theEdge();
+				for (int j = m_offset[v]; j < m_offset[v + 1]; ++j) {
+					if (!alive(j)) {
+						continue;
+					}
+					const int center = oldCluster[m_adjNode[j]];
+					const TWeight w = m_weight[m_adjEdge[j]];
 
 					// maybe add v to a new cluster
-					if (sampledClusterCenters.isMember(center)) {
-						// twin is an element of a sampled cluster, so it is a (possible nearest)
-						// neighbor
-						if (m_eps.less(weight(e), minWeight)) {
-							m_cluster[v] = center; // this line will automatically add v to the new
-									// sampled cluster since the last assignment is
-									// done on the min edge.
-							minWeight = weight(e);
-							minEdge = e;
-						}
+					if (sampled[center] && m_eps.less(w, minWeight)) {
+						m_cluster[v] = center;
+						minWeight = w;
+						minAdj = j;
 					}
 
 					// fill A[x]
-					if (A[center] == nullptr || m_eps.less(weight(e), weight(A[center]))) {
-						A[center] = e;
+					if (A[center] < 0 || m_eps.less(w, m_weight[m_adjEdge[A[center]]])) {
+						A[center] = j;
 					}
 				}
 
-				// B[<clustercenter>] stores whether all edges to a cluster should be deleted.
-
-				// add sampled clusters (or all clusters) to v
-				for (node center : m_G.nodes) {
-					// center is only a possible center. It is a center, if A[center] != nullptr.
-					// Some possibilities:
-					// - minEdge == nullptr (case (a) in paper): v is not adjacent to any sampled cluster.
-					//   So, add every least weight edge to the spanner.
-					// - minEdge == A[center] (case (b), first part, in paper): v is adjacent to a sampled
-					//   cluster and we have the min edge here: Add it!
-					// - not minEdge, but less weight (case (b), second part, in paper): v is adjacent to a
-					//   sampled cluster. The edge to the cluster has strictly less weight than the min edge.
-					if (A[center] != nullptr
-							&& (minEdge == nullptr || minEdge == A[center]
-									|| m_eps.less(weight(A[center]), minWeight))) {
-						addToSpanner(A[center]);
-						B[center] = true;
+				// Some possibilities:
+				// - minAdj == -1 (case (a) in paper): v is not adjacent to any sampled cluster.
+				//   So, add every least weight edge to the spanner.
+				// - minAdj == A[center] (case (b), first part, in paper): v is adjacent to a
+				//   sampled cluster and we have the min edge here: Add it!
+				// - not minAdj, but less weight (case (b), second part, in paper): v is adjacent
+				//   to a sampled cluster. The edge to the cluster has strictly less weight than
+				//   the min edge.
+				for (int j = m_offset[v]; j < m_offset[v + 1]; ++j) {
+					const int center = oldCluster[m_adjNode[j]];
+					if (A[center] == j) {
+						if (minAdj < 0 || minAdj == j
+								|| m_eps.less(m_weight[m_adjEdge[j]], minWeight)) {
+							m_added[thread].push_back(m_adjEdge[j]);
+							A[center] = -2;
+						} else {
+							A[center] = -1;
+						}
 					}
-					A[center] = nullptr;
 				}
 
-#ifdef OGDF_DEBUG
-				for (node _v : m_G.nodes) {
-					OGDF_ASSERT(A[_v] == nullptr);
-				}
-#endif
-
-				// Finally, delete all edges from v indicated by B
-				ListPure<adjEntry> adjs; // copy, so we can iterate and delete.
-				v->allAdjEntries(adjs);
-				for (adjEntry a : adjs) {
-					node center = oldCluster[a->twinNode()];
-					if (B[center]) {
-						m_G.delEdge(a->theEdge());
+				// Finally, remove all edges from v indicated by A
+				for (int j = m_offset[v]; j < m_offset[v + 1]; ++j) {
+					if (A[oldCluster[m_adjNode[j]]] == -2) {
+						m_removedNow[j] = 1;
 					}
-					B[center] = false;
 				}
-
-#ifdef OGDF_DEBUG
-				for (node _v : m_G.nodes) {
-					OGDF_ASSERT(!B[_v]);
+				for (int j = m_offset[v]; j < m_offset[v + 1]; ++j) {
+					A[oldCluster[m_adjNode[j]]] = -1;
 				}
-#endif
+			});
+
+			for (size_t j = 0; j < m_removed.size(); ++j) {
+				m_removed[j] |= m_removedNow[j];
 			}
 
 			// 4: Removing intra-cluster edges
-			for (edge _e : m_GA->constGraph().edges) {
-				edge e = m_G.copy(_e);
-				if (e == nullptr) {
-					continue;
+			forAllNodes([&](int v, unsigned int) {
+				for (int j = m_offset[v]; j < m_offset[v + 1]; ++j) {
+					if (m_cluster[v] == m_cluster[m_adjNode[j]]) {
+						m_removed[j] = 1;
+					}
 				}
+			});
 
-				if (m_cluster[e->source()] == m_cluster[e->target()]) {
-					// inter-cluster connection.
-					m_G.delEdge(e);
-				}
+			for (int center : clusterCenters) {
+				sampled[center] = 0;
 			}
-
 			clusterCenters = std::move(sampledClusterCenters);
 		}
 	}
@@ -271,39 +352,29 @@ private:
 	 * Phase 2: Vertex-Cluster Joining
 	 */
 	void phase2() {
-		NodeArray<edge> A(m_G, nullptr);
-		for (node v : m_G.nodes) {
-			assertTimeLeft();
-
-			for (adjEntry a : v->adjEntries) {
-				node center = m_cluster[a->twinNode()];
-				edge e = a->theEdge();
+		assertTimeLeft();
+		forAllNodes([&](int v, unsigned int thread) {
+			std::vector<int>& A = m_least[thread];
+			for (int j = m_offset[v]; j < m_offset[v + 1]; ++j) {
+				if (!alive(j)) {
+					continue;
+				}
+				const int center = m_cluster[m_adjNode[j]];
 
 				// fill A[x]
-				if (A[center] == nullptr || weight(e) < weight(A[center])) {
-					A[center] = e;
+				if (A[center] < 0 || m_weight[m_adjEdge[j]] < m_weight[m_adjEdge[A[center]]]) {
+					A[center] = j;
 				}
 			}
 
-			for (node center : m_G.nodes) {
-				if (A[center] != nullptr) {
-					addToSpanner(A[center]);
-					A[center] = nullptr;
+			for (int j = m_offset[v]; j < m_offset[v + 1]; ++j) {
+				const int center = m_cluster[m_adjNode[j]];
+				if (A[center] == j) {
+					m_added[thread].push_back(m_adjEdge[j]);
+					A[center] = -1;
 				}
 			}
-
-			// Delete all edges from v in the original graph.
-			adjEntry a;
-			while ((a = v->firstAdj()) != nullptr) {
-				m_G.delEdge(a->theEdge());
-			}
-
-#ifdef OGDF_DEBUG
-			for (node _v : m_G.nodes) {
-				OGDF_ASSERT(A[_v] == nullptr);
-			}
-#endif
-		}
+		});
 	}
 
 	using SpannerModule<TWeight>::getWeight;
@@ -42,6 +42,7 @@
 #include <ogdf/basic/SubsetEnumerator.h>
 #include <ogdf/basic/basic.h>
 #include <ogdf/basic/extended_graph_alg.h>
+#include <ogdf/basic/internal/parallel.h>
 #include <ogdf/basic/simple_graph_alg.h>
 #include <ogdf/graphalg/Dijkstra.h>
 #include <ogdf/graphalg/MinSteinerTreeMehlhorn.h>
@@ -53,6 +54,10 @@
 #include <ogdf/graphalg/steiner_tree/HeavyPathDecomposition.h>
 
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <forward_list>
 #include <functional>
 #include <iostream>
@@ -105,10 +110,51 @@ public:
  *  - [PV01] T. Polzin, S. V. Daneshmand: Improved algorithms for the Steiner problem in networks,
  *    Discrete Applied Mathematics 112, pp. 263-300, 2001
  *
+ * The combined reduction sets (e.g. reduceFast()) apply their reductions in rounds
+ * until a fixpoint is reached. A reduction that has not changed the graph is skipped
+ * until the graph is modified again. The terminal spanning tree and the closest
+ * terminals used by the bottleneck-distance-based tests are kept until the graph
+ * changes, and the edge-local tests (longEdgesTest(), PTmTest()) evaluate their
+ * edges with up to #maxThreads threads. Per-reduction statistics are available
+ * via statistics().
+ *
  * @ingroup ga-steiner
  */
 template<typename T>
-class SteinerTreePreprocessing {
+class SteinerTreePreprocessing : public internal::MaxThreadsOption {
+public:
+	//! The single reductions, used to identify their statistics.
+	enum class Reduction {
+		leaves, //!< deleteLeaves()
+		simple, //!< makeSimple()
+		componentsWithoutTerminals, //!< deleteComponentsWithoutTerminals()
+		leastCost, //!< leastCostTest()
+		degree2, //!< degree2Test()
+		PTm, //!< PTmTest()
+		terminalDistance, //!< terminalDistanceTest()
+		longEdges, //!< longEdgesTest()
+		NTDk, //!< NTDkTest()
+		nearestVertex, //!< nearestVertexTest()
+		shortLinks, //!< shortLinksTest()
+		lowerBound, //!< lowerBoundBasedTest()
+		dualAscent, //!< dualAscentBasedTest()
+		reachability, //!< reachabilityTest()
+		cutReachability //!< cutReachabilityTest()
+	};
+
+	//! The number of values of #Reduction.
+	static constexpr int numberOfReductions = static_cast<int>(Reduction::cutReachability) + 1;
+
+	//! Statistics about the applications of one reduction.
+	struct ReductionStatistics {
+		int calls = 0; //!< Number of applications
+		int successfulCalls = 0; //!< Number of applications that changed the graph
+		int skippedCalls = 0; //!< Number of applications skipped since the graph was unchanged
+		int removedNodes = 0; //!< Net number of removed nodes
+		int removedEdges = 0; //!< Net number of removed edges
+		double seconds = 0; //!< Total wall-clock time in seconds
+	};
+
 protected:
 	const EdgeWeightedGraph<T>& m_origGraph; //!< Const reference to the original graph
 	const List<node>& m_origTerminals; //!< Const reference to the original list of terminals
@@ -134,6 +180,47 @@ protected:
 	//! Algorithm used for computing the upper bound for the cost of a minimum Steiner tree.
 	std::unique_ptr<MinSteinerTreeModule<T>> m_costUpperBoundAlgorithm;
 
+	//! Counts the modifications of a graph to detect stale auxiliary data.
+	class ModificationCounter : public GraphObserver {
+		int64_t m_count = 0;
+
+	public:
+		explicit ModificationCounter(const Graph& G) : GraphObserver(&G) { }
+
+		//! Returns the number of modifications so far.
+		int64_t count() const { return m_count; }
+
+		//! Records a modification that is not visible to the observer.
+		void touch() { ++m_count; }
+
+		void nodeDeleted(node) override { ++m_count; }
+
+		void nodeAdded(node) override { ++m_count; }
+
+		void edgeDeleted(edge) override { ++m_count; }
+
+		void edgeAdded(edge) override { ++m_count; }
+
+		void cleared() override { ++m_count; }
+	};
+
+	ModificationCounter m_modifications; //!< Modifications of #m_copyGraph
+
+	std::array<ReductionStatistics, numberOfReductions> m_statistics; //!< Statistics per reduction
+	//! For each reduction, the modification count at which it last failed to change the graph
+	std::array<int64_t, numberOfReductions> m_unchangedAt;
+	int m_activeReductions; //!< Nesting depth of currently running reductions
+
+	//! Terminal spanning tree shared by the bottleneck-distance-based tests
+	std::unique_ptr<EdgeWeightedGraphCopy<T>> m_tprime;
+	//! Heavy path decomposition of #m_tprime
+	std::unique_ptr<steiner_tree::HeavyPathDecomposition<T>> m_tprimeHPD;
+	int64_t m_tprimeState; //!< Modification count of #m_tprime
+	//! Closest terminals shared by the bottleneck-distance-based tests
+	NodeArray<List<std::pair<node, T>>> m_closestTerminals;
+	int m_closestTerminalsK; //!< Parameter k of #m_closestTerminals
+	int64_t m_closestTerminalsState; //!< Modification count of #m_closestTerminals
+
 public:
 	/*!
 	 * @param wg The initial graph that will be reduced.
@@ -219,7 +306,10 @@ public:
 	inline const List<node>& getReducedTerminals() const { return m_copyTerminals; }
 
 	//! Shuffles the list of reduced terminals. This can have an effect on some tests.
-	inline void shuffleReducedTerminals() { m_copyTerminals.permute(); }
+	inline void shuffleReducedTerminals() {
+		m_copyTerminals.permute();
+		m_modifications.touch();
+	}
 
 	//! Returns the NodeArray<bool> isTerminal corresponding to the reduced graph.
 	inline const NodeArray<bool>& getReducedIsTerminal() const { return m_copyIsTerminal; }
@@ -254,9 +344,9 @@ public:
 	bool reduceTrivial() {
 		return repeat([this]() {
 			bool changed = false;
-			changed |= degree2Test();
-			changed |= makeSimple();
-			changed |= deleteLeaves();
+			changed |= schedule(Reduction::degree2, [this] { return degree2Test(); });
+			changed |= schedule(Reduction::simple, [this] { return makeSimple(); });
+			changed |= schedule(Reduction::leaves, [this] { return deleteLeaves(); });
 			return changed;
 		});
 	}
@@ -267,38 +357,40 @@ public:
 		// comment wrt. Apple Clang 10: making k const, results in compiler error while binding it in lambda
 		// comment wrt. MSVC 19: not binding the const k would result in compiler error
 
-		bool changed = deleteComponentsWithoutTerminals();
+		bool changed = schedule(Reduction::componentsWithoutTerminals,
+				[this] { return deleteComponentsWithoutTerminals(); });
 		bool triviallyChanged = false;
 		changed |= repeat([this, &triviallyChanged, k]() {
 			bool innerChanged = false;
 			triviallyChanged = reduceTrivial();
 			// graph guaranteed to be simple and connected
 
-			if (nearestVertexTest()) {
+			if (schedule(Reduction::nearestVertex, [this] { return nearestVertexTest(); })) {
 				makeSimple();
 				innerChanged = true;
 			}
 
 			// precond: connected
-			if (terminalDistanceTest()) {
+			if (schedule(Reduction::terminalDistance, [this] { return terminalDistanceTest(); })) {
 				// can occur: disconnected
 				deleteComponentsWithoutTerminals();
 				innerChanged = true;
 			}
 
 			// precond: simple, connected
-			innerChanged |= NTDkTest(10, k);
+			innerChanged |= schedule(Reduction::NTDk, [this, k] { return NTDkTest(10, k); });
 			// can occur: parallel edges
 
 			// precond: connected
-			innerChanged |= shortLinksTest();
+			innerChanged |= schedule(Reduction::shortLinks, [this] { return shortLinksTest(); });
 			// can occur: parallel edges, self-loops
 
 			// precond: connected
-			innerChanged |= lowerBoundBasedTest();
+			innerChanged |=
+					schedule(Reduction::lowerBound, [this] { return lowerBoundBasedTest(); });
 
 			// is not thaaat good but helps a little:
-			innerChanged |= PTmTest(k);
+			innerChanged |= schedule(Reduction::PTm, [this, k] { return PTmTest(k); });
 			// can occur: parallel edges
 
 			return innerChanged;
@@ -310,7 +402,7 @@ public:
 	bool reduceFastAndDualAscent() {
 		return repeat([this] {
 			bool changed = reduceFast();
-			changed |= dualAscentBasedTest();
+			changed |= schedule(Reduction::dualAscent, [this] { return dualAscentBasedTest(); });
 			return changed;
 		});
 	}
@@ -494,8 +586,17 @@ public:
 	//! Set the module option for the algorithm used for computing the MinSteinerTree cost upper bound.
 	inline void setCostUpperBoundAlgorithm(MinSteinerTreeModule<T>* pMinSteinerTreeModule) {
 		m_costUpperBoundAlgorithm.reset(pMinSteinerTreeModule);
+		m_modifications.touch();
 	}
 
+	//! Returns the statistics of reduction \p type since construction or the last resetStatistics().
+	const ReductionStatistics& statistics(Reduction type) const {
+		return m_statistics[static_cast<int>(type)];
+	}
+
+	//! Resets the statistics of all reductions.
+	void resetStatistics() { m_statistics.fill(ReductionStatistics()); }
+
 	//! @}
 
 	//! Auxiliary function: Repeats a function until it returns false (used for iteratively applying reductions)
@@ -508,6 +609,85 @@ public:
 	}
 
 protected:
+	//! Records the statistics of the outermost running reduction.
+	class StatisticsScope {
+		SteinerTreePreprocessing<T>& m_prep;
+		ReductionStatistics* m_statistics;
+		int m_nodes;
+		int m_edges;
+		int64_t m_modifications;
+		std::chrono::steady_clock::time_point m_start;
+
+	public:
+		StatisticsScope(SteinerTreePreprocessing<T>& prep, Reduction type)
+			: m_prep(prep)
+			, m_statistics(prep.m_activeReductions++ == 0
+							? &prep.m_statistics[static_cast<int>(type)]
+							: nullptr)
+			, m_nodes(prep.m_copyGraph.numberOfNodes())
+			, m_edges(prep.m_copyGraph.numberOfEdges())
+			, m_modifications(prep.m_modifications.count())
+			, m_start(std::chrono::steady_clock::now()) { }
+
+		~StatisticsScope() {
+			--m_prep.m_activeReductions;
+			if (m_statistics != nullptr) {
+				++m_statistics->calls;
+				if (m_prep.m_modifications.count() != m_modifications) {
+					++m_statistics->successfulCalls;
+				}
+				m_statistics->removedNodes += m_nodes - m_prep.m_copyGraph.numberOfNodes();
+				m_statistics->removedEdges += m_edges - m_prep.m_copyGraph.numberOfEdges();
+				std::chrono::duration<double> time = std::chrono::steady_clock::now() - m_start;
+				m_statistics->seconds += time.count();
+			}
+		}
+	};
+
+	/*!
+	 * \brief Applies reduction \p type using \p reduce unless it has already failed
+	 * to change the current graph (all reductions are deterministic).
+	 * @return True iff the graph is changed
+	 */
+	template<typename Fun>
+	bool schedule(Reduction type, Fun reduce) {
+		int64_t& unchangedAt = m_unchangedAt[static_cast<int>(type)];
+		if (unchangedAt == m_modifications.count()) {
+			++m_statistics[static_cast<int>(type)].skippedCalls;
+			return false;
+		}
+		bool changed = reduce();
+		if (!changed) {
+			unchangedAt = m_modifications.count();
+		}
+		return changed;
+	}
+
+	/*!
+	 * \brief Deletes all edges \a e for which a test returns true.
+	 * All edges are tested on the unmodified graph, using up to #m_maxThreads threads.
+	 * @param makeTest Returns a (thread-local) test; it is called once per used thread.
+	 * @return True iff the graph is changed
+	 */
+	template<typename MakeTest>
+	bool deleteEdgesIf(MakeTest makeTest);
+
+	//! Returns the terminal spanning tree computed using Voronoi regions, recomputed if stale.
+	const EdgeWeightedGraphCopy<T>& terminalSpanningTree();
+
+	//! Returns the heavy path decomposition of terminalSpanningTree().
+	const steiner_tree::HeavyPathDecomposition<T>& terminalSpanningTreeHPD() {
+		const EdgeWeightedGraphCopy<T>& tprime = terminalSpanningTree();
+		if (!m_tprimeHPD) {
+			m_tprimeHPD.reset(new steiner_tree::HeavyPathDecomposition<T>(tprime));
+		}
+		return *m_tprimeHPD;
+	}
+
+	//! Returns the closest \p k terminals of each node (see computeClosestKTerminals()),
+	//! recomputed if stale.
+	const NodeArray<List<std::pair<node, T>>>& closestTerminals(int k);
+
 	/*!
 	 * \brief Update internal data structures to let a (new) node or edge represent replaced nodes and/or edges.
 	 * @param x The node or edge that represents the replaced entities. Note that its existing information will be overwritten.
@@ -587,9 +767,10 @@ protected:
 	 * @param distance A NodeArray where the minimum found distance is saved, infinity where no path is found.
 	 * @param maxDistance Constant such that: any distance > maxDistance is not of interest.
 	 * @param expandedEdges The maximum number of edges expanded during the computation.
+	 * @param queue An empty priority queue for the nodes of the graph; it is empty again afterwards.
 	 */
 	void findClosestNonTerminals(node source, List<node>& reachedNodes, NodeArray<T>& distance,
-			T maxDistance, int expandedEdges) const;
+			T maxDistance, int expandedEdges, PrioritizedMapQueue<node, T>& queue) const;
 
 	/**
 	 * \brief Heuristic computation [PV01] of the bottleneck Steiner distance between two nodes in a graph.
@@ -629,8 +810,17 @@ protected:
 template<typename T>
 SteinerTreePreprocessing<T>::SteinerTreePreprocessing(const EdgeWeightedGraph<T>& wg,
 		const List<node>& terminals, const NodeArray<bool>& isTerminal)
-	: m_origGraph(wg), m_origTerminals(terminals), m_origIsTerminal(isTerminal), m_eps(1e-6) {
+	: m_origGraph(wg)
+	, m_origTerminals(terminals)
+	, m_origIsTerminal(isTerminal)
+	, m_eps(1e-6)
+	, m_modifications(m_copyGraph)
+	, m_activeReductions(0)
+	, m_tprimeState(-1)
+	, m_closestTerminalsK(0)
+	, m_closestTerminalsState(-1) {
 	OGDF_ASSERT(!m_origGraph.empty());
+	m_unchangedAt.fill(-1);
 
 	// make the initial graph copy
 	m_copyGraph.clear();
@@ -796,6 +986,68 @@ void SteinerTreePreprocessing<T>::deleteSteinerDegreeTwoNode(node v,
 	m_copyGraph.delNode(v);
 }
 
+template<typename T>
+template<typename MakeTest>
+bool SteinerTreePreprocessing<T>::deleteEdgesIf(MakeTest makeTest) {
+	constexpr int chunkSize = 256;
+
+	Array<edge> edges(m_copyGraph.numberOfEdges());
+	m_copyGraph.allEdges(edges);
+	std::vector<char> toDelete(edges.size(), false);
+
+	const unsigned int threads = min(m_maxThreads,
+			static_cast<unsigned int>((edges.size() + chunkSize - 1) / chunkSize));
+	if (threads <= 1) {
+		auto test = makeTest();
+		for (int i = 0; i < edges.size(); ++i) {
+			toDelete[i] = test(edges[i]);
+		}
+	} else {
+		std::atomic<int> nextChunk(0);
+		internal::runThreads(threads, [&](unsigned int) {
+			auto test = makeTest();
+			for (int begin = nextChunk++ * chunkSize; begin < edges.size();
+					begin = nextChunk++ * chunkSize) {
+				const int end = min(begin + chunkSize, edges.size());
+				for (int i = begin; i < end; ++i) {
+					toDelete[i] = test(edges[i]);
+				}
+			}
+		});
+	}
+
+	bool changed = false;
+	for (int i = 0; i < edges.size(); ++i) {
+		if (toDelete[i]) {
+			m_copyGraph.delEdge(edges[i]);
+			changed = true;
+		}
+	}
+	return changed;
+}
+
+template<typename T>
+const EdgeWeightedGraphCopy<T>& SteinerTreePreprocessing<T>::terminalSpanningTree() {
+	if (m_tprimeState != m_modifications.count()) {
+		m_tprimeHPD.reset();
+		m_tprime.reset(new EdgeWeightedGraphCopy<T>);
+		steiner_tree::constructTerminalSpanningTreeUsingVoronoiRegions(*m_tprime, m_copyGraph,
+				m_copyTerminals);
+		m_tprimeState = m_modifications.count();
+	}
+	return *m_tprime;
+}
+
+template<typename T>
+const NodeArray<List<std::pair<node, T>>>& SteinerTreePreprocessing<T>::closestTerminals(int k) {
+	if (m_closestTerminalsState != m_modifications.count() || m_closestTerminalsK != k) {
+		computeClosestKTerminals(k, m_closestTerminals);
+		m_closestTerminalsK = k;
+		m_closestTerminalsState = m_modifications.count();
+	}
+	return m_closestTerminals;
+}
+
 template<typename T>
 void SteinerTreePreprocessing<T>::recomputeTerminalsList() {
 	m_copyTerminals.clear();
@@ -832,6 +1084,7 @@ T SteinerTreePreprocessing<T>::computeBottleneckDistance(node x, node y,
 
 template<typename T>
 bool SteinerTreePreprocessing<T>::deleteLeaves() {
+	StatisticsScope scope(*this, Reduction::leaves);
 	// exceptional case: only one terminal
 	auto deleteAll = [this]() {
 		if (m_copyGraph.numberOfNodes() > 1) {
@@ -904,6 +1157,7 @@ bool SteinerTreePreprocessing<T>::deleteLeaves() {
 
 template<typename T>
 bool SteinerTreePreprocessing<T>::makeSimple() {
+	StatisticsScope scope(*this, Reduction::simple);
 	bool changed = false;
 	NodeArray<edge> minCostEdge(m_copyGraph, nullptr);
 	for (node v : m_copyGraph.nodes) {
@@ -978,6 +1232,7 @@ inline void SteinerTreePreprocessing<T>::computeShortestPathMatrix(
 
 template<typename T>
 bool SteinerTreePreprocessing<T>::leastCostTest() {
+	StatisticsScope scope(*this, Reduction::leastCost);
 	OGDF_ASSERT(!m_copyGraph.empty());
 	bool changed = false;
 	NodeArray<NodeArray<T>> shortestPath;
@@ -1000,6 +1255,7 @@ bool SteinerTreePreprocessing<T>::leastCostTest() {
 
 template<typename T>
 bool SteinerTreePreprocessing<T>::degree2Test() {
+	StatisticsScope scope(*this, Reduction::degree2);
 	OGDF_ASSERT(!m_copyGraph.empty());
 	bool changed = false;
 	for (node v = m_copyGraph.firstNode(), nextV; v; v = nextV) {
@@ -1029,6 +1285,7 @@ bool SteinerTreePreprocessing<T>::degree2Test() {
 
 template<typename T>
 bool SteinerTreePreprocessing<T>::deleteComponentsWithoutTerminals() {
+	StatisticsScope scope(*this, Reduction::componentsWithoutTerminals);
 	NodeArray<int> hisConnectedComponent(m_copyGraph, -1);
 	bool changed = connectedComponents(m_copyGraph, hisConnectedComponent) > 1;
 	if (changed) {
@@ -1053,13 +1310,12 @@ bool SteinerTreePreprocessing<T>::deleteComponentsWithoutTerminals() {
 
 template<typename T>
 bool SteinerTreePreprocessing<T>::terminalDistanceTest() {
+	StatisticsScope scope(*this, Reduction::terminalDistance);
 	OGDF_ASSERT(!m_copyGraph.empty());
 	OGDF_ASSERT(isConnected(m_copyGraph));
 	bool changed = false;
 
-	EdgeWeightedGraphCopy<T> tprime;
-	steiner_tree::constructTerminalSpanningTreeUsingVoronoiRegions(tprime, m_copyGraph,
-			m_copyTerminals);
+	const EdgeWeightedGraphCopy<T>& tprime = terminalSpanningTree();
 	T maxBottleneck(0);
 	for (edge e : tprime.edges) {
 		Math::updateMax(maxBottleneck, tprime.weight(e));
@@ -1079,8 +1335,9 @@ bool SteinerTreePreprocessing<T>::terminalDistanceTest() {
 
 template<typename T>
 void SteinerTreePreprocessing<T>::findClosestNonTerminals(node source, List<node>& reachedNodes,
-		NodeArray<T>& distance, T maxDistance, int expandedEdges) const {
-	PrioritizedMapQueue<node, T> queue(m_copyGraph);
+		NodeArray<T>& distance, T maxDistance, int expandedEdges,
+		PrioritizedMapQueue<node, T>& queue) const {
+	OGDF_ASSERT(queue.empty());
 
 	// initialization
 	distance[source] = 0;
@@ -1120,37 +1377,44 @@ void SteinerTreePreprocessing<T>::findClosestNonTerminals(node source, List<node
 
 template<typename T>
 bool SteinerTreePreprocessing<T>::longEdgesTest() {
+	StatisticsScope scope(*this, Reduction::longEdges);
 	OGDF_ASSERT(!m_copyGraph.empty());
-	bool changed = false;
-	NodeArray<T> xDistance(m_copyGraph, std::numeric_limits<T>::max()),
-			yDistance(m_copyGraph, std::numeric_limits<T>::max());
-
-	for (edge e = m_copyGraph.firstEdge(), nextE; e; e = nextE) {
-		nextE = e->succ();
-		List<node> xReachedNodes, yReachedNodes;
 
-		findClosestNonTerminals(e->source(), xReachedNodes, xDistance, m_copyGraph.weight(e), 200);
-		findClosestNonTerminals(e->target(), yReachedNodes, yDistance, m_copyGraph.weight(e), 200);
+	// Since an edge is only deleted if there is a strictly shorter path, all edges
+	// can be tested on the same graph and deleted afterwards.
+	return deleteEdgesIf([this] {
+		return [this, xDistance = NodeArray<T>(m_copyGraph, std::numeric_limits<T>::max()),
+					   yDistance = NodeArray<T>(m_copyGraph, std::numeric_limits<T>::max()),
+					   queue = PrioritizedMapQueue<node, T>(m_copyGraph)](
+					   edge e) mutable {
+			bool longEdge = false;
+			List<node> xReachedNodes, yReachedNodes;
+
+			findClosestNonTerminals(e->source(), xReachedNodes, xDistance, m_copyGraph.weight(e),
+					200, queue);
+			findClosestNonTerminals(e->target(), yReachedNodes, yDistance, m_copyGraph.weight(e),
+					200, queue);
+
+			for (node commonNode : xReachedNodes) {
+				if (yDistance[commonNode] == std::numeric_limits<T>::max()) { // is not common
+					continue;
+				}
+				if (m_eps.less(xDistance[commonNode] + yDistance[commonNode],
+							m_copyGraph.weight(e))) {
+					longEdge = true;
+					break;
+				}
+			}
 
-		for (node commonNode : xReachedNodes) {
-			if (yDistance[commonNode] == std::numeric_limits<T>::max()) { // is not common
-				continue;
+			for (node reachedNode : xReachedNodes) {
+				xDistance[reachedNode] = std::numeric_limits<T>::max();
 			}
-			if (m_eps.less(xDistance[commonNode] + yDistance[commonNode], m_copyGraph.weight(e))) {
-				m_copyGraph.delEdge(e);
-				changed = true;
-				break;
+			for (node reachedNode : yReachedNodes) {
+				yDistance[reachedNode] = std::numeric_limits<T>::max();
 			}
-		}
-
-		for (node reachedNode : xReachedNodes) {
-			xDistance[reachedNode] = std::numeric_limits<T>::max();
-		}
-		for (node reachedNode : yReachedNodes) {
-			yDistance[reachedNode] = std::numeric_limits<T>::max();
-		}
-	}
-	return changed;
+			return longEdge;
+		};
+	});
 }
 
 template<typename T>
@@ -1251,36 +1515,26 @@ void SteinerTreePreprocessing<T>::computeClosestKTerminals(const int k,
 
 template<typename T>
 bool SteinerTreePreprocessing<T>::PTmTest(const int k) {
+	StatisticsScope scope(*this, Reduction::PTm);
 	OGDF_ASSERT(!m_copyGraph.empty());
 	OGDF_ASSERT(isConnected(m_copyGraph));
-	bool changed = false;
-
-	EdgeWeightedGraphCopy<T> tprime;
-	steiner_tree::constructTerminalSpanningTreeUsingVoronoiRegions(tprime, m_copyGraph,
-			m_copyTerminals);
-
-	NodeArray<List<std::pair<node, T>>> closestTerminals;
-	computeClosestKTerminals(k, closestTerminals);
-
-	steiner_tree::HeavyPathDecomposition<T> tprimeHPD(tprime);
-
-	for (edge e = m_copyGraph.firstEdge(), nextE; e; e = nextE) {
-		nextE = e->succ();
 
-		T bottleneckDistance = computeBottleneckDistance(e->source(), e->target(), tprime,
-				tprimeHPD, closestTerminals);
+	const EdgeWeightedGraphCopy<T>& tprime = terminalSpanningTree();
+	const steiner_tree::HeavyPathDecomposition<T>& tprimeHPD = terminalSpanningTreeHPD();
+	const NodeArray<List<std::pair<node, T>>>& closestTerminals = this->closestTerminals(k);
 
-		if (m_eps.greater(m_copyGraph.weight(e), bottleneckDistance)) {
-			m_copyGraph.delEdge(e);
-			changed = true;
-		}
-	}
-
-	return changed;
+	return deleteEdgesIf([&] {
+		return [&](edge e) {
+			T bottleneckDistance = computeBottleneckDistance(e->source(), e->target(), tprime,
+					tprimeHPD, closestTerminals);
+			return m_eps.greater(m_copyGraph.weight(e), bottleneckDistance);
+		};
+	});
 }
 
 template<typename T>
 bool SteinerTreePreprocessing<T>::NTDkTest(const int maxTestedDegree, const int k) {
+	StatisticsScope scope(*this, Reduction::NTDk);
 	OGDF_ASSERT(!m_copyGraph.empty());
 	if (m_copyTerminals.size() <= 2) {
 		return false;
@@ -1290,14 +1544,9 @@ bool SteinerTreePreprocessing<T>::NTDkTest(const int maxTestedDegree, const int
 	OGDF_ASSERT(isSimpleUndirected(m_copyGraph));
 	OGDF_ASSERT(isConnected(m_copyGraph));
 
-	EdgeWeightedGraphCopy<T> tprime;
-	steiner_tree::constructTerminalSpanningTreeUsingVoronoiRegions(tprime, m_copyGraph,
-			m_copyTerminals);
-
-	NodeArray<List<std::pair<node, T>>> closestTerminals;
-	computeClosestKTerminals(k, closestTerminals);
-
-	steiner_tree::HeavyPathDecomposition<T> tprimeHPD(tprime);
+	const EdgeWeightedGraphCopy<T>& tprime = terminalSpanningTree();
+	const steiner_tree::HeavyPathDecomposition<T>& tprimeHPD = terminalSpanningTreeHPD();
+	const NodeArray<List<std::pair<node, T>>>& closestTerminals = this->closestTerminals(k);
 
 	for (node v = m_copyGraph.firstNode(), nextV; v; v = nextV) {
 		nextV = v->succ();
@@ -1430,6 +1679,7 @@ bool SteinerTreePreprocessing<T>::addEdgesToSolution(const List<edge>& edgesToBe
 
 template<typename T>
 bool SteinerTreePreprocessing<T>::nearestVertexTest() {
+	StatisticsScope scope(*this, Reduction::nearestVertex);
 	OGDF_ASSERT(!m_copyGraph.empty());
 	OGDF_ASSERT(isLoopFree(m_copyGraph));
 	OGDF_ASSERT(isConnected(m_copyGraph));
@@ -1502,6 +1752,7 @@ bool SteinerTreePreprocessing<T>::nearestVertexTest() {
 
 template<typename T>
 bool SteinerTreePreprocessing<T>::shortLinksTest() {
+	StatisticsScope scope(*this, Reduction::shortLinks);
 	OGDF_ASSERT(!m_copyGraph.empty());
 	OGDF_ASSERT(isConnected(m_copyGraph));
 
@@ -1593,6 +1844,7 @@ bool SteinerTreePreprocessing<T>::deleteNodesAboveUpperBound(const NodeArray<T>&
 
 template<typename T>
 bool SteinerTreePreprocessing<T>::lowerBoundBasedTest(T upperBound) {
+	StatisticsScope scope(*this, Reduction::lowerBound);
 	OGDF_ASSERT(!m_copyGraph.empty());
 	if (m_copyTerminals.size() <= 1) {
 		return false;
@@ -1602,8 +1854,7 @@ bool SteinerTreePreprocessing<T>::lowerBoundBasedTest(T upperBound) {
 
 	NodeArray<T> lowerBoundWithNode(m_copyGraph, std::numeric_limits<T>::lowest());
 
-	NodeArray<List<std::pair<node, T>>> closestTerminals;
-	computeClosestKTerminals(3, closestTerminals);
+	const NodeArray<List<std::pair<node, T>>>& closestTerminals = this->closestTerminals(3);
 
 	// Update the lowerbound of the cost of a Steiner tree containing one particular node
 	// as explained in [PV01, page 278, Observation 3.5]
@@ -1706,6 +1957,7 @@ bool SteinerTreePreprocessing<T>::lowerBoundBasedTest(T upperBound) {
 
 template<typename T>
 bool SteinerTreePreprocessing<T>::dualAscentBasedTest(int repetitions, T upperBound) {
+	StatisticsScope scope(*this, Reduction::dualAscent);
 	OGDF_ASSERT(!m_copyGraph.empty());
 	bool changed = false;
 	if (m_copyTerminals.size() > 1) {
@@ -1762,6 +2014,7 @@ T SteinerTreePreprocessing<T>::computeRadiusSum() const {
 
 template<typename T>
 bool SteinerTreePreprocessing<T>::reachabilityTest(int maxDegreeTest, const int k) {
+	StatisticsScope scope(*this, Reduction::reachability);
 	OGDF_ASSERT(!m_copyGraph.empty());
 	OGDF_ASSERT(isSimpleUndirected(m_copyGraph));
 	OGDF_ASSERT(isConnected(m_copyGraph));
@@ -1780,15 +2033,10 @@ bool SteinerTreePreprocessing<T>::reachabilityTest(int maxDegreeTest, const int
 	delete approximatedSteinerTree;
 
 	// Initialize tprime and its hpd decomposition used for partially not adding useless edges during nodes' deletion
-	EdgeWeightedGraphCopy<T> tprime;
-	steiner_tree::constructTerminalSpanningTreeUsingVoronoiRegions(tprime, m_copyGraph,
-			m_copyTerminals);
+	const EdgeWeightedGraphCopy<T>& tprime = terminalSpanningTree();
 	OGDF_ASSERT(!tprime.empty());
-
-	NodeArray<List<std::pair<node, T>>> closestTerminals;
-	computeClosestKTerminals(k, closestTerminals);
-
-	steiner_tree::HeavyPathDecomposition<T> tprimeHPD(tprime);
+	const steiner_tree::HeavyPathDecomposition<T>& tprimeHPD = terminalSpanningTreeHPD();
+	const NodeArray<List<std::pair<node, T>>>& closestTerminals = this->closestTerminals(k);
 
 	// check which nodes can be deleted
 	for (node v = m_copyGraph.firstNode(), nextV; v; v = nextV) {
@@ -1884,6 +2132,7 @@ void SteinerTreePreprocessing<T>::computeOptimalTerminals(node v, LAMBDA dist,
 
 template<typename T>
 bool SteinerTreePreprocessing<T>::cutReachabilityTest() {
+	StatisticsScope scope(*this, Reduction::cutReachability);
 	OGDF_ASSERT(!m_copyGraph.empty());
 	if (m_copyTerminals.size() <= 2) {
 		return false;
@@ -166,6 +166,7 @@ private:
 	void buildAcceptableAdjStruct();
 	//! the second dfs traversal
 	void DFS2();
+	//! numbers the nodes in the order of the ordered adjacency lists (used by DFS2())
 	void pathFinder(node v);
 
 	//! finding of split components
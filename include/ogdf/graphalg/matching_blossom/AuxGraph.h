@@ -40,7 +40,6 @@
 #include <ogdf/graphalg/matching_blossom/PQ.h>
 
 #include <array>
-#include <unordered_set>
 #include <vector>
 
 namespace ogdf {
@@ -348,46 +347,45 @@ public:
 		delete auxNode;
 	}
 
-	//! Calculates the connected components of the auxiliary graph and stores them in \p components.
-	//! Only tight even-odd/odd-even edges between different trees are taken into account.
+	//! Calculates the connected components of the auxiliary graph. Only aux edges for which
+	//! \p isTight returns true, i.e. tight even-odd/odd-even edges between different trees, are
+	//! taken into account.
+	//!
+	//! Afterwards, \p order contains the nodes grouped by component, where component \a i consists
+	//! of the nodes order[first[i]], ..., order[first[i+1]-1], and \p component maps each node to
+	//! the index of its component. The components are numbered in the order of their first node.
 	//!
 	//! Note: We cannot use connectedComponents from simple_graph_alg.h since we need to iterate
 	//! the components one after another and not all edges are taken into account.
-	void connectedComponents(std::vector<std::unordered_set<node>>& components) {
-		NodeArray<bool> visited(m_graph, false);
-		std::vector<node> stack;
+	template<typename IsTight>
+	void connectedComponents(const IsTight& isTight, NodeArray<int>& component,
+			std::vector<node>& order, std::vector<int>& first) {
+		order.clear();
+		first.clear();
+		for (node u : m_graph.nodes) {
+			component[u] = -1;
+		}
 		for (node u : m_graph.nodes) {
-			if (!visited[u]) {
-				visited[u] = true;
-				stack.push_back(u);
-				std::unordered_set<node> component = {u};
-				while (!stack.empty()) {
-					node v = stack.back();
-					stack.pop_back();
-					for (adjEntry adj : v->adjEntries) {
+			if (component[u] < 0) {
+				const int c = static_cast<int>(first.size());
+				first.push_back(static_cast<int>(order.size()));
+				component[u] = c;
+				order.push_back(u);
+				// the nodes of the current component that are not yet scanned form a queue
+				for (size_t i = first.back(); i < order.size(); ++i) {
+					for (adjEntry adj : order[i]->adjEntries) {
 						node w = adj->twinNode();
-						if (!visited[w]) {
-							auto auxEdge = this->auxEdge(adj->theEdge());
-							if (auxEdge->hasEvenOddEqualityEdge()) {
-								component.insert(w);
-								visited[w] = true;
-								stack.push_back(w);
-							}
+						if (component[w] < 0 && isTight(adj->theEdge())) {
+							component[w] = c;
+							order.push_back(w);
 						}
 					}
 				}
-				components.push_back(component);
 			}
 		}
-#ifdef OGDF_DEBUG
-		// check that all nodes are in a component
-		int count = 0;
-		for (auto component : components) {
-			count += component.size();
-		}
-		OGDF_ASSERT(count == m_graph.numberOfNodes());
-#endif
-	};
+		first.push_back(static_cast<int>(order.size()));
+		OGDF_ASSERT(order.size() == (size_t)m_graph.numberOfNodes());
+	}
 };
 
 }
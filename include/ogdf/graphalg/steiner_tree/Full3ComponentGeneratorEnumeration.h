@@ -53,17 +53,14 @@ public:
 			const NodeArray<bool>& isTerminal, const NodeArray<NodeArray<T>>& distance,
 			const NodeArray<NodeArray<edge>>& pred,
 			std::function<void(node, node, node, node, T)> generateFunction) const {
-		this->forAllTerminalTriples(terminals, distance,
-				[&](node u, node v, node w, const NodeArray<T>& uDistance,
-						const NodeArray<T>& vDistance, const NodeArray<T>& wDistance) {
-					node center = nullptr;
-					T minCost = std::numeric_limits<T>::max();
+		this->generateWithBestCenters(terminals, isTerminal, pred,
+				[&](node u, node v, node w, node& center, T& minCost) {
 					for (node x : G.nodes) {
-						this->updateBestCenter(x, center, minCost, uDistance, vDistance, wDistance);
+						this->updateBestCenter(x, center, minCost, distance[u], distance[v],
+								distance[w]);
 					}
-					this->checkAndGenerateFunction(u, v, w, center, minCost, pred, isTerminal,
-							generateFunction);
-				});
+				},
+				generateFunction);
 	}
 };
 
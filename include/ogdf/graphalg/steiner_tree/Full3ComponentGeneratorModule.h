@@ -31,10 +31,16 @@
 
 #pragma once
 
+#include <ogdf/basic/Array.h>
 #include <ogdf/basic/Graph.h>
 #include <ogdf/basic/List.h>
+#include <ogdf/basic/basic.h>
+#include <ogdf/basic/internal/parallel.h>
 
+#include <atomic>
 #include <functional>
+#include <limits>
+#include <vector>
 
 namespace ogdf {
 template<typename T>
@@ -48,11 +54,17 @@ namespace steiner_tree {
  * A full 3-component is basically a tree with *exactly* three terminal leaves
  * but no inner terminals. There must be exactly one nonterminal of degree 3,
  * the so-called center.
+ *
+ * The search for the best centers of all terminal triples may be distributed
+ * over up to #maxThreads threads; the generate function is always called by
+ * the calling thread and in the same order.
  */
 template<typename T>
-class Full3ComponentGeneratorModule {
+class Full3ComponentGeneratorModule : public internal::MaxThreadsOption {
+
 public:
 	Full3ComponentGeneratorModule() = default;
+
 	virtual ~Full3ComponentGeneratorModule() = default;
 
 	//! Generate full components and call \p generateFunction for each full component
@@ -101,6 +113,85 @@ protected:
 		}
 	}
 
+	/**
+	 * \brief Finds the best center of each terminal triple and generates the full 3-components.
+	 *
+	 * The triples are visited in the same order as by forAllTerminalTriples(). If more than
+	 * one thread may be used, the centers are computed by several threads, each handling
+	 * the triples of one first terminal at a time, and \p generateFunction is called
+	 * afterwards by the calling thread.
+	 *
+	 * @param terminals The terminals
+	 * @param isTerminal Incidence vector for terminal nodes
+	 * @param pred The predecessor matrix
+	 * @param findCenter Computes the best center and its cost for a terminal triple;
+	 *        it is called concurrently and must not change shared data
+	 * @param generateFunction Is called for each valid full 3-component
+	 */
+	void generateWithBestCenters(const List<node>& terminals, const NodeArray<bool>& isTerminal,
+			const NodeArray<NodeArray<edge>>& pred,
+			std::function<void(node, node, node, node&, T&)> findCenter,
+			std::function<void(node, node, node, node, T)> generateFunction) const {
+		Array<node> t(terminals.size());
+		int k = 0;
+		for (node v : terminals) {
+			t[k++] = v;
+		}
+
+		const unsigned int threads = min(m_maxThreads, static_cast<unsigned int>(max(1, k - 2)));
+		if (threads == 1) {
+			for (int i = 0; i < k; ++i) {
+				for (int j = i + 1; j < k; ++j) {
+					for (int l = j + 1; l < k; ++l) {
+						node center = nullptr;
+						T minCost = std::numeric_limits<T>::max();
+						findCenter(t[i], t[j], t[l], center, minCost);
+						checkAndGenerateFunction(t[i], t[j], t[l], center, minCost, pred,
+								isTerminal, generateFunction);
+					}
+				}
+			}
+			return;
+		}
+
+		struct Center {
+			int j, l;
+			node center;
+			T cost;
+		};
+
+		// in each round, the triples of a few first terminals are handled by all threads
+		const int roundSize = 2 * threads;
+		std::vector<std::vector<Center>> centers(roundSize);
+		for (int first = 0; first < k; first += roundSize) {
+			const int last = min(k, first + roundSize);
+			std::atomic<int> next(first);
+			internal::runThreads(threads, [&](unsigned int) {
+				for (int i = next++; i < last; i = next++) {
+					std::vector<Center>& found = centers[i - first];
+					found.clear();
+					for (int j = i + 1; j < k; ++j) {
+						for (int l = j + 1; l < k; ++l) {
+							node center = nullptr;
+							T minCost = std::numeric_limits<T>::max();
+							findCenter(t[i], t[j], t[l], center, minCost);
+							if (center != nullptr) {
+								found.push_back({j, l, center, minCost});
+							}
+						}
+					}
+				}
+			});
+
+			for (int i = first; i < last; ++i) {
+				for (const Center& c : centers[i - first]) {
+					checkAndGenerateFunction(t[i], t[c.j], t[c.l], c.center, c.cost, pred,
+							isTerminal, generateFunction);
+				}
+			}
+		}
+	}
+
 	inline void checkAndGenerateFunction(node u, node v, node w, node center, T minCost,
 			const NodeArray<NodeArray<edge>>& pred, const NodeArray<bool>& isTerminal,
 			std::function<void(node, node, node, node, T)> generateFunction) const {
@@ -55,11 +55,11 @@ public:
 			const NodeArray<NodeArray<edge>>& pred,
 			std::function<void(node, node, node, node, T)> generateFunction) const {
 		Voronoi<T> voronoi(G, G.edgeWeights(), terminals);
-		this->forAllTerminalTriples(terminals, distance,
-				[&](node u, node v, node w, const NodeArray<T>& uDistance,
-						const NodeArray<T>& vDistance, const NodeArray<T>& wDistance) {
-					node center = nullptr;
-					T minCost = std::numeric_limits<T>::max();
+		this->generateWithBestCenters(terminals, isTerminal, pred,
+				[&](node u, node v, node w, node& center, T& minCost) {
+					const NodeArray<T>& uDistance = distance[u];
+					const NodeArray<T>& vDistance = distance[v];
+					const NodeArray<T>& wDistance = distance[w];
 					// look in all Voronoi regions for the best center node
 					for (node x : voronoi.nodesInRegion(u)) {
 						this->updateBestCenter(x, center, minCost, uDistance, vDistance, wDistance);
@@ -70,9 +70,8 @@ public:
 					for (node x : voronoi.nodesInRegion(w)) {
 						this->updateBestCenter(x, center, minCost, uDistance, vDistance, wDistance);
 					}
-					this->checkAndGenerateFunction(u, v, w, center, minCost, pred, isTerminal,
-							generateFunction);
-				});
+				},
+				generateFunction);
 	}
 };
 
@@ -31,15 +31,19 @@
 
 #pragma once
 
-#include <ogdf/basic/ArrayBuffer.h>
+#include <ogdf/basic/Array.h>
 #include <ogdf/basic/Graph.h>
-#include <ogdf/basic/Hashing.h>
 #include <ogdf/basic/List.h>
 #include <ogdf/basic/Math.h>
 #include <ogdf/basic/SubsetEnumerator.h>
 #include <ogdf/basic/basic.h>
+#include <ogdf/basic/internal/parallel.h>
 
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
 #include <limits>
+#include <vector>
 
 namespace ogdf {
 template<typename T>
@@ -56,107 +60,129 @@ namespace steiner_tree {
  * This generator can handle (and exploit) predecessor matrices that use \c nullptr
  * instead of resembling shortest paths over terminals. (See the terminal-preferring
  * shortest path algorithms in ogdf::MinSteinerTreeModule<T>.)
+ *
+ * The partial solutions for a terminal subset \a S plus a node \a v are kept in one
+ * flat array per cardinality of \a S, indexed by the rank of \a S in the combinatorial
+ * number system and the position of \a v. A partial solution only stores how it is
+ * composed; the actual tree is built by getSteinerTreeFor(). The subsets of the same
+ * cardinality do not depend on each other and are distributed over up to #maxThreads
+ * threads.
  */
 template<typename T>
-class FullComponentGeneratorDreyfusWagner {
+class FullComponentGeneratorDreyfusWagner : public internal::MaxThreadsOption {
 	const EdgeWeightedGraph<T>& m_G; //!< A reference to the graph instance
 	const List<node>& m_terminals; //!< A reference to the index-sorted list of terminals
 	const NodeArray<bool>& m_isTerminal; //!< A reference to the terminal incidence vector
 	const NodeArray<NodeArray<T>>& m_distance; //!< A reference to the full distance matrix
 	const NodeArray<NodeArray<edge>>& m_pred; //!< A reference to the full predecessor matrix
-	SubsetEnumerator<node> m_terminalSubset; //!< Handling subsets of terminals
 
-	using NodePairs = ArrayBuffer<NodePair>;
+	Array<node> m_node; //!< The nodes of #m_G
+	NodeArray<int> m_nodeIndex; //!< The position of each node in #m_node
+	Array<node> m_terminal; //!< The terminals in the order of #m_terminals
+	NodeArray<int> m_terminalIndex; //!< The position of each terminal in #m_terminal (or -1)
 
-	//! Subgraphs (given by other subgraphs and additional node pairs) and their cost for a partial solution
-	struct DWMData {
+	/**
+	 * A partial solution for a terminal subset \a S plus a node \a v
+	 *
+	 * If \a S is a single terminal, it is the shortest path between the terminal and \a v.
+	 * Otherwise, it consists of the shortest path from \a v to the node \a w at position
+	 * #center and either the partial solution for \a S (if #split is 0) or the partial
+	 * solutions for \a A + \a w and (\a S - \a A) + \a w, where the i-th bit of #split
+	 * tells whether the i-th terminal of \a S is in \a A.
+	 */
+	struct Partial {
 		T cost;
-		NodePairs nodepairs;
-		ArrayBuffer<const DWMData*> subgraphs;
+		int center;
+		uint32_t split : 31;
+		uint32_t intact : 1; //!< Whether all parts are valid
+
+		Partial() : cost(std::numeric_limits<T>::max()), center(-1), split(0), intact(0) { }
 
-		DWMData(T _cost, NodePairs _nodepairs) : cost(_cost), nodepairs(_nodepairs) { }
+		//! Returns true iff the data is valid
+		bool valid() const { return intact || cost == 0; }
+	};
 
-		explicit DWMData(T _cost = std::numeric_limits<T>::max()) : cost(_cost) { }
+	//! Memory used by one thread to compute partial solutions
+	struct Workspace {
+		std::vector<int> subset, part1, part2, merged;
+		std::vector<char> inSubset; //!< Whether a terminal is in the current subset
+		std::vector<T> splitCost; //!< Cost of the best split of the current subset at each node
+		std::vector<uint32_t> split; //!< The best split of the current subset at each node
+		std::vector<char> splitIntact; //!< Whether both parts of the best split are valid
+	};
 
-		//! Invalidates the data
-		void invalidate() {
-			nodepairs.clear();
-			subgraphs.clear();
+	int m_restricted = 2; //!< The maximal cardinality of terminal sets computed by call()
+	std::vector<std::vector<size_t>> m_binomial; //!< Binomial coefficients
+	//! The partial solutions for all terminal subsets of each cardinality
+	std::vector<std::vector<Partial>> m_partial;
+	std::vector<uint32_t> m_splits; //!< All splits of the current cardinality, in order
+
+	//! Returns the rank of the index-sorted terminal subset \p c of cardinality \p s
+	size_t rank(const int* c, int s) const {
+		size_t r = 0;
+		for (int i = 0; i < s; ++i) {
+			r += m_binomial[c[i]][i + 1];
 		}
+		return r;
+	}
 
-		//! Returns true iff the data is valid
-		bool valid() const { return cost == 0 || !(nodepairs.empty() && subgraphs.empty()); }
-
-		//! Adds \p other subgraph to ours
-		void add(const DWMData* other) {
-			if (valid()) {
-				if (other->valid()) {
-					subgraphs.push(other);
-				} else {
-					invalidate();
-				}
+	//! Sets \p c to the terminal subset of cardinality \p s with rank \p r
+	void unrank(size_t r, int* c, int s) const {
+		int x = m_terminal.size() - 1;
+		for (int i = s - 1; i >= 0; --i, --x) {
+			while (m_binomial[x][i + 1] > r) {
+				--x;
 			}
-			cost += other->cost;
+			c[i] = x;
+			r -= m_binomial[x][i + 1];
 		}
+	}
 
-		//! Remove all subgraphs and edges and set cost to zero
-		void clear() {
-			invalidate();
-			cost = 0; // make it valid again
+	//! Sets \p c to the terminal subset of cardinality \p s with the next rank
+	static void nextSubset(int* c, int s) {
+		int i = 0;
+		for (; i + 1 < s && c[i] + 1 == c[i + 1]; ++i) {
+			c[i] = i;
 		}
+		++c[i];
+	}
 
-		//! Adds a \p nodepair of cost \p c
-		void add(NodePair nodepair, T c) {
-			if (valid()) {
-				nodepairs.push(nodepair);
-			}
-			cost += c;
+	//! Writes the terminal subset \p c of cardinality \p s plus terminal \p t sorted to \p out
+	static void insertTerminal(const int* c, int s, int t, int* out) {
+		int i = 0;
+		for (; i < s && c[i] < t; ++i) {
+			out[i] = c[i];
 		}
-	};
-
-	//! A collection of two subgraphs and their total cost
-	struct DWMSplit {
-		T cost = std::numeric_limits<T>::max();
-		const DWMData* subgraph1 = nullptr;
-		const DWMData* subgraph2 = nullptr;
-
-		//! Sets #subgraph1 and #subgraph2 and computes #cost
-		void set(const DWMData* s1, const DWMData* s2) {
-			subgraph1 = s1;
-			subgraph2 = s2;
-			cost = s1->cost + s2->cost;
+		out[i] = t;
+		for (; i < s; ++i) {
+			out[i + 1] = c[i];
 		}
-	};
-
-	//! Hash function to save partial solutions by terminal set (sorted node list)
-	class SortedNodeListHashFunc;
-
-	//! A hash array for keys of size > 2
-	Hashing<List<node>, DWMData, SortedNodeListHashFunc> m_map;
+	}
 
-	//! Returns a pointer to the relevant data of the partial solution given by \p key
-	const DWMData* dataOf(const List<node>& key) const {
-		OGDF_ASSERT(key.size() > 1);
-		OGDF_ASSERT(m_map.member(key));
-		return &m_map.lookup(key)->info();
+	//! Returns the partial solution for the sorted terminal set \p c of cardinality \p m >= 2
+	const Partial& partialOfTerminals(const int* c, int m) const {
+		OGDF_ASSERT(m >= 2);
+		const size_t n = m_node.size();
+		if (m == 2) {
+			// stored for the terminal that comes later in the node list
+			const int a = m_nodeIndex[m_terminal[c[0]]];
+			const int b = m_nodeIndex[m_terminal[c[1]]];
+			return a < b ? m_partial[1][c[1] * n + a] : m_partial[1][c[0] * n + b];
+		}
+		if (m == m_restricted) {
+			return m_partial[m - 1][rank(c, m)];
+		}
+		return m_partial[m - 1][rank(c, m - 1) * n + m_nodeIndex[m_terminal[c[m - 1]]]];
 	}
 
-	//! Returns the cost of the partial solution given by \p key
-	T costOf(const List<node>& key) const {
-		OGDF_ASSERT(key.size() > 1);
-		if (key.size() == 2) { // a shortcut to avoid using the hash table
-#ifdef OGDF_FULL_COMPONENT_GENERATION_TERMINAL_SSSP_AWARE
-			if (m_isTerminal[key.front()]) {
-				return m_distance[key.front()][key.back()];
-			} else {
-				OGDF_ASSERT(m_isTerminal[key.back()]);
-				return m_distance[key.back()][key.front()];
-			}
-#else
-			return m_distance[key.front()][key.back()];
-#endif
+	//! Returns the partial solution for terminal subset \p c of cardinality \p s plus node \p v
+	const Partial& partialOf(const int* c, int s, int v, int* buffer) const {
+		const int t = m_terminalIndex[m_node[v]];
+		if (t >= 0) {
+			insertTerminal(c, s, t, buffer);
+			return partialOfTerminals(buffer, s + 1);
 		}
-		return dataOf(key)->cost;
+		return m_partial[s][rank(c, s) * m_node.size() + v];
 	}
 
 	//! Checks overflow-safe if \p summand1 plus \p summand2 is less than \p compareValue
@@ -169,193 +195,236 @@ class FullComponentGeneratorDreyfusWagner {
 #endif
 	}
 
-	/**
-	 * Is being used as a callback to ogdf::SubsetEnumerator's forEach* methods
-	 * to get the subset plus a correctly inserted \p newNode (ie, sorted by index)
-	 * into \p list. This takes linear time in comparison to copy, insert, sort
-	 * which takes average case O(n log n) time.
-	 *
-	 * @param w Node argument for the callback
-	 * @param list Resulting list
-	 * @param inserted Whether \p newNode was inserted; must be initialized to \c false
-	 * @param newNode New node to be inserted into the list
-	 */
-	static void sortedInserter(node w, List<node>& list, bool& inserted, node newNode) {
-		if (!inserted && w->index() > newNode->index()) {
-			list.pushBack(newNode);
-			inserted = true;
+	//! Splits terminal subset \p c of cardinality \p s by \p split into \p part1 and \p part2
+	static int splitSubset(const int* c, int s, uint32_t split, int* part1, int* part2) {
+		int s1 = 0, s2 = 0;
+		for (int i = 0; i < s; ++i) {
+			if (split & (1u << i)) {
+				part1[s1++] = c[i];
+			} else {
+				part2[s2++] = c[i];
+			}
 		}
-		list.pushBack(w);
+		return s1;
 	}
 
-	//! Makes a list from the current terminal subset including an correctly inserted node \p v
-	void makeKey(List<node>& newSubset, node v) const {
-		bool inserted = false;
-		m_terminalSubset.forEachMember([&](node w) { sortedInserter(w, newSubset, inserted, v); });
-		if (!inserted) {
-			newSubset.pushBack(v);
+	//! Computes the best splits of \p ws.subset (of cardinality \p s) at all nodes
+	void computeSplits(int s, Workspace& ws) const {
+		const int* c = ws.subset.data();
+		for (int w = 0; w < m_node.size(); ++w) {
+			ws.splitCost[w] = std::numeric_limits<T>::max();
+			const int t = m_terminalIndex[m_node[w]];
+			if (t >= 0 && ws.inSubset[t]) {
+				continue;
+			}
+			for (uint32_t split : m_splits) {
+				const int s1 = splitSubset(c, s, split, ws.part1.data(), ws.part2.data());
+				const Partial& p1 = partialOf(ws.part1.data(), s1, w, ws.merged.data());
+				const Partial& p2 = partialOf(ws.part2.data(), s - s1, w, ws.merged.data());
+				if (safeIfSumSmaller(p1.cost, p2.cost, ws.splitCost[w])) {
+					ws.splitCost[w] = p1.cost + p2.cost;
+					ws.split[w] = split;
+					ws.splitIntact[w] = p1.valid() && p2.valid();
+				}
+			}
 		}
 	}
 
-	//! Makes a list from \p subset and its complement, each including an correctly inserted node \p v
-	void makeKey(List<node>& newSubset, List<node>& newComplement,
-			const SubsetEnumerator<node>& subset, node v) const {
-		bool insertedIntoSubset = false;
-		bool insertedIntoComplement = false;
-		// Interestingly std::bind is much slower than using lambdas (at least on g++ 6.3)
-		subset.forEachMemberAndNonmember(
-				[&](node w) { sortedInserter(w, newSubset, insertedIntoSubset, v); },
-				[&](node w) { sortedInserter(w, newComplement, insertedIntoComplement, v); });
-		if (!insertedIntoSubset) {
-			newSubset.pushBack(v);
-		}
-		if (!insertedIntoComplement) {
-			newComplement.pushBack(v);
+	//! Computes the partial solution for \p ws.subset (of cardinality \p s) plus node \p v
+	Partial computePartial(int s, int v, const Workspace& ws) const {
+		const Partial& ofSubset = partialOfTerminals(ws.subset.data(), s);
+		const node vG = m_node[v];
+		Partial best;
+		for (int w = 0; w < m_node.size(); ++w) {
+			const node wG = m_node[w];
+			const T dist = m_distance[vG][wG];
+			const int t = m_terminalIndex[wG];
+			if (t >= 0 && ws.inSubset[t]) {
+				// we attach edge vw to tree containing terminal w
+				if (safeIfSumSmaller(ofSubset.cost, dist, best.cost)) {
+					best.cost = ofSubset.cost + dist;
+					best.center = w;
+					best.split = 0;
+					best.intact = ofSubset.valid() && m_pred[vG][wG] != nullptr;
+				}
+			} else if (safeIfSumSmaller(ws.splitCost[w], dist, best.cost)) {
+				// we attach edge vw to the split at w
+				best.cost = ws.splitCost[w] + (v != w ? dist : T(0));
+				best.center = w;
+				best.split = ws.split[w];
+				best.intact = ws.splitIntact[w] && (v == w || m_pred[vG][wG] != nullptr);
+			}
 		}
+		return best;
 	}
 
-	/**
-	 * Populates \p split that contains a partial solution for an included nonterminal \p v in #m_G
-	 *
-	 * Note that it is not guaranteed that any resulting collection of node pairs represents a tree.
-	 */
-	void computeSplit(NodeArray<DWMSplit>& split, node v, SubsetEnumerator<node>& subset) const {
-		if (split[v].subgraph1 != nullptr) { // already computed
-			return;
+	//! Computes all partial solutions for \p ws.subset (of cardinality \p s)
+	void computePartials(int s, Workspace& ws) {
+		const int* c = ws.subset.data();
+		for (int i = 0; i < s; ++i) {
+			ws.inSubset[c[i]] = true;
 		}
-
-		DWMSplit& best = split[v];
-		for (subset.begin(1, subset.numberOfMembersAndNonmembers() / 2); subset.valid();
-				subset.next()) {
-			List<node> newSubset, newComplement;
-			makeKey(newSubset, newComplement, subset, v);
-
-			if (safeIfSumSmaller(costOf(newSubset), costOf(newComplement), best.cost)) {
-				best.set(dataOf(newSubset), dataOf(newComplement));
+		computeSplits(s, ws);
+
+		const size_t r = rank(c, s);
+		if (s == m_restricted - 1) {
+			// maximal terminal subset: only terminals are added
+			for (int t = c[s - 1] + 1; t < m_terminal.size(); ++t) {
+				m_partial[s][r + m_binomial[t][s + 1]] =
+						computePartial(s, m_nodeIndex[m_terminal[t]], ws);
 			}
-		}
-	}
-
-	//! Computes a partial solution for given \p terminals and node \p v
-	void computePartialSolution(NodeArray<DWMSplit>& split, node v, SubsetEnumerator<node>& subset,
-			const List<node>& terminals) {
-		List<node> newSubset;
-		makeKey(newSubset, v);
-
-		if (!m_map.member(newSubset)) { // not already defined
-			T oldCost = costOf(terminals);
-			DWMData best;
-			auto addPair = [&](node v1, node v2, T dist) {
-				best.add(NodePair(v1, v2), dist);
-				if (m_pred[v1][v2] == nullptr) {
-					best.invalidate();
-				}
-			};
-			for (node w : m_G.nodes) {
-				T dist = m_distance[v][w];
-				if (m_terminalSubset.hasMember(w)) {
-					// we attach edge vw to tree containing terminal w
-					if (safeIfSumSmaller(oldCost, dist, best.cost)) {
-						best.clear();
-						best.add(dataOf(terminals));
-						addPair(v, w, dist);
-					}
-				} else {
-					// we attach edge vw to tree split[w]
-					OGDF_ASSERT(!m_terminalSubset.hasMember(v));
-					computeSplit(split, w, subset);
-					if (safeIfSumSmaller(split[w].cost, dist, best.cost)) {
-						best.clear();
-						best.add(split[w].subgraph1);
-						best.add(split[w].subgraph2);
-						if (v != w) {
-							addPair(v, w, dist);
-						}
-					}
+		} else {
+			for (int v = 0; v < m_node.size(); ++v) {
+				const int t = m_terminalIndex[m_node[v]];
+				// terminal sets are only stored with their last terminal added
+				if (t < 0 || t > c[s - 1]) {
+					m_partial[s][r * m_node.size() + v] = computePartial(s, v, ws);
 				}
 			}
-			m_map.fastInsert(newSubset, best);
 		}
-	}
 
-	//! Computes all partial solutions for given #m_terminalSubset
-	template<typename CONTAINER>
-	void computePartialSolutions(const CONTAINER& nodeContainer) {
-		List<node> terminals;
-		m_terminalSubset.list(terminals);
-		SubsetEnumerator<node> subset(terminals); // done here because of linear running time
-		NodeArray<DWMSplit> split(m_G);
-		for (node v : nodeContainer) {
-			if (!m_terminalSubset.hasMember(v)) {
-				computePartialSolution(split, v, subset, terminals);
-			}
+		for (int i = 0; i < s; ++i) {
+			ws.inSubset[c[i]] = false;
 		}
 	}
 
-	//! Initializes the hash array with all node-terminal-pairs
-	void initializeMap() {
-		for (node v : m_G.nodes) {
-			for (node t : m_terminals) {
-				if (t != v) {
-					List<node> key;
-					key.pushBack(t);
-					if (v->index() < t->index()) {
-						key.pushFront(v);
-					} else {
-						key.pushBack(v);
-					}
+	//! Computes the partial solutions for all terminal subsets of cardinality \p s
+	void computeLevel(int s) {
+		const int k = m_terminal.size();
+		const size_t subsets = m_binomial[k][s];
+		const size_t n = m_node.size();
+		m_partial[s].assign(s == m_restricted - 1 ? m_binomial[k][s + 1] : subsets * n, Partial());
+
+		m_splits.clear();
+		Array<int> position(s);
+		for (int i = 0; i < s; ++i) {
+			position[i] = i;
+		}
+		SubsetEnumerator<int> splitEnumerator(position);
+		for (splitEnumerator.begin(1, s / 2); splitEnumerator.valid(); splitEnumerator.next()) {
+			uint32_t split = 0;
+			splitEnumerator.forEachMember([&](int i) { split |= 1u << i; });
+			m_splits.push_back(split);
+		}
 
-					if (!m_map.member(key)) { // not already defined
-						if (m_pred[t][v] == nullptr) {
-							m_map.fastInsert(key, DWMData(m_distance[t][v]));
-							OGDF_ASSERT(!dataOf(key)->valid() || m_distance[t][v] == 0);
-						} else {
-							NodePairs nodepairs;
-							nodepairs.push(NodePair(key.front(), key.back()));
-							m_map.fastInsert(key, DWMData(m_distance[t][v], nodepairs));
-							OGDF_ASSERT(dataOf(key)->valid());
-						}
+		const unsigned int threads =
+				static_cast<unsigned int>(min<size_t>(m_maxThreads, subsets));
+		const size_t chunk = max<size_t>(1, subsets / (16 * threads));
+		std::atomic<size_t> next(0);
+		internal::runThreads(threads, [&](unsigned int) {
+			Workspace ws;
+			ws.subset.resize(s);
+			ws.part1.resize(s);
+			ws.part2.resize(s);
+			ws.merged.resize(s + 1);
+			ws.inSubset.assign(k, false);
+			ws.splitCost.resize(n);
+			ws.split.resize(n);
+			ws.splitIntact.resize(n);
+			for (size_t first = next.fetch_add(chunk); first < subsets;
+					first = next.fetch_add(chunk)) {
+				const size_t last = min(subsets, first + chunk);
+				unrank(first, ws.subset.data(), s);
+				for (size_t r = first; r < last; ++r) {
+					if (r > first) {
+						nextSubset(ws.subset.data(), s);
 					}
+					computePartials(s, ws);
 				}
 			}
-		}
+		});
 	}
 
-	//! Adds edges to construct a Steiner \p tree from the given \p data (recursively) if the \p data is valid
-	T getSteinerTreeFor(const DWMData& data, EdgeWeightedGraphCopy<T>& tree) const {
-		T cost(0);
-		if (data.valid()) {
-			// add edges
-			for (auto nodepair : data.nodepairs) {
-				node uO = nodepair.source;
-				node vO = nodepair.target;
-				node uC = tree.copy(uO);
-				node vC = tree.copy(vO);
-				if (uC == nullptr) {
-					uC = tree.newNode(uO);
-				}
-				if (vC == nullptr) {
-					vC = tree.newNode(vO);
+	//! Initializes the partial solutions for all node-terminal-pairs
+	void initializePairs() {
+		const size_t n = m_node.size();
+		m_partial.resize(2);
+		m_partial[1].resize(m_terminal.size() * n);
+		for (int t = 0; t < m_terminal.size(); ++t) {
+			const node tG = m_terminal[t];
+			for (int v = 0; v < m_node.size(); ++v) {
+				const node vG = m_node[v];
+				if (vG != tG) {
+					Partial& p = m_partial[1][t * n + v];
+					p.cost = m_distance[tG][vG];
+					p.intact = m_pred[tG][vG] != nullptr;
+					OGDF_ASSERT(p.intact || !p.valid() || p.cost == 0);
 				}
+			}
+		}
+	}
+
+	//! Adds the shortest path between \p uO and \p vO as an edge to \p tree and returns its cost
+	T addEdge(node uO, node vO, EdgeWeightedGraphCopy<T>& tree) const {
+		node uC = tree.copy(uO);
+		node vC = tree.copy(vO);
+		if (uC == nullptr) {
+			uC = tree.newNode(uO);
+		}
+		if (vC == nullptr) {
+			vC = tree.newNode(vO);
+		}
 #ifdef OGDF_FULL_COMPONENT_GENERATION_TERMINAL_SSSP_AWARE
-				const T dist = m_isTerminal[uO] ? m_distance[uO][vO] : m_distance[vO][uO];
+		const T dist = m_isTerminal[uO] ? m_distance[uO][vO] : m_distance[vO][uO];
 #else
-				const T dist = m_distance[uO][vO];
+		const T dist = m_distance[uO][vO];
 #endif
-				tree.newEdge(uC, vC, dist);
-				cost += dist;
-			}
+		tree.newEdge(uC, vC, dist);
+		return dist;
+	}
 
-			// recurse
-			for (const DWMData* subgraph : data.subgraphs) {
-				cost += getSteinerTreeFor(*subgraph, tree);
-			}
+	//! Adds the edges of the partial solution for sorted terminal set \p c of cardinality \p m
+	T addTerminals(const int* c, int m, EdgeWeightedGraphCopy<T>& tree) const {
+		if (m == 2) {
+			const int a = m_nodeIndex[m_terminal[c[0]]];
+			const int b = m_nodeIndex[m_terminal[c[1]]];
+			return a < b ? addPartial(c + 1, 1, a, tree) : addPartial(c, 1, b, tree);
+		}
+		return addPartial(c, m - 1, m_nodeIndex[m_terminal[c[m - 1]]], tree);
+	}
+
+	//! Adds the edges of the partial solution for terminal subset \p c of cardinality \p s plus \p v
+	T addPartial(const int* c, int s, int v, EdgeWeightedGraphCopy<T>& tree) const {
+		std::vector<int> buffer(s + 1);
+		const Partial& p = partialOf(c, s, v, buffer.data());
+		if (!p.intact) {
+			return T(0);
+		}
+
+		const node vG = m_node[v];
+		if (s == 1) {
+			const node tG = m_terminal[c[0]];
+			return vG->index() < tG->index() ? addEdge(vG, tG, tree) : addEdge(tG, vG, tree);
 		}
 
-		OGDF_ASSERT(isAcyclicUndirected(tree));
+		const node wG = m_node[p.center];
+		T cost(0);
+		if (p.split == 0) {
+			cost += addEdge(vG, wG, tree);
+			cost += addTerminals(c, s, tree);
+		} else {
+			if (v != p.center) {
+				cost += addEdge(vG, wG, tree);
+			}
+			std::vector<int> part1(s), part2(s);
+			const int s1 = splitSubset(c, s, p.split, part1.data(), part2.data());
+			cost += addPartialOrTerminals(part1.data(), s1, p.center, tree);
+			cost += addPartialOrTerminals(part2.data(), s - s1, p.center, tree);
+		}
 		return cost;
 	}
 
+	//! Like addPartial() but also handles terminal nodes \p v
+	T addPartialOrTerminals(const int* c, int s, int v, EdgeWeightedGraphCopy<T>& tree) const {
+		const int t = m_terminalIndex[m_node[v]];
+		if (t >= 0) {
+			std::vector<int> merged(s + 1);
+			insertTerminal(c, s, t, merged.data());
+			return addTerminals(merged.data(), s + 1, tree);
+		}
+		return addPartial(c, s, v, tree);
+	}
+
 public:
 	/** The constructor
 	 * \pre The list of terminals has to be sorted by index (use MinSteinerTreeModule<T>::sortTerminals)
@@ -368,31 +437,54 @@ public:
 		, m_isTerminal(isTerminal)
 		, m_distance(distance)
 		, m_pred(pred)
-		, m_terminalSubset(m_terminals)
-		, m_map(1 << 22) // we initially allocate 4MB*sizeof(DWMData) for hashing
-	{
-		initializeMap();
+		, m_node(G.numberOfNodes())
+		, m_nodeIndex(G)
+		, m_terminal(terminals.size())
+		, m_terminalIndex(G, -1) {
+		int i = 0;
+		for (node v : G.nodes) {
+			m_nodeIndex[v] = i;
+			m_node[i++] = v;
+		}
+		i = 0;
+		for (node t : terminals) {
+			m_terminalIndex[t] = i;
+			m_terminal[i++] = t;
+		}
+		initializePairs();
 	}
 
 	void call(int restricted) {
 		OGDF_ASSERT(restricted >= 2);
 		Math::updateMin(restricted, m_terminals.size());
-		for (m_terminalSubset.begin(2, restricted - 1); m_terminalSubset.valid();
-				m_terminalSubset.next()) {
-			if (m_terminalSubset.size() != restricted - 1) {
-				computePartialSolutions(m_G.nodes);
-			} else { // maximal terminal subset
-				// save time by only adding terminals instead of all nodes
-				computePartialSolutions(m_terminals);
+		OGDF_ASSERT(restricted <= 32);
+		m_restricted = max(restricted, 2);
+
+		const int k = m_terminal.size();
+		m_binomial.assign(k + 1, std::vector<size_t>(m_restricted + 1, 0));
+		for (int x = 0; x <= k; ++x) {
+			m_binomial[x][0] = 1;
+			for (int i = 1; i <= min(x, m_restricted); ++i) {
+				m_binomial[x][i] = m_binomial[x - 1][i - 1] + (i < x ? m_binomial[x - 1][i] : 0);
 			}
 		}
+
+		m_partial.resize(m_restricted);
+		for (int s = 2; s < restricted; ++s) {
+			computeLevel(s);
+		}
 	}
 
 	//! Constructs a Steiner tree for the given set of terminals if it is valid,
 	//! otherwise an empty tree is returned
 	T getSteinerTreeFor(const List<node>& terminals, EdgeWeightedGraphCopy<T>& tree) const {
 		tree.setOriginalGraph(m_G);
-		T cost(getSteinerTreeFor(*dataOf(terminals), tree));
+		std::vector<int> c;
+		for (node t : terminals) {
+			c.push_back(m_terminalIndex[t]);
+		}
+		std::sort(c.begin(), c.end());
+		T cost(addTerminals(c.data(), c.size(), tree));
 		OGDF_ASSERT(isTree(tree));
 		return cost;
 	}
@@ -412,25 +504,5 @@ public:
 	}
 };
 
-template<typename T>
-class FullComponentGeneratorDreyfusWagner<T>::SortedNodeListHashFunc {
-	static const unsigned int c_prime = 0x7fffffff; // mersenne prime 2**31 - 1
-	// would be nicer: 0x1fffffffffffffff; // mersenne prime 2**61 - 1
-	const int m_random;
-
-public:
-	//! Initializes the random number
-	SortedNodeListHashFunc() : m_random(randomNumber(2, c_prime - 1)) { }
-
-	//! The actual hash function
-	unsigned int hash(const List<node>& key) const {
-		unsigned int hash = 0;
-		for (node v : key) {
-			hash = (hash * m_random + v->index()) % c_prime;
-		}
-		return hash;
-	}
-};
-
 }
 }
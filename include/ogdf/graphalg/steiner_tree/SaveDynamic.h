@@ -56,9 +56,11 @@ namespace steiner_tree {
  * \brief Dynamically updatable weighted Tree for determining save edges via LCA computation.
  *  Note that in this dynamic approach, only the auxiliary tree is updated and not
  *  the actual terminal spanning tree (if OGDF_SAVEDYNAMIC_CHANGE_TST is not set).
+ *
+ * The LCA data structure is chosen by \p LCAType, e.g., LCA or LCALinear.
  */
 //#define OGDF_SAVEDYNAMIC_CHANGE_TST
-template<typename T>
+template<typename T, typename LCAType = LCA>
 class SaveDynamic : public Save<T> {
 public:
 	/*!
@@ -74,7 +76,7 @@ public:
 		, m_steinerTree(&steinerTree)
 		, m_cTerminals(*m_steinerTree, nullptr) {
 		m_root = buildHeaviestEdgeInComponentTree(*m_steinerTree, m_cTerminals, m_treeEdge, m_tree);
-		m_lca = new LCA(m_tree, m_root);
+		m_lca = new LCAType(m_tree, m_root);
 	}
 
 	virtual ~SaveDynamic() { delete m_lca; }
@@ -230,7 +232,7 @@ public:
 		m_tree.delNode(save1);
 		m_tree.delNode(save2);
 
-		m_lca = new LCA(m_tree, m_root);
+		m_lca = new LCAType(m_tree, m_root);
 
 #ifdef OGDF_SAVEDYNAMIC_CHANGE_TST
 		edge newEdge0, newEdge1;
@@ -269,7 +271,7 @@ private:
 #endif
 			EdgeWeightedGraphCopy<T>* m_steinerTree; //!< The underlying terminal spanning tree this weighted tree instance represents
 	NodeArray<node> m_cTerminals; //!< Connects terminal nodes in the terminal spanning tree to their leafs in the weighted tree
-	LCA* m_lca; //!< Data structure for calculating the LCAs
+	LCAType* m_lca; //!< Data structure for calculating the LCAs
 };
 
 }
@@ -52,8 +52,10 @@ namespace steiner_tree {
 /*!
  * \brief This class behaves basically the same as SaveDynamic except
  *  that the update of the weighted graph is not done dynamically here
+ *
+ * The LCA data structure is chosen by \p LCAType, e.g., LCA or LCALinear.
  */
-template<typename T>
+template<typename T, typename LCAType = LCA>
 class SaveStatic : public Save<T> {
 public:
 	explicit SaveStatic(EdgeWeightedGraphCopy<T>& steinerTree)
@@ -63,7 +65,7 @@ public:
 		, m_steinerTree(&steinerTree)
 		, m_cTerminals(*m_steinerTree, nullptr) {
 		m_root = buildHeaviestEdgeInComponentTree(*m_steinerTree, m_cTerminals, m_treeEdge, m_tree);
-		m_lca = new LCA(m_tree, m_root);
+		m_lca = new LCAType(m_tree, m_root);
 	}
 
 	virtual ~SaveStatic() { delete m_lca; }
@@ -115,7 +117,7 @@ public:
 		m_cTerminals.fill(nullptr);
 		m_root = buildHeaviestEdgeInComponentTree(*m_steinerTree, m_cTerminals, m_treeEdge, m_tree);
 		delete m_lca;
-		m_lca = new LCA(m_tree, m_root);
+		m_lca = new LCAType(m_tree, m_root);
 	}
 
 	/*!
@@ -149,7 +151,7 @@ private:
 	NodeArray<edge> m_treeEdge; //!< Maps each inner node of m_tree to an edge in m_steinerTree
 	EdgeWeightedGraphCopy<T>* m_steinerTree; //!< A pointer to the tree we represent the save for
 	node m_root; //!< The root of m_tree
-	LCA* m_lca; //!< The LCA data structure for m_tree
+	LCAType* m_lca; //!< The LCA data structure for m_tree
 	NodeArray<node> m_cTerminals;
 };
 
@@ -106,6 +106,15 @@ class HierarchyLevelsBase;
  *     may not decrease after a complete top-down bottom-up traversal,
  *     before a run is terminated.
  *   </tr><tr>
+ *     <td><i>windowSize</i><td>int<td>0
+ *     <td>If set to a value of at least 2, the top-down and bottom-up traversals
+ *     are restricted to a window of that many consecutive levels which slides
+ *     from the top to the bottom of the hierarchy; the level shared with the
+ *     previous window is kept fixed. This limits the time spent on crossing
+ *     minimization in very deep hierarchies, but not the memory: long edges are
+ *     still represented by chains of dummy nodes.
+ *     A value of 0 traverses all levels at once.
+ *   </tr><tr>
  *     <td><i>arrangeCCs</i><td>bool<td>true
  *     <td>If set to true connected components are
  *     laid out separately and the resulting layouts are arranged afterwards
@@ -191,6 +200,7 @@ protected:
 
 	int m_fails; //!< Option for maximal number of fails.
 	int m_runs; //!< Option for number of runs.
+	int m_windowSize; //!< Option for the number of levels per crossing minimization window.
 	bool m_transpose; //!< Option for switching on transposal heuristic.
 	bool m_arrangeCCs; //!< Option for laying out components separately.
 	double m_minDistCC; //!< Option for distance between connected components.
@@ -276,6 +286,26 @@ public:
 	//! Sets the option runs to \p nRuns.
 	void runs(int nRuns) { m_runs = nRuns; }
 
+	/**
+	 * \brief Returns the current setting of option windowSize.
+	 *
+	 * If this option is at least 2, crossing minimization processes windows of
+	 * \a windowSize consecutive levels from top to bottom instead of traversing
+	 * the whole hierarchy. Each window is traversed until the number of crossings
+	 * within the window does not decrease anymore (see option fails); the first
+	 * level of a window is the last level of the previous one and stays fixed.
+	 * Windowing only bounds the time of crossing minimization; the hierarchy,
+	 * including its dummy nodes, is still built as a whole.
+	 * A value of 0 disables windowing.
+	 */
+	int windowSize() const { return m_windowSize; }
+
+	//! Sets the option windowSize to \p size (0 or at least 2).
+	void windowSize(int size) {
+		OGDF_ASSERT(size == 0 || size >= 2);
+		m_windowSize = size;
+	}
+
 	/**
 	 * \brief Returns the current setting of option transpose.
 	 *
@@ -0,0 +1,140 @@
+/** \file
+ * \brief Declaration of class BatchPlanarityTest, which tests many graphs
+ * for planarity in parallel.
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.md in the OGDF root directory for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, see
+ * http://www.gnu.org/copyleft/gpl.html
+ */
+
+#pragma once
+
+#include <ogdf/basic/Graph.h>
+#include <ogdf/basic/basic.h>
+#include <ogdf/basic/internal/parallel.h>
+
+#include <functional>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+namespace ogdf {
+
+class LRPlanarityTest;
+
+//! Tests many (small) graphs for planarity in parallel.
+/**
+ * @ingroup ga-planarity
+ *
+ * The graphs are distributed dynamically over up to maxThreads() threads.
+ * Every thread owns its own planarity test workspace (BoyerMyrvold and
+ * LRPlanarityTest, respectively), which is reused for all graphs processed
+ * by this thread.
+ *
+ * The results are returned as a bit vector, i.e., <tt>planar[i]</tt> is true
+ * iff the <i>i</i>-th graph is planar.
+ *
+ * For graph6 input, isPlanarGraph6() decodes each graph directly into the
+ * edge list of the planarity test without constructing a Graph.
+ *
+ * <H3>Optional parameters</H3>
+ *
+ * <table>
+ *   <tr>
+ *     <th><i>Option</i><th><i>Type</i><th><i>Default</i><th><i>Description</i>
+ *   </tr><tr>
+ *     <td><i>maxThreads</i><td>int<td>System::numberOfProcessors()
+ *     <td>The maximal number of threads used for processing the graphs. Never more
+ *     threads than graphs are used.
+ *   </tr>
+ * </table>
+ */
+class OGDF_EXPORT BatchPlanarityTest : public internal::MaxThreadsOption {
+public:
+	//! Creates an instance with default settings.
+	BatchPlanarityTest() = default;
+
+	//! Tests each graph in \p graphs for planarity.
+	/**
+	 * @param graphs are the graphs to be tested; they are not modified.
+	 * @param planar is assigned the results.
+	 */
+	void isPlanar(const std::vector<const Graph*>& graphs, std::vector<bool>& planar) const;
+
+	//! Tests each graph in \p graphs for planarity and embeds the planar ones.
+	/**
+	 * After the call, every planar graph in \p graphs represents a planar
+	 * combinatorial embedding.
+	 *
+	 * @param graphs are the graphs to be tested and embedded.
+	 * @param planar is assigned the results.
+	 */
+	void planarEmbed(const std::vector<Graph*>& graphs, std::vector<bool>& planar) const;
+
+	//! Tests each graph given in graph6 format in \p graph6 for planarity.
+	/**
+	 * Each string encodes one graph without header; a leading
+	 * <tt>>>graph6<<</tt> header is allowed as well.
+	 *
+	 * @param graph6 are the encoded graphs.
+	 * @param planar is assigned the results.
+	 * @return false iff one of the strings is not a valid graph6 encoding;
+	 *         the result for such a string is false.
+	 */
+	bool isPlanarGraph6(const std::vector<std::string>& graph6, std::vector<bool>& planar) const;
+
+	//! Tests each graph in the graph6 stream \p is (one graph per line) for planarity.
+	/**
+	 * Empty lines are skipped. The stream is read and tested in batches of a few
+	 * thousand lines, so the memory use does not grow with the length of the stream.
+	 *
+	 * @param is is the input stream.
+	 * @param planar is assigned the results.
+	 * @return false iff one of the lines is not a valid graph6 encoding.
+	 */
+	bool isPlanarGraph6(std::istream& is, std::vector<bool>& planar) const;
+
+	//! Decodes the graph6 string \p graph6 into the edge list of \p test.
+	/**
+	 * @param graph6 is the encoded graph.
+	 * @param test is the planarity test whose edge list is replaced.
+	 * @param n is assigned the number of nodes.
+	 * @return false iff \p graph6 is not a valid graph6 encoding.
+	 */
+	static bool decodeGraph6(const std::string& graph6, LRPlanarityTest& test, int& n);
+
+private:
+
+	//! Calls \p work(i, id) for every i = 0, ..., \p count - 1 in parallel.
+	/**
+	 * \p id is the index of the calling thread, which lies in 0, ..., \p nThreads - 1.
+	 */
+	void forAll(int count, unsigned int nThreads,
+			const std::function<void(int, unsigned int)>& work) const;
+
+	//! Returns the number of threads used for \p count graphs.
+	unsigned int numberOfThreads(int count) const;
+};
+
+}
@@ -37,6 +37,7 @@
 #include <ogdf/basic/SList.h>
 #include <ogdf/basic/basic.h>
 #include <ogdf/planarity/ExtractKuratowskis.h>
+#include <ogdf/planarity/LRPlanarityTest.h>
 #include <ogdf/planarity/PlanarityModule.h>
 #include <ogdf/planarity/boyer_myrvold/BoyerMyrvoldPlanar.h>
 
@@ -72,7 +73,9 @@ class KuratowskiSubdivision;
  *
  * <b>Examples:</b>\n
  * BoyerMyrvold::isPlanarDestructive(G), BoyerMyrvold::isPlanar(G):\n
- * Tests graph \a G for planarity with the Boyer-Myrvold planarity test.
+ * Tests graph \a G for planarity. Since no embedding is needed, both functions
+ * use the allocation-free left-right planarity test of LRPlanarityTest on a
+ * workspace that is reused by subsequent calls; \a G is not modified.
  *
  * BoyerMyrvold::planarEmbedDestructive(G), BoyerMyrvold::planarEmbed(G), BoyerMyrvold::planarEmbed(G,H):\n
  * Tests graph \a G for planarity and returns a planar embedding in \a G,
@@ -150,6 +153,9 @@ protected:
 	//! The number of extracted Structures for statistical purposes
 	int nOfStructures;
 
+	//! Workspace of the pure planarity test, reused by isPlanar() and isPlanarDestructive()
+	LRPlanarityTest m_test;
+
 public:
 	//! Constructor
 	BoyerMyrvold() {
@@ -164,13 +170,14 @@ public:
 	int numberOfStructures() { return nOfStructures; }
 
 	//! Returns true, iff \p g is planar
-	/** This is the routine, which avoids the overhead of copying the input graph.
-	 * It is therefore not suitable, if your graph must not be alterated!
+	/** This routine does not alter \p g anymore; it is equivalent to isPlanar().
 	 */
 	virtual bool isPlanarDestructive(Graph& g) override;
 
-	//! Returns true, iff a copy of the constant graph \p g is planar
-	/** Use this slower routine, if your graph must not be alterated.
+	//! Returns true, iff \p g is planar
+	/** The test neither copies \p g nor computes an embedding. Its workspace
+	 * is kept between calls, so testing many graphs with the same instance
+	 * avoids repeated allocations (see LRPlanarityTest).
 	 */
 	virtual bool isPlanar(const Graph& g) override;
 
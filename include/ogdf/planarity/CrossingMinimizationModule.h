@@ -123,6 +123,7 @@ protected:
 			const EdgeArray<bool>* pForbiddenOrig, const EdgeArray<uint32_t>* pEdgeSubGraphs,
 			int& crossingNumber) = 0;
 
+public:
 	/**
 	 * Computes the (weighted) crossing number of the planarization \p graphCopy.
 	 *
@@ -38,6 +38,7 @@
 #include <ogdf/basic/basic.h>
 #include <ogdf/basic/memory.h>
 
+#include <atomic>
 #include <cstdint>
 
 namespace ogdf {
@@ -171,6 +172,24 @@ public:
 		return doCall(pr, origEdges, pCostOrig, pForbiddenOrig, pEdgeSubGraphs);
 	}
 
+	//! Sets a bound on the crossing number at which edge insertion is aborted.
+	/**
+	 * Edge insertion modules supporting this option stop inserting edges as soon as the
+	 * (weighted) crossing number of the planarized representation, as computed by
+	 * CrossingMinimizationModule::computeCrossingNumber(), is at least the value
+	 * pointed to by \p pBound; the call then returns ReturnType::NoFeasibleSolution and
+	 * leaves the planarized representation in an intermediate state.
+	 * The bound may be lowered concurrently by other threads.
+	 *
+	 * Currently, only VariableEmbeddingInserter supports this option; other modules ignore it.
+	 *
+	 * @param pBound points to the bound, or is a null pointer (the default) for no bound.
+	 */
+	void crossingBound(const std::atomic<int>* pBound) { m_pCrossingBound = pBound; }
+
+	//! Returns the bound on the crossing number set by crossingBound(const std::atomic<int>*).
+	const std::atomic<int>* crossingBound() const { return m_pCrossingBound; }
+
 
 protected:
 	//! Actual algorithm call that has to be implemented by derived classes.
@@ -188,6 +207,7 @@ protected:
 			const EdgeArray<int>* pCostOrig, const EdgeArray<bool>* pForbiddenOrig,
 			const EdgeArray<uint32_t>* pEdgeSubGraphs) = 0;
 
+	const std::atomic<int>* m_pCrossingBound = nullptr; //!< The bound on the crossing number.
 
 	OGDF_MALLOC_NEW_DELETE
 };
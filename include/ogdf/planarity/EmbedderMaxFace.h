@@ -37,6 +37,7 @@
 #include <ogdf/basic/List.h>
 #include <ogdf/basic/Observer.h>
 #include <ogdf/basic/basic.h>
+#include <ogdf/basic/internal/parallel.h>
 #include <ogdf/decomposition/BCTree.h>
 #include <ogdf/planarity/embedder/EmbedderBCTreeBase.h>
 #include <ogdf/planarity/embedder/EmbedderMaxFaceBiconnectedGraphs.h>
@@ -53,7 +54,8 @@ class StaticSPQRTree;
  * See the paper "Graph Embedding with Minimum Depth and Maximum External Face"
  * by C. Gutwenger and P. Mutzel (2004) for details.
  */
-class OGDF_EXPORT EmbedderMaxFace : public embedder::EmbedderBCTreeBase<false> {
+class OGDF_EXPORT EmbedderMaxFace : public embedder::EmbedderBCTreeBase<false>,
+									public internal::MaxThreadsOption {
 public:
 	/**
 	 * \brief Computes an embedding of \p G with maximum external face.
@@ -254,6 +256,14 @@ protected:
 		}
 	}
 
+	/**
+	 * \brief Computes the block graph for every block and builds their SPQR-trees
+	 * with up to #m_maxThreads threads.
+	 *
+	 * \param rootBlockNode is the root node of the BC-tree.
+	 */
+	void computeBlockGraphsAndSPQRTrees(const node& rootBlockNode);
+
 	/**
 	 * \brief Computes recursively the block graph for every block.
 	 *
@@ -35,6 +35,7 @@
 #include <ogdf/basic/List.h>
 #include <ogdf/basic/Observer.h>
 #include <ogdf/basic/basic.h>
+#include <ogdf/basic/internal/parallel.h>
 #include <ogdf/planarity/embedder/EmbedderBCTreeBase.h>
 
 namespace ogdf {
@@ -47,7 +48,8 @@ class StaticSPQRTree;
  * See paper "Graph Embedding with Minimum Depth and Maximum External Face"
  * by C. Gutwenger and P. Mutzel (2004) for details.
  */
-class OGDF_EXPORT EmbedderMinDepth : public embedder::EmbedderBCTreeBase<false, true> {
+class OGDF_EXPORT EmbedderMinDepth : public embedder::EmbedderBCTreeBase<false, true>,
+									 public internal::MaxThreadsOption {
 public:
 	/**
 	 * \brief Computes an embedding of \p G with minimum depth.
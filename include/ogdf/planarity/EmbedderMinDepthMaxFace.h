@@ -89,6 +89,17 @@ protected:
 
 	virtual void embedBlock(const node& bT, const node& cT, ListIterator<adjEntry>& after) override;
 
+	/**
+	 * \brief Sets \p nodeLengthBlock to the lengths given by \p nodeLengthH
+	 * for the nodes of the block graph of \p bT.
+	 *
+	 * \param bT is a block vertex in the BC-tree.
+	 * \param nodeLengthH is saving the length of each node in the auxiliary graph.
+	 * \param nodeLengthBlock is assigned the length of each node in the block graph.
+	 */
+	void blockNodeLengths(const node& bT, const NodeArray<int>& nodeLengthH,
+			NodeArray<int>& nodeLengthBlock);
+
 	using EmbedderMaxFace::embedBlock;
 
 	/** saving for each node in the block graph its length */
@@ -0,0 +1,155 @@
+/** \file
+ * \brief Declaration of class IncrementalPlanarityTest, which maintains a
+ * planar graph under edge insertions.
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.md in the OGDF root directory for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, see
+ * http://www.gnu.org/copyleft/gpl.html
+ */
+
+#pragma once
+
+#include <ogdf/basic/Graph.h>
+#include <ogdf/basic/basic.h>
+#include <ogdf/planarity/LRPlanarityTest.h>
+
+#include <vector>
+
+namespace ogdf {
+
+//! Planarity oracle for a planar graph that grows by edge insertions.
+/**
+ * @ingroup ga-planarity
+ *
+ * The oracle starts with the nodes of a graph \a G and no edges. Edges
+ * between nodes of \a G can be inserted as long as the graph stays planar;
+ * isPlanarWith() answers whether inserting a further edge keeps it planar.
+ * The graph \a G itself is never modified; it only defines the node set.
+ *
+ * The oracle maintains the connected and the biconnected components of the
+ * current graph incrementally (rooted spanning forest, union-find over
+ * blocks, rerooting the smaller tree when two trees are joined). A graph is
+ * planar iff all its blocks are planar, and inserting an edge (\a u, \a v)
+ * only merges the blocks on the path between \a u and \a v in the block-cut
+ * tree. Hence:
+ *   - an edge joining two connected components is always accepted in
+ *     (amortized) constant time;
+ *   - otherwise, only the subgraph formed by the blocks on the path plus the
+ *     new edge is tested with LRPlanarityTest, instead of the whole graph.
+ *
+ * The running time of a query is linear in the size of the merged block. In
+ * the worst case (a single large block), this is no better than a full
+ * planarity test, but in sparse graphs with many blocks it is usually much
+ * smaller.
+ */
+class OGDF_EXPORT IncrementalPlanarityTest {
+public:
+	//! Creates an oracle for the nodes of \p G without any edges.
+	/**
+	 * No nodes may be added to \p G while the oracle is used.
+	 */
+	explicit IncrementalPlanarityTest(const Graph& G);
+
+	//! Returns true iff the current graph plus the edge (\p u, \p v) is planar.
+	bool isPlanarWith(node u, node v);
+
+	//! Inserts the edge (\p u, \p v) if this keeps the graph planar.
+	/**
+	 * @return true iff the edge was inserted.
+	 */
+	bool tryInsert(node u, node v) {
+		if (!isPlanarWith(u, v)) {
+			return false;
+		}
+		insert(u, v);
+		return true;
+	}
+
+	//! Inserts the edge (\p u, \p v) without testing planarity.
+	/**
+	 * The graph has to stay planar, i.e., isPlanarWith(\p u, \p v) must hold.
+	 */
+	void insert(node u, node v);
+
+	//! Returns the number of inserted edges (without self-loops).
+	int numberOfEdges() const { return m_numberOfEdges; }
+
+	//! Returns the number of blocks (biconnected components) of the current graph.
+	int numberOfBlocks() const { return m_numberOfBlocks; }
+
+private:
+	//! Returns the representative of the connected component of \p x.
+	int findComponent(int x);
+
+	//! Returns the representative of block \p b.
+	int findBlock(int b);
+
+	//! Returns the block containing the edge from \p x to its parent.
+	int parentBlock(int x) { return findBlock(m_treeBlock[x]); }
+
+	//! Collects the blocks on the path between \p x and \p y in #m_path.
+	/**
+	 * @return the topmost vertex of the block that results from merging these blocks.
+	 */
+	int collectPath(int x, int y);
+
+	//! Makes \p x a child of \p y in the spanning forest and reroots the tree of \p x at \p x.
+	void attach(int x, int y, int b);
+
+	//! Creates a new block and returns its index.
+	int newBlock(int top, int numberOfNodes);
+
+	int index(node v) const {
+		OGDF_ASSERT(v->graphOf() == &m_G);
+		return v->index();
+	}
+
+	const Graph& m_G; //!< The graph defining the node set.
+	int m_numberOfEdges = 0;
+	int m_numberOfBlocks = 0;
+	int m_stamp = 0; //!< Current time stamp for #m_nodeMark and #m_blockMark.
+
+	// node data (indexed by node indices of m_G)
+	std::vector<int> m_component; //!< Union-find parents of connected components.
+	std::vector<int> m_componentSize; //!< Number of nodes of each component.
+	std::vector<int> m_parent; //!< Parent in the spanning forest (-1 for roots).
+	std::vector<int> m_depth; //!< Depth in the spanning forest.
+	std::vector<int> m_treeBlock; //!< Block of the edge to the parent.
+	std::vector<std::vector<int>> m_treeAdj; //!< Neighbors in the spanning forest.
+	std::vector<int> m_nodeMark;
+	std::vector<int> m_localIndex; //!< Index of a node in the tested subgraph.
+
+	// block data
+	std::vector<int> m_block; //!< Union-find parents of blocks.
+	std::vector<int> m_blockTop; //!< Topmost node of each block.
+	std::vector<int> m_blockNodes; //!< Number of nodes of each block.
+	std::vector<std::vector<int>> m_blockEdges; //!< End nodes of all edges in each block.
+	std::vector<int> m_blockMark;
+
+	std::vector<int> m_path; //!< Blocks found by collectPath().
+	std::vector<int> m_stack; //!< Auxiliary stack for attach().
+	LRPlanarityTest m_test; //!< Workspace of the planarity test.
+};
+
+}
@@ -0,0 +1,165 @@
+/** \file
+ * \brief Declaration of class LRPlanarityTest, a planarity test with a
+ * reusable workspace based on the left-right criterion.
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.md in the OGDF root directory for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, see
+ * http://www.gnu.org/copyleft/gpl.html
+ */
+
+#pragma once
+
+#include <ogdf/basic/Graph.h>
+#include <ogdf/basic/basic.h>
+
+#include <vector>
+
+namespace ogdf {
+
+//! Planarity test with a reusable workspace.
+/**
+ * @ingroup ga-planarity
+ *
+ * This class only answers whether a graph is planar; it neither computes an
+ * embedding nor a Kuratowski subdivision. It implements the left-right
+ * planarity test as described in
+ *
+ * Ulrik Brandes: <i>The Left-Right Planarity Test</i>. Manuscript, 2009.
+ *
+ * All data is stored in flat arrays indexed by consecutive node and edge
+ * numbers. The arrays are kept between calls and only grow, so testing many
+ * small graphs with the same instance does not allocate memory after the
+ * first few calls. Both depth-first searches are iterative, so the test
+ * does not overflow the call stack on long paths.
+ *
+ * Self-loops and multi-edges are allowed in the input and ignored.
+ *
+ * An instance must not be used by several threads at the same time; use one
+ * instance per thread instead.
+ */
+class OGDF_EXPORT LRPlanarityTest {
+public:
+	//! Returns true iff \p G is planar.
+	bool isPlanar(const Graph& G);
+
+	//! Returns true iff the graph given as an edge list is planar.
+	/**
+	 * @param n is the number of nodes, which are numbered 0, ..., \p n - 1.
+	 * @param source contains the source of each edge.
+	 * @param target contains the target of each edge; must have the same size as \p source.
+	 */
+	bool isPlanar(int n, const std::vector<int>& source, const std::vector<int>& target);
+
+	//! Returns true iff the graph given by the edges added since the last clear() is planar.
+	/**
+	 * Together with clear() and addEdge(), this allows to fill the workspace
+	 * directly, e.g., while decoding an input format.
+	 *
+	 * @param n is the number of nodes, which are numbered 0, ..., \p n - 1.
+	 */
+	bool isPlanar(int n);
+
+	//! Removes all edges added by addEdge().
+	void clear() {
+		m_source.clear();
+		m_target.clear();
+	}
+
+	//! Adds the edge (\p u, \p v) to the graph tested by isPlanar(int).
+	void addEdge(int u, int v) {
+		m_source.push_back(u);
+		m_target.push_back(v);
+	}
+
+private:
+	//! A pair of intervals of return edges (-1 denotes an empty bound).
+	struct ConflictPair {
+		int leftLow = -1;
+		int leftHigh = -1;
+		int rightLow = -1;
+		int rightHigh = -1;
+
+		bool leftEmpty() const { return leftLow == -1 && leftHigh == -1; }
+
+		bool rightEmpty() const { return rightLow == -1 && rightHigh == -1; }
+
+		void swap() {
+			std::swap(leftLow, rightLow);
+			std::swap(leftHigh, rightHigh);
+		}
+	};
+
+	//! Copies the input edges to #m_tail and #m_head, omitting self-loops and multi-edges.
+	void removeMultiEdges(int n);
+
+	//! Builds the adjacency arrays for the edges in #m_tail and #m_head.
+	void buildAdjacency(int n);
+
+	//! Orients the edges along a DFS and computes lowpoints and nesting depths.
+	void orient(int root);
+
+	//! Sorts the outgoing edges of each node by nesting depth.
+	void sortByNestingDepth(int n);
+
+	//! Tests the left-right criterion for the DFS tree rooted at \p root.
+	bool testRoot(int root);
+
+	bool addConstraints(int ei, int e);
+	void removeBackEdges(int e);
+
+	//! Returns true iff the interval with upper bound \p high conflicts with edge \p b.
+	bool conflicting(int high, int b) const { return high != -1 && m_lowpt[high] > m_lowpt[b]; }
+
+	int lowest(const ConflictPair& P) const;
+
+	// input edges (possibly with self-loops and multi-edges)
+	std::vector<int> m_source;
+	std::vector<int> m_target;
+
+	// node data
+	std::vector<int> m_nodeIndex; //!< Maps node indices of a Graph to 0, ..., n-1.
+	std::vector<int> m_adjStart; //!< Start of the adjacency (and out-edge) list of each node.
+	std::vector<int> m_adjPos; //!< Current position in the adjacency list during a DFS.
+	std::vector<int> m_height; //!< DFS height of each node (-1 if unvisited).
+	std::vector<int> m_parentEdge; //!< Tree edge leading to each node (-1 for roots).
+	std::vector<char> m_returning; //!< Whether the DFS returns to a node from a child.
+	std::vector<int> m_roots; //!< The roots of the DFS trees.
+	std::vector<int> m_dfsStack;
+
+	// edge data
+	std::vector<int> m_adj; //!< Incident edges (later: outgoing edges) of each node.
+	std::vector<int> m_tail; //!< Tail of each edge (once oriented).
+	std::vector<int> m_head; //!< Head of each edge (once oriented).
+	std::vector<int> m_lowpt; //!< Lowpoint of each edge (-1 if not yet oriented).
+	std::vector<int> m_lowpt2;
+	std::vector<int> m_nesting; //!< Nesting depth of each edge.
+	std::vector<int> m_ref;
+	std::vector<int> m_lowptEdge;
+	std::vector<int> m_stackBottom;
+	std::vector<int> m_bucket; //!< Auxiliary array for bucket sorting.
+
+	std::vector<ConflictPair> m_S; //!< The stack of conflict pairs.
+};
+
+}
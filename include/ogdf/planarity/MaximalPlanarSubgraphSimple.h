@@ -40,6 +40,7 @@
 #include <ogdf/basic/basic.h>
 #include <ogdf/basic/comparer.h>
 #include <ogdf/basic/extended_graph_alg.h>
+#include <ogdf/planarity/IncrementalPlanarityTest.h>
 #include <ogdf/planarity/PlanarSubgraphEmpty.h>
 #include <ogdf/planarity/PlanarSubgraphModule.h>
 
@@ -53,6 +54,24 @@ namespace ogdf {
 template<typename TCost, class Enable = void>
 class MaximalPlanarSubgraphSimple { };
 
+namespace internal {
+
+//! Inserts all edges of \p graph except for \p delEdges into \p oracle.
+inline void insertRemainingEdges(const Graph& graph, const List<edge>& delEdges,
+		IncrementalPlanarityTest& oracle) {
+	EdgeArray<bool> deleted(graph, false);
+	for (edge e : delEdges) {
+		deleted[e] = true;
+	}
+	for (edge e : graph.edges) {
+		if (!deleted[e]) {
+			oracle.insert(e->source(), e->target());
+		}
+	}
+}
+
+}
+
 //! @endcond
 
 //! Naive maximal planar subgraph approach that extends a configurable non-maximal subgraph heuristic.
@@ -62,6 +81,8 @@ class MaximalPlanarSubgraphSimple { };
  * A (possibly non-maximal) planar subgraph is first computed by the set heuristic (default: ogdf::PlanarSubgraphEmpty).
  * Secondly, we iterate over all non-inserted edges performing one planarity test each.
  * Each edge is inserted if planarity can be maintained and discarded otherwise.
+ * These tests are answered by an IncrementalPlanarityTest, which only tests the
+ * biconnected component that would contain the new edge.
  */
 template<typename TCost>
 class MaximalPlanarSubgraphSimple<TCost, typename std::enable_if<std::is_integral<TCost>::value>::type>
@@ -116,16 +137,11 @@ protected:
 			heuDelEdges.quicksort(GenericComparer<edge, TCost>(*pCost));
 		}
 		if (Module::isSolution(result)) {
-			GraphCopy copy(graph);
+			IncrementalPlanarityTest oracle(graph);
+			internal::insertRemainingEdges(graph, heuDelEdges, oracle);
 			for (edge e : heuDelEdges) {
-				copy.delEdge(copy.copy(e));
-			}
-			for (edge e : heuDelEdges) {
-				edge f = copy.newEdge(e);
-
-				if (!isPlanar(copy)) {
+				if (!oracle.tryInsert(e->source(), e->target())) {
 					delEdges.pushBack(e);
-					copy.delEdge(f);
 				}
 			}
 		}
@@ -244,24 +260,18 @@ protected:
 			}
 
 			if (Module::isSolution(result)) {
-				GraphCopy copy(graph);
-
 				if (pCost != nullptr) {
 					GenericComparer<edge, TCost> cmp(normalizedCost);
 					heuDelEdges.quicksort(cmp);
 				}
 
-				for (edge e : heuDelEdges) {
-					copy.delEdge(copy.copy(e));
-				}
+				IncrementalPlanarityTest oracle(graph);
+				internal::insertRemainingEdges(graph, heuDelEdges, oracle);
 
 				delEdgesCurrentBest.clear();
 				for (edge e : heuDelEdges) {
-					edge f = copy.newEdge(e);
-
-					if (!isPlanar(copy)) {
+					if (!oracle.tryInsert(e->source(), e->target())) {
 						delEdgesCurrentBest.pushBack(e);
-						copy.delEdge(f);
 					}
 				}
 
@@ -83,6 +83,14 @@ class PlanRepLight;
  *     <td>If set to true, the time limit is also passed to submodules; otherwise,
  *     a timeout might be checked late when a submodule requires a lot of runtime.
  *   </tr><tr>
+ *     <td><i>boundedInsertion</i><td>bool<td>false
+ *     <td>If set to true, the edge insertion of a permutation is aborted as soon as
+ *     its crossing number reaches the best one found so far by any thread. This only has
+ *     an effect if the inserter supports bounded insertion (see
+ *     EdgeInsertionModule::crossingBound()). Since postprocessing of the inserter may
+ *     still reduce crossings, permutations may be discarded that would have led to
+ *     better solutions.
+ *   </tr><tr>
  *     <td><i>maxThreads</i><td>int<td>System::numberOfProcessors()
  *     <td>This is the maximal number of threads that will be used for parallelizing the
  *     algorithm. At the moment, each permutation is parallelized, hence the there will
@@ -150,6 +158,12 @@ public:
 	//! Sets the option <i>setTimeout</i> to \p b.
 	void setTimeout(bool b) { m_setTimeout = b; }
 
+	//! Returns the current setting of option <i>boundedInsertion</i>.
+	bool boundedInsertion() const { return m_boundedInsertion; }
+
+	//! Sets the option <i>boundedInsertion</i> to \p b.
+	void boundedInsertion(bool b) { m_boundedInsertion = b; }
+
 	//! Returns the maximal number of used threads.
 	unsigned int maxThreads() const { return m_maxThreads; }
 
@@ -174,6 +188,7 @@ private:
 
 	int m_permutations; //!< The number of permutations.
 	bool m_setTimeout; //!< The option for setting timeouts in submodules.
+	bool m_boundedInsertion; //!< The option for aborting insertion at the best known bound.
 	unsigned int m_maxThreads; //!< The maximal number of used threads.
 };
 
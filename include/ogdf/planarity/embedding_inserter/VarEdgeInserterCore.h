@@ -40,6 +40,7 @@
 #include <ogdf/basic/basic.h>
 #include <ogdf/planarity/PlanRepLight.h>
 
+#include <atomic>
 #include <cstdint>
 
 namespace ogdf {
@@ -56,6 +57,9 @@ public:
 
 	virtual ~VarEdgeInserterCore() { }
 
+	//! Sets the bound on the crossing number at which call() aborts (see EdgeInsertionModule).
+	void crossingBound(const std::atomic<int>* pBound) { m_pCrossingBound = pBound; }
+
 	Module::ReturnType call(const Array<edge>& origEdges, RemoveReinsertType rrPost,
 			double percentMostCrossed);
 
@@ -70,6 +74,10 @@ protected:
 
 	void insert(node s, node t, SList<adjEntry>& eip);
 	int costCrossed(edge eOrig) const;
+	int crossingNumberOf(edge eOrig) const;
+
+	//! Returns the number of subgraphs that contain both \p eOrig1 and \p eOrig2.
+	int sharedSubgraphs(edge eOrig1, edge eOrig2) const;
 
 	bool dfsVertex(node v, int parent);
 	node dfsComp(int i, node parent);
@@ -105,6 +113,8 @@ protected:
 	node m_v1, m_v2;
 
 	int m_runsPostprocessing; //!< Runs of remove-reinsert method.
+
+	const std::atomic<int>* m_pCrossingBound = nullptr; //!< Aborts insertion if reached.
 };
 
 class VarEdgeInserterUMLCore : public VarEdgeInserterCore {
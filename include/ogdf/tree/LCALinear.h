@@ -0,0 +1,132 @@
+/** \file
+ * \brief Linear-space lowest common ancestors with parallel preprocessing
+ *  and offline batch queries.
+ *
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.md in the OGDF root directory for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, see
+ * http://www.gnu.org/copyleft/gpl.html
+ */
+
+#pragma once
+
+#include <ogdf/basic/Array.h>
+#include <ogdf/basic/Graph.h>
+#include <ogdf/basic/basic.h>
+#include <ogdf/basic/internal/intrinsics.h>
+#include <ogdf/basic/internal/parallel.h>
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace ogdf {
+
+/**
+ * Computes lowest common ancestors (LCAs) in arborescences using O(\a n) space.
+ *
+ * The nodes are numbered in preorder. For two distinct nodes with preorder numbers
+ * \a i < \a j, the %LCA is the parent of a shallowest node among the numbers (\a i, \a j],
+ * so a range minimum query (RMQ) over the depths in preorder suffices. The RMQ uses
+ * blocks of 64 entries: queries inside a block are answered by a word of bit operations,
+ * queries spanning blocks additionally look up a sparse table over the block minima.
+ * Preprocessing takes O(\a n) time and space (the sparse table has O(\a n / 64 log \a n)
+ * entries), queries take O(1) time.
+ *
+ * Preprocessing may use several threads. Besides single queries, a batch of queries can
+ * be answered at once; the queries are then processed in the order of their position in
+ * the tree to improve memory locality, and distributed over the threads.
+ *
+ * The interface matches that of LCA, so both can be used interchangeably.
+ *
+ * @ingroup ga-tree
+ */
+class OGDF_EXPORT LCALinear : public internal::MaxThreadsOption {
+public:
+	/**
+	 * Builds the %LCA data structure for an arborescence
+	 *
+	 * If \p root is not provided, it is computed in additional O(\a n) time.
+	 *
+	 * @param G an arborescence
+	 * @param root optional root of the arborescence
+	 * @param maxThreads the maximal number of threads used for preprocessing and batch queries
+	 * @pre Each node in \p G is reachable from the root via a unique directed path, that is,
+	 *      \p G is an arborescence.
+	 */
+	explicit LCALinear(const Graph& G, node root = nullptr, unsigned int maxThreads = 1);
+
+	/**
+	 * Returns the %LCA of two nodes \p u and \p v.
+	 *
+	 * If \p u and \p v are the same node, \p u itself is defined
+	 * to be the %LCA, not its father.
+	 */
+	node call(node u, node v) const;
+
+	/**
+	 * Answers a batch of %LCA queries.
+	 *
+	 * @param queries the pairs of nodes to compute the %LCA of
+	 * @param result is assigned the %LCA of <tt>queries[i]</tt> at position \a i
+	 */
+	void call(const std::vector<std::pair<node, node>>& queries, std::vector<node>& result) const;
+
+	//! Returns the level of a node. The level of the root is 0.
+	int level(node v) const { return m_depth[m_preorder[v]]; }
+
+private:
+	static constexpr int s_logBlockSize = 6; //!< logarithm of the block size
+	static constexpr int s_blockSize = 1 << s_logBlockSize; //!< entries per block
+
+	const node m_root; //!< the root of the tree
+	int m_n = 0; //!< number of nodes in the tree
+	int m_blocks = 0; //!< number of blocks
+	int m_rangeJ = 0; //!< number of rows of the sparse table over the blocks
+	NodeArray<int> m_preorder; //!< preorder number of each node
+	Array<node> m_parent; //!< parent of the node with the respective preorder number
+	Array<int> m_depth; //!< depth of the node with the respective preorder number
+	Array<uint64_t> m_stack; //!< in-block minima stack at each position, as bit mask
+	Array<int> m_table; //!< sparse table of block minima, row-wise
+
+	//! Numbers the nodes of the tree in preorder and fills #m_parent and #m_depth.
+	void number(const Graph& G);
+
+	//! Fills #m_stack and #m_table.
+	void buildRMQ();
+
+	//! Returns the position of a minimum depth in the block-internal range [\p i, \p j].
+	int rmqInBlock(int i, int j) const {
+		uint64_t mask = m_stack[j] & (~uint64_t(0) << (i & (s_blockSize - 1)));
+		return (j & ~(s_blockSize - 1)) + lowestSetBit(mask);
+	}
+
+	//! Returns the position of a minimum depth in [\p i, \p j], where \p i <= \p j.
+	int rmq(int i, int j) const;
+
+	//! Returns the position of the smaller depth at \p i or \p j, preferring \p i.
+	int minPos(int i, int j) const { return m_depth[j] < m_depth[i] ? j : i; }
+};
+
+}
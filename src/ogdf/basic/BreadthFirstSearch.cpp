@@ -0,0 +1,246 @@
+/** \file
+ * \brief Implementation of class BreadthFirstSearch.
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.md in the OGDF root directory for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, see
+ * http://www.gnu.org/copyleft/gpl.html
+ */
+
+#include <ogdf/basic/Array.h>
+#include <ogdf/basic/BreadthFirstSearch.h>
+#include <ogdf/basic/Graph.h>
+#include <ogdf/basic/basic.h>
+#include <ogdf/basic/internal/parallel.h>
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace ogdf {
+
+using std::memory_order_relaxed;
+
+BreadthFirstSearch::BreadthFirstSearch(const Graph& G, bool directed)
+	: m_G(G), m_n(G.maxNodeIndex() + 1), m_directed(directed) {
+	m_nodes.assign(m_n, nullptr);
+	m_outBegin.assign(m_n + 1, 0);
+	if (directed) {
+		m_inBegin.assign(m_n + 1, 0);
+	}
+	for (node v : G.nodes) {
+		m_nodes[v->index()] = v;
+		for (adjEntry adj : v->adjEntries) {
+			if (!directed) {
+				++m_outBegin[v->index() + 1];
+			} else if (adj->isSource()) {
+				++m_outBegin[v->index() + 1];
+			} else {
+				++m_inBegin[v->index() + 1];
+			}
+		}
+	}
+	for (int v = 0; v < m_n; ++v) {
+		m_outBegin[v + 1] += m_outBegin[v];
+		if (directed) {
+			m_inBegin[v + 1] += m_inBegin[v];
+		}
+	}
+
+	m_outHead.resize(m_outBegin[m_n]);
+	m_outEdge.resize(m_outBegin[m_n]);
+	if (directed) {
+		m_inTail.resize(m_inBegin[m_n]);
+		m_inEdge.resize(m_inBegin[m_n]);
+	}
+	for (node v : G.nodes) {
+		int out = m_outBegin[v->index()];
+		int in = directed ? m_inBegin[v->index()] : 0;
+		for (adjEntry adj : v->adjEntries) {
+			if (!directed || adj->isSource()) {
+				m_outHead[out] = adj->twinNode()->index();
+				m_outEdge[out++] = adj->theEdge();
+			} else {
+				m_inTail[in] = adj->twinNode()->index();
+				m_inEdge[in++] = adj->theEdge();
+			}
+		}
+	}
+
+	m_distance.reset(new std::atomic<int>[m_n]);
+	for (int v = 0; v < m_n; ++v) {
+		m_distance[v].store(-1, memory_order_relaxed);
+	}
+	m_parent.assign(m_n, nullptr);
+	m_frontierBits.assign((m_n + 63) / 64, 0);
+}
+
+void BreadthFirstSearch::run(node s) {
+	OGDF_ASSERT(s->graphOf() == &m_G);
+
+	for (int v : m_order) {
+		m_distance[v].store(-1, memory_order_relaxed);
+		m_parent[v] = nullptr;
+	}
+	m_order.clear();
+	m_levelBegin.assign(1, 0);
+
+	auto outDegree = [&](int v) { return m_outBegin[v + 1] - m_outBegin[v]; };
+
+	m_distance[s->index()].store(0, memory_order_relaxed);
+	m_order.push_back(s->index());
+	int64_t unexploredArcs = m_outBegin[m_n] - outDegree(s->index());
+
+	std::vector<std::vector<int>> next(m_maxThreads);
+	bool bottomUp = false;
+	for (int level = 0;; ++level) {
+		const int begin = m_levelBegin.back();
+		const int end = static_cast<int>(m_order.size());
+		if (begin == end) {
+			break;
+		}
+		m_levelBegin.push_back(end);
+
+		int64_t frontierArcs = 0;
+		for (int i = begin; i < end; ++i) {
+			frontierArcs += outDegree(m_order[i]);
+		}
+		if (m_directionOptimizing) {
+			if (!bottomUp) {
+				bottomUp = frontierArcs > unexploredArcs / c_alpha;
+			} else {
+				bottomUp = end - begin >= m_G.numberOfNodes() / c_beta;
+			}
+		}
+
+		// a bottom-up step scans all nodes and the arcs of the unvisited ones
+		int64_t work = bottomUp ? m_n + unexploredArcs : frontierArcs;
+		unsigned int nThreads = static_cast<unsigned int>(min<int64_t>(m_maxThreads,
+				max<int64_t>(1, work / c_minArcsPerThread)));
+
+		expand(level, bottomUp, nThreads, next);
+
+		for (unsigned int t = 0; t < nThreads; ++t) {
+			for (int v : next[t]) {
+				unexploredArcs -= outDegree(v);
+				m_order.push_back(v);
+			}
+			next[t].clear();
+		}
+	}
+}
+
+void BreadthFirstSearch::expand(int level, bool bottomUp, unsigned int nThreads,
+		std::vector<std::vector<int>>& next) {
+	const int begin = m_levelBegin[level];
+	const int end = m_levelBegin[level + 1];
+	std::function<void(unsigned int)> worker;
+
+	// the workers run after the branches below, so everything they share is declared here
+	const std::vector<int>& inBegin = m_directed ? m_inBegin : m_outBegin;
+	const std::vector<int>& inTail = m_directed ? m_inTail : m_outHead;
+	const std::vector<edge>& inEdge = m_directed ? m_inEdge : m_outEdge;
+	const int64_t words = static_cast<int64_t>(m_frontierBits.size());
+	const int c_chunkSize = 64;
+	std::atomic<int> nextChunk(begin);
+
+	if (bottomUp) {
+		for (int i = begin; i < end; ++i) {
+			m_frontierBits[m_order[i] / 64] |= uint64_t(1) << (m_order[i] % 64);
+		}
+
+		// every thread handles a range of node indices, aligned to the words of the bitset
+		worker = [&, level](unsigned int id) {
+			auto bound = [&](unsigned int i) {
+				return static_cast<int>(min<int64_t>(m_n, 64 * (words * i / nThreads)));
+			};
+			const int first = bound(id), last = bound(id + 1);
+			for (int v = first; v < last; ++v) {
+				if (m_nodes[v] == nullptr || m_distance[v].load(memory_order_relaxed) >= 0) {
+					continue;
+				}
+				for (int j = inBegin[v]; j < inBegin[v + 1]; ++j) {
+					const int u = inTail[j];
+					if (m_frontierBits[u / 64] & (uint64_t(1) << (u % 64))) {
+						m_distance[v].store(level + 1, memory_order_relaxed);
+						m_parent[v] = inEdge[j];
+						next[id].push_back(v);
+						break;
+					}
+				}
+			}
+		};
+	} else {
+		// threads take chunks of the frontier; nodes are claimed by compare-and-swap
+		worker = [&, level](unsigned int id) {
+			for (int first; (first = nextChunk.fetch_add(c_chunkSize)) < end;) {
+				const int last = min(end, first + c_chunkSize);
+				for (int i = first; i < last; ++i) {
+					const int u = m_order[i];
+					for (int j = m_outBegin[u]; j < m_outBegin[u + 1]; ++j) {
+						const int v = m_outHead[j];
+						if (m_distance[v].load(memory_order_relaxed) >= 0) {
+							continue;
+						}
+						if (nThreads == 1) {
+							m_distance[v].store(level + 1, memory_order_relaxed);
+						} else {
+							int unreached = -1;
+							if (!m_distance[v].compare_exchange_strong(unreached, level + 1,
+										memory_order_relaxed)) {
+								continue;
+							}
+						}
+						m_parent[v] = m_outEdge[j];
+						next[id].push_back(v);
+					}
+				}
+			}
+		};
+	}
+
+	internal::runThreads(nThreads, worker);
+
+	if (bottomUp) {
+		for (int i = begin; i < end; ++i) {
+			m_frontierBits[m_order[i] / 64] = 0;
+		}
+	}
+}
+
+void BreadthFirstSearch::distances(NodeArray<int>& distance) const {
+	distance.init(m_G, -1);
+	for (int v : m_order) {
+		distance[m_nodes[v]] = m_distance[v].load(memory_order_relaxed);
+	}
+}
+
+void BreadthFirstSearch::parents(NodeArray<edge>& parent) const {
+	parent.init(m_G, nullptr);
+	for (int v : m_order) {
+		parent[m_nodes[v]] = m_parent[v];
+	}
+}
+
+}
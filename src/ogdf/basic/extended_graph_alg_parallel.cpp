@@ -0,0 +1,188 @@
+/** \file
+ * \brief Implementation of the parallel minimum spanning forest computation.
+ *
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.md in the OGDF root directory for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, see
+ * http://www.gnu.org/copyleft/gpl.html
+ */
+
+#include <ogdf/basic/Array.h>
+#include <ogdf/basic/ConcurrentDisjointSets.h>
+#include <ogdf/basic/DisjointSets.h>
+#include <ogdf/basic/EdgeArray.h>
+#include <ogdf/basic/Graph.h>
+#include <ogdf/basic/GraphList.h>
+#include <ogdf/basic/basic.h>
+#include <ogdf/basic/extended_graph_alg.h>
+#include <ogdf/basic/internal/parallel.h>
+
+#include <atomic>
+#include <climits>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace ogdf {
+
+using std::memory_order_relaxed;
+
+namespace {
+
+//! The minimal number of nodes or edges handled by each thread.
+constexpr int64_t c_minWorkPerThread = 1 << 12;
+
+//! Returns the number of threads (at most \p maxThreads) worth using for \p work items.
+unsigned int usefulThreads(unsigned int maxThreads, int64_t work) {
+	return static_cast<unsigned int>(
+			min<int64_t>(maxThreads, max<int64_t>(1, work / c_minWorkPerThread)));
+}
+
+//! Returns the start of the \p id-th of \p parts equal ranges of [0, \p n).
+int rangeBegin(int64_t n, unsigned int id, unsigned int parts) {
+	return static_cast<int>(n * id / parts);
+}
+
+//! Lowers \p value to \p x if \p x is smaller.
+void fetchMin(std::atomic<int>& value, int x) {
+	int current = value.load(memory_order_relaxed);
+	while (x < current && !value.compare_exchange_weak(current, x, memory_order_relaxed)) { }
+}
+
+//! Kruskal's algorithm on the sorted edges.
+void kruskal(const Graph& G, const Array<edge>& order, EdgeArray<bool>& isInTree) {
+	DisjointSets<> sets(G.maxNodeIndex() + 1);
+	for (int v = 0; v <= G.maxNodeIndex(); ++v) {
+		sets.makeSet();
+	}
+	int missing = G.numberOfNodes() - 1;
+	for (edge e : order) {
+		if (missing == 0) {
+			break;
+		}
+		if (sets.quickUnion(e->source()->index(), e->target()->index())) {
+			isInTree[e] = true;
+			--missing;
+		}
+	}
+}
+
+}
+
+void internal::markMinSpanningForest(const Graph& G, const Array<edge>& order,
+		EdgeArray<bool>& isInTree, unsigned int numberOfThreads) {
+#ifdef OGDF_MEMORY_POOL_NTS
+	numberOfThreads = 1;
+#endif
+	const int m = order.size();
+	if (usefulThreads(numberOfThreads, m) <= 1) {
+		kruskal(G, order, isInTree);
+		return;
+	}
+
+	// edge k is the k-th lightest one; the edges are compared by k only
+	std::vector<int> source(m);
+	std::vector<int> target(m);
+	std::vector<int> active(m);
+	unsigned int nThreads = usefulThreads(numberOfThreads, m);
+	internal::runThreads(nThreads, [&](unsigned int id) {
+		const int last = rangeBegin(m, id + 1, nThreads);
+		for (int k = rangeBegin(m, id, nThreads); k < last; ++k) {
+			source[k] = order[k]->source()->index();
+			target[k] = order[k]->target()->index();
+			active[k] = k;
+		}
+	});
+
+	const int n = G.maxNodeIndex() + 1;
+	ConcurrentDisjointSets<> sets(n);
+	std::unique_ptr<std::atomic<int>[]> lightest(new std::atomic<int>[n]);
+	for (int v = 0; v < n; ++v) {
+		sets.makeSet();
+		lightest[v].store(INT_MAX, memory_order_relaxed);
+	}
+
+	// the components of the end nodes of active[i] at the start of the round
+	std::vector<int> sourceRoot(m);
+	std::vector<int> targetRoot(m);
+	std::vector<std::vector<int>> kept;
+
+	// Borůvka rounds: each component adds its lightest leaving edge
+	while (!active.empty()) {
+		const int a = static_cast<int>(active.size());
+		nThreads = usefulThreads(numberOfThreads, a);
+
+		internal::runThreads(nThreads, [&](unsigned int id) {
+			const int last = rangeBegin(a, id + 1, nThreads);
+			for (int i = rangeBegin(a, id, nThreads); i < last; ++i) {
+				const int k = active[i];
+				const int u = sets.find(source[k]);
+				const int v = sets.find(target[k]);
+				sourceRoot[i] = u;
+				targetRoot[i] = v;
+				if (u != v) {
+					fetchMin(lightest[u], k);
+					fetchMin(lightest[v], k);
+				}
+			}
+		});
+
+		// with distinct ranks, the chosen edges form a forest, so each union succeeds
+		internal::runThreads(nThreads, [&](unsigned int id) {
+			const int last = rangeBegin(a, id + 1, nThreads);
+			for (int i = rangeBegin(a, id, nThreads); i < last; ++i) {
+				const int k = active[i];
+				const int u = sourceRoot[i];
+				const int v = targetRoot[i];
+				if (u != v
+						&& (lightest[u].load(memory_order_relaxed) == k
+								|| lightest[v].load(memory_order_relaxed) == k)) {
+					isInTree[order[k]] = true;
+					sets.quickUnion(u, v);
+				}
+			}
+		});
+
+		// reset the lightest edges and keep only the edges still leaving a component
+		kept.assign(nThreads, std::vector<int>());
+		internal::runThreads(nThreads, [&](unsigned int id) {
+			const int last = rangeBegin(a, id + 1, nThreads);
+			for (int i = rangeBegin(a, id, nThreads); i < last; ++i) {
+				lightest[sourceRoot[i]].store(INT_MAX, memory_order_relaxed);
+				lightest[targetRoot[i]].store(INT_MAX, memory_order_relaxed);
+				const int k = active[i];
+				if (sourceRoot[i] != targetRoot[i]
+						&& sets.find(source[k]) != sets.find(target[k])) {
+					kept[id].push_back(k);
+				}
+			}
+		});
+		active.clear();
+		for (const std::vector<int>& part : kept) {
+			active.insert(active.end(), part.begin(), part.end());
+		}
+	}
+}
+
+}
@@ -0,0 +1,662 @@
+/** \file
+ * \brief Implementation of the parallel connectivity algorithms of
+ * simple_graph_alg.h.
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.md in the OGDF root directory for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, see
+ * http://www.gnu.org/copyleft/gpl.html
+ */
+
+#include <ogdf/basic/Array.h>
+#include <ogdf/basic/ArrayBuffer.h>
+#include <ogdf/basic/BreadthFirstSearch.h>
+#include <ogdf/basic/ConcurrentDisjointSets.h>
+#include <ogdf/basic/EdgeArray.h>
+#include <ogdf/basic/Graph.h>
+#include <ogdf/basic/List.h>
+#include <ogdf/basic/Math.h>
+#include <ogdf/basic/basic.h>
+#include <ogdf/basic/internal/parallel.h>
+#include <ogdf/basic/simple_graph_alg.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace ogdf {
+
+using std::memory_order_relaxed;
+
+namespace {
+
+//! The minimal number of nodes or edges handled by each thread.
+constexpr int64_t c_minWorkPerThread = 1 << 12;
+
+//! Returns the number of threads (at most \p maxThreads) worth using for \p work items.
+unsigned int usefulThreads(unsigned int maxThreads, int64_t work) {
+	return static_cast<unsigned int>(
+			min<int64_t>(maxThreads, max<int64_t>(1, work / c_minWorkPerThread)));
+}
+
+//! Returns the start of the \p id-th of \p parts equal ranges of [0, \p n).
+int rangeBegin(int64_t n, unsigned int id, unsigned int parts) {
+	return static_cast<int>(n * id / parts);
+}
+
+//! Forward-backward algorithm with trimming for strongly connected components.
+class ParallelStrongComponents {
+public:
+	ParallelStrongComponents(const Graph& G, unsigned int maxThreads);
+
+	//! Computes the components; returns a representative (index) for each node index.
+	const std::vector<int>& run();
+
+private:
+	//! Subproblem: the nodes of #nodes are exactly the active nodes of color #color.
+	struct Task {
+		std::vector<int> nodes;
+		int color;
+	};
+
+	//! Subproblems with fewer nodes are solved with Tarjan's algorithm.
+	static constexpr int c_sequentialSize = 256;
+
+	static constexpr int c_done = -1; //!< Color of the nodes with known component.
+
+	const Graph& m_G;
+	int m_n;
+	unsigned int m_maxThreads;
+
+	std::vector<int> m_outBegin, m_outHead; //!< Outgoing arcs.
+	std::vector<int> m_inBegin, m_inTail; //!< Incoming arcs.
+
+	std::unique_ptr<std::atomic<int>[]> m_color;
+	std::unique_ptr<std::atomic<unsigned char>[]> m_mark; //!< Bit 1: forward, bit 2: backward.
+	std::vector<int> m_representative;
+	std::vector<int> m_index, m_lowLink; //!< For Tarjan's algorithm.
+	std::atomic<int> m_nextColor {1};
+
+	std::vector<Task> m_tasks;
+	int m_busy = 0; //!< Number of tasks being processed.
+	std::mutex m_mutex;
+	std::condition_variable m_changed;
+
+	int color(int v) const { return m_color[v].load(memory_order_relaxed); }
+
+	void setComponent(int v, int representative) {
+		m_representative[v] = representative;
+		m_color[v].store(c_done, memory_order_relaxed);
+	}
+
+	//! Removes nodes without active predecessors or successors; returns the remaining nodes.
+	std::vector<int> trim();
+
+	//! Marks the nodes of color \p c reachable from (or reaching) \p s, using several threads.
+	void reachParallel(int s, int c, bool forward);
+
+	//! Marks the nodes of color \p c reachable from (or reaching) \p s.
+	void reach(int s, int c, bool forward, std::vector<int>& queue);
+
+	//! Solves \p task with pivot \p s; returns the remaining subproblems.
+	void split(Task& task, int s, bool parallel, std::vector<Task>& subtasks);
+
+	//! Solves \p task with Tarjan's algorithm.
+	void tarjan(const Task& task);
+
+	//! Processes tasks until all are done.
+	void worker();
+};
+
+ParallelStrongComponents::ParallelStrongComponents(const Graph& G, unsigned int maxThreads)
+	: m_G(G), m_n(G.maxNodeIndex() + 1), m_maxThreads(maxThreads) {
+	m_outBegin.assign(m_n + 1, 0);
+	m_inBegin.assign(m_n + 1, 0);
+	for (edge e : G.edges) {
+		++m_outBegin[e->source()->index() + 1];
+		++m_inBegin[e->target()->index() + 1];
+	}
+	for (int v = 0; v < m_n; ++v) {
+		m_outBegin[v + 1] += m_outBegin[v];
+		m_inBegin[v + 1] += m_inBegin[v];
+	}
+	m_outHead.resize(m_outBegin[m_n]);
+	m_inTail.resize(m_inBegin[m_n]);
+	for (node v : G.nodes) {
+		int out = m_outBegin[v->index()];
+		int in = m_inBegin[v->index()];
+		for (adjEntry adj : v->adjEntries) {
+			if (adj->isSource()) {
+				m_outHead[out++] = adj->twinNode()->index();
+			} else {
+				m_inTail[in++] = adj->twinNode()->index();
+			}
+		}
+	}
+
+	// unused indices are done from the start
+	m_color.reset(new std::atomic<int>[m_n]);
+	m_mark.reset(new std::atomic<unsigned char>[m_n]);
+	for (int v = 0; v < m_n; ++v) {
+		m_color[v].store(c_done, memory_order_relaxed);
+		m_mark[v].store(0, memory_order_relaxed);
+	}
+	for (node v : G.nodes) {
+		m_color[v->index()].store(0, memory_order_relaxed);
+	}
+	m_representative.assign(m_n, -1);
+	m_index.assign(m_n, -1);
+	m_lowLink.resize(m_n);
+}
+
+const std::vector<int>& ParallelStrongComponents::run() {
+	Task all {trim(), 0};
+	if (all.nodes.empty()) {
+		return m_representative;
+	}
+
+	// the pivot of maximal degree probably lies in a giant component
+	int pivot = all.nodes.front();
+	auto degreeProduct = [&](int v) {
+		return int64_t(m_outBegin[v + 1] - m_outBegin[v]) * (m_inBegin[v + 1] - m_inBegin[v]);
+	};
+	for (int v : all.nodes) {
+		if (degreeProduct(v) > degreeProduct(pivot)) {
+			pivot = v;
+		}
+	}
+	split(all, pivot, true, m_tasks);
+
+	internal::runThreads(m_maxThreads, [this](unsigned int) { worker(); });
+	return m_representative;
+}
+
+std::vector<int> ParallelStrongComponents::trim() {
+	std::unique_ptr<std::atomic<int>[]> inDegree(new std::atomic<int>[m_n]);
+	std::unique_ptr<std::atomic<int>[]> outDegree(new std::atomic<int>[m_n]);
+	std::vector<int> removed;
+	for (node v : m_G.nodes) {
+		int in = 0, out = 0;
+		for (adjEntry adj : v->adjEntries) {
+			if (adj->twinNode() != v) {
+				++(adj->isSource() ? out : in);
+			}
+		}
+		inDegree[v->index()].store(in, memory_order_relaxed);
+		outDegree[v->index()].store(out, memory_order_relaxed);
+		if (in == 0 || out == 0) {
+			setComponent(v->index(), v->index());
+			removed.push_back(v->index());
+		}
+	}
+
+	// a node is removed by the thread that decrements one of its degrees to zero
+	std::vector<std::vector<int>> next(m_maxThreads);
+	while (!removed.empty()) {
+		const unsigned int nThreads = usefulThreads(m_maxThreads, removed.size());
+		internal::runThreads(nThreads, [&](unsigned int id) {
+			auto decrement = [&](std::atomic<int>& degree, int w) {
+				int active = 0;
+				if (degree.fetch_sub(1, memory_order_relaxed) == 1
+						&& m_color[w].compare_exchange_strong(active, c_done)) {
+					m_representative[w] = w;
+					next[id].push_back(w);
+				}
+			};
+			const int last = rangeBegin(removed.size(), id + 1, nThreads);
+			for (int i = rangeBegin(removed.size(), id, nThreads); i < last; ++i) {
+				const int v = removed[i];
+				for (int j = m_outBegin[v]; j < m_outBegin[v + 1]; ++j) {
+					if (m_outHead[j] != v) {
+						decrement(inDegree[m_outHead[j]], m_outHead[j]);
+					}
+				}
+				for (int j = m_inBegin[v]; j < m_inBegin[v + 1]; ++j) {
+					if (m_inTail[j] != v) {
+						decrement(outDegree[m_inTail[j]], m_inTail[j]);
+					}
+				}
+			}
+		});
+
+		removed.clear();
+		for (unsigned int t = 0; t < nThreads; ++t) {
+			removed.insert(removed.end(), next[t].begin(), next[t].end());
+			next[t].clear();
+		}
+	}
+
+	std::vector<int> remaining;
+	for (node v : m_G.nodes) {
+		if (color(v->index()) == 0) {
+			remaining.push_back(v->index());
+		}
+	}
+	return remaining;
+}
+
+void ParallelStrongComponents::reachParallel(int s, int c, bool forward) {
+	const std::vector<int>& begin = forward ? m_outBegin : m_inBegin;
+	const std::vector<int>& head = forward ? m_outHead : m_inTail;
+	const unsigned char bit = forward ? 1 : 2;
+
+	std::vector<int> frontier {s};
+	m_mark[s].fetch_or(bit, memory_order_relaxed);
+	std::vector<std::vector<int>> next(m_maxThreads);
+	while (!frontier.empty()) {
+		const unsigned int nThreads = usefulThreads(m_maxThreads, frontier.size());
+		internal::runThreads(nThreads, [&](unsigned int id) {
+			const int last = rangeBegin(frontier.size(), id + 1, nThreads);
+			for (int i = rangeBegin(frontier.size(), id, nThreads); i < last; ++i) {
+				const int v = frontier[i];
+				for (int j = begin[v]; j < begin[v + 1]; ++j) {
+					const int w = head[j];
+					if (color(w) == c && !(m_mark[w].load(memory_order_relaxed) & bit)
+							&& !(m_mark[w].fetch_or(bit, memory_order_relaxed) & bit)) {
+						next[id].push_back(w);
+					}
+				}
+			}
+		});
+
+		frontier.clear();
+		for (unsigned int t = 0; t < nThreads; ++t) {
+			frontier.insert(frontier.end(), next[t].begin(), next[t].end());
+			next[t].clear();
+		}
+	}
+}
+
+void ParallelStrongComponents::reach(int s, int c, bool forward, std::vector<int>& queue) {
+	const std::vector<int>& begin = forward ? m_outBegin : m_inBegin;
+	const std::vector<int>& head = forward ? m_outHead : m_inTail;
+	const unsigned char bit = forward ? 1 : 2;
+
+	// only the owner of the task changes the marks of its nodes
+	queue.assign(1, s);
+	m_mark[s].fetch_or(bit, memory_order_relaxed);
+	for (size_t i = 0; i < queue.size(); ++i) {
+		const int v = queue[i];
+		for (int j = begin[v]; j < begin[v + 1]; ++j) {
+			const int w = head[j];
+			unsigned char mark = m_mark[w].load(memory_order_relaxed);
+			if (color(w) == c && !(mark & bit)) {
+				m_mark[w].store(mark | bit, memory_order_relaxed);
+				queue.push_back(w);
+			}
+		}
+	}
+}
+
+void ParallelStrongComponents::split(Task& task, int s, bool parallel,
+		std::vector<Task>& subtasks) {
+	if (parallel) {
+		reachParallel(s, task.color, true);
+		reachParallel(s, task.color, false);
+	} else {
+		std::vector<int> queue;
+		reach(s, task.color, true, queue);
+		reach(s, task.color, false, queue);
+	}
+
+	// split into the component of s and the nodes only reachable from s,
+	// only reaching s, and neither
+	Task part[3];
+	for (int v : task.nodes) {
+		const unsigned char mark = m_mark[v].load(memory_order_relaxed);
+		m_mark[v].store(0, memory_order_relaxed);
+		if (mark == 3) {
+			setComponent(v, s);
+		} else {
+			part[mark].nodes.push_back(v);
+		}
+	}
+	task.nodes.clear();
+
+	for (Task& t : part) {
+		if (!t.nodes.empty()) {
+			t.color = m_nextColor.fetch_add(1, memory_order_relaxed);
+			for (int v : t.nodes) {
+				m_color[v].store(t.color, memory_order_relaxed);
+			}
+			subtasks.push_back(std::move(t));
+		}
+	}
+}
+
+void ParallelStrongComponents::tarjan(const Task& task) {
+	const int c = task.color;
+	int nextIndex = 0;
+	std::vector<int> stack;
+	std::vector<std::pair<int, int>> call; // node and position of its next outgoing arc
+
+	auto visit = [&](int v) {
+		m_index[v] = m_lowLink[v] = nextIndex++;
+		stack.push_back(v);
+		call.emplace_back(v, m_outBegin[v]);
+	};
+
+	// nodes on the stack still have color c, finished nodes are done
+	for (int root : task.nodes) {
+		if (m_index[root] >= 0) {
+			continue;
+		}
+		visit(root);
+		while (!call.empty()) {
+			const int v = call.back().first;
+			const int j = call.back().second;
+			if (j < m_outBegin[v + 1]) {
+				++call.back().second;
+				const int w = m_outHead[j];
+				if (color(w) != c) {
+					continue;
+				}
+				if (m_index[w] < 0) {
+					visit(w);
+				} else {
+					Math::updateMin(m_lowLink[v], m_index[w]);
+				}
+				continue;
+			}
+
+			call.pop_back();
+			if (!call.empty()) {
+				Math::updateMin(m_lowLink[call.back().first], m_lowLink[v]);
+			}
+			if (m_lowLink[v] == m_index[v]) {
+				int w;
+				do {
+					w = stack.back();
+					stack.pop_back();
+					setComponent(w, v);
+				} while (w != v);
+			}
+		}
+	}
+}
+
+void ParallelStrongComponents::worker() {
+	std::minstd_rand random;
+	std::vector<Task> subtasks;
+	std::unique_lock<std::mutex> lock(m_mutex);
+	for (;;) {
+		m_changed.wait(lock, [&] { return !m_tasks.empty() || m_busy == 0; });
+		if (m_tasks.empty()) {
+			return;
+		}
+		Task task = std::move(m_tasks.back());
+		m_tasks.pop_back();
+		++m_busy;
+		lock.unlock();
+
+		if (static_cast<int>(task.nodes.size()) < c_sequentialSize) {
+			tarjan(task);
+		} else {
+			std::uniform_int_distribution<size_t> dist(0, task.nodes.size() - 1);
+			split(task, task.nodes[dist(random)], false, subtasks);
+		}
+
+		lock.lock();
+		for (Task& t : subtasks) {
+			m_tasks.push_back(std::move(t));
+		}
+		subtasks.clear();
+		--m_busy;
+		m_changed.notify_all();
+	}
+}
+
+}
+
+int parallelConnectedComponents(const Graph& G, NodeArray<int>& component,
+		unsigned int numberOfThreads, List<node>* isolated, ArrayBuffer<node>* reprs) {
+#ifdef OGDF_MEMORY_POOL_NTS
+	numberOfThreads = 1;
+#endif
+	if (numberOfThreads <= 1) {
+		return connectedComponents(G, component, isolated, reprs);
+	}
+
+	const int n = G.maxNodeIndex() + 1;
+	std::vector<std::pair<int, int>> arcs;
+	arcs.reserve(G.numberOfEdges());
+	for (edge e : G.edges) {
+		arcs.emplace_back(e->source()->index(), e->target()->index());
+	}
+
+	ConcurrentDisjointSets<> sets(n);
+	for (int v = 0; v < n; ++v) {
+		sets.makeSet();
+	}
+	unsigned int nThreads = usefulThreads(numberOfThreads, arcs.size());
+	internal::runThreads(nThreads, [&](unsigned int id) {
+		const int last = rangeBegin(arcs.size(), id + 1, nThreads);
+		for (int i = rangeBegin(arcs.size(), id, nThreads); i < last; ++i) {
+			sets.quickUnion(arcs[i].first, arcs[i].second);
+		}
+	});
+
+	std::vector<int> root(n);
+	nThreads = usefulThreads(numberOfThreads, n);
+	internal::runThreads(nThreads, [&](unsigned int id) {
+		const int last = rangeBegin(n, id + 1, nThreads);
+		for (int v = rangeBegin(n, id, nThreads); v < last; ++v) {
+			root[v] = sets.find(v);
+		}
+	});
+
+	// number the components by their first node, like connectedComponents()
+	std::vector<int> number(n, -1);
+	int nComponent = 0;
+	component.init(G);
+	for (node v : G.nodes) {
+		int& c = number[root[v->index()]];
+		if (c < 0) {
+			c = nComponent++;
+			if (reprs != nullptr) {
+				reprs->push(v);
+			}
+		}
+		if (isolated != nullptr && v->degree() == 0) {
+			isolated->pushBack(v);
+		}
+		component[v] = c;
+	}
+
+	return nComponent;
+}
+
+int parallelBiconnectedComponents(const Graph& G, EdgeArray<int>& component,
+		int& nonEmptyComponents, unsigned int numberOfThreads) {
+#ifdef OGDF_MEMORY_POOL_NTS
+	numberOfThreads = 1;
+#endif
+	if (numberOfThreads <= 1) {
+		return biconnectedComponents(G, component, nonEmptyComponents);
+	}
+
+	nonEmptyComponents = 0;
+	if (G.empty()) {
+		return 0;
+	}
+
+	// rooted spanning forest; order contains the nodes of every tree top-down
+	const int n = G.maxNodeIndex() + 1;
+	std::vector<int> order, parent(n, -1);
+	std::vector<edge> parentEdge(n, nullptr);
+	std::vector<char> visited(n, false);
+	order.reserve(G.numberOfNodes());
+	BreadthFirstSearch bfs(G);
+	bfs.maxThreads(numberOfThreads);
+	for (node r : G.nodes) {
+		if (visited[r->index()]) {
+			continue;
+		}
+		bfs.run(r);
+		for (int i = 0; i < bfs.numberOfReachedNodes(); ++i) {
+			node v = bfs.reachedNode(i);
+			edge e = bfs.parent(v);
+			visited[v->index()] = true;
+			order.push_back(v->index());
+			parentEdge[v->index()] = e;
+			if (e != nullptr) {
+				parent[v->index()] = e->opposite(v)->index();
+			}
+		}
+	}
+
+	// subtree sizes bottom-up, preorder numbers top-down;
+	// the subtree of v consists of the nodes with preorder numbers in [pre[v], pre[v] + size[v])
+	std::vector<int> size(n, 1), pre(n), nextChild(n);
+	for (auto it = order.rbegin(); it != order.rend(); ++it) {
+		if (parent[*it] >= 0) {
+			size[parent[*it]] += size[*it];
+		}
+	}
+	int nIsolated = 0;
+	int nextRoot = 0;
+	for (int v : order) {
+		if (parent[v] < 0) {
+			pre[v] = nextRoot;
+			nextRoot += size[v];
+			if (size[v] == 1) {
+				++nIsolated;
+			}
+		} else {
+			pre[v] = nextChild[parent[v]];
+			nextChild[parent[v]] += size[v];
+		}
+		nextChild[v] = pre[v] + 1;
+	}
+
+	// lowest and highest preorder number adjacent to each subtree
+	std::vector<node> nodeOf(n, nullptr);
+	for (node v : G.nodes) {
+		nodeOf[v->index()] = v;
+	}
+	std::vector<int> low(n), high(n);
+	unsigned int nThreads = usefulThreads(numberOfThreads, G.numberOfEdges());
+	internal::runThreads(nThreads, [&](unsigned int id) {
+		const int last = rangeBegin(order.size(), id + 1, nThreads);
+		for (int i = rangeBegin(order.size(), id, nThreads); i < last; ++i) {
+			const int v = order[i];
+			low[v] = high[v] = pre[v];
+			for (adjEntry adj : nodeOf[v]->adjEntries) {
+				const int w = adj->twinNode()->index();
+				Math::updateMin(low[v], pre[w]);
+				Math::updateMax(high[v], pre[w]);
+			}
+		}
+	});
+	for (auto it = order.rbegin(); it != order.rend(); ++it) {
+		if (parent[*it] >= 0) {
+			Math::updateMin(low[parent[*it]], low[*it]);
+			Math::updateMax(high[parent[*it]], high[*it]);
+		}
+	}
+
+	// node v represents the tree edge to its parent
+	auto isAncestor = [&](int u, int w) { return pre[u] <= pre[w] && pre[w] < pre[u] + size[u]; };
+	std::vector<edge> edges;
+	edges.reserve(G.numberOfEdges());
+	for (edge e : G.edges) {
+		edges.push_back(e);
+	}
+	ConcurrentDisjointSets<> sets(n);
+	for (int v = 0; v < n; ++v) {
+		sets.makeSet();
+	}
+	internal::runThreads(nThreads, [&](unsigned int id) {
+		const int last = rangeBegin(edges.size(), id + 1, nThreads);
+		for (int i = rangeBegin(edges.size(), id, nThreads); i < last; ++i) {
+			edge e = edges[i];
+			int u = e->source()->index();
+			int w = e->target()->index();
+			if (e == parentEdge[u]) {
+				std::swap(u, w);
+			}
+			if (e == parentEdge[w]) {
+				// the tree edge above u is in the same block if the subtree of w
+				// has a neighbor outside the subtree of u
+				if (parent[u] >= 0 && (low[w] < pre[u] || high[w] >= pre[u] + size[u])) {
+					sets.quickUnion(w, u);
+				}
+			} else if (u != w && !isAncestor(u, w) && !isAncestor(w, u)) {
+				sets.quickUnion(u, w);
+			}
+		}
+	});
+
+	// a non-tree edge belongs to the block of the tree edge above its lower end node
+	std::vector<int> number(n, -1);
+	int nComponent = 0;
+	component.init(G);
+	for (edge e : G.edges) {
+		if (e->isSelfLoop()) {
+			component[e] = nComponent++;
+			continue;
+		}
+		int u = e->source()->index();
+		int w = e->target()->index();
+		int& c = number[sets.find(pre[u] > pre[w] ? u : w)];
+		if (c < 0) {
+			c = nComponent++;
+		}
+		component[e] = c;
+	}
+
+	nonEmptyComponents = nComponent;
+	return nComponent + nIsolated;
+}
+
+int parallelStrongComponents(const Graph& G, NodeArray<int>& component,
+		unsigned int numberOfThreads) {
+#ifdef OGDF_MEMORY_POOL_NTS
+	numberOfThreads = 1;
+#endif
+	if (numberOfThreads <= 1) {
+		return strongComponents(G, component);
+	}
+
+	ParallelStrongComponents scc(G, numberOfThreads);
+	const std::vector<int>& representative = scc.run();
+
+	std::vector<int> number(G.maxNodeIndex() + 1, -1);
+	int nComponent = 0;
+	component.init(G);
+	for (node v : G.nodes) {
+		int& c = number[representative[v->index()]];
+		if (c < 0) {
+			c = nComponent++;
+		}
+		component[v] = c;
+	}
+	return nComponent;
+}
+
+}
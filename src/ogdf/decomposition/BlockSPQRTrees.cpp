@@ -0,0 +1,74 @@
+/** \file
+ * \brief Implementation of ogdf::buildSPQRTrees().
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.md in the OGDF root directory for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, see
+ * http://www.gnu.org/copyleft/gpl.html
+ */
+
+#include <ogdf/basic/Array.h>
+#include <ogdf/basic/ArrayBuffer.h>
+#include <ogdf/basic/Graph.h>
+#include <ogdf/basic/GraphList.h>
+#include <ogdf/basic/basic.h>
+#include <ogdf/basic/comparer.h>
+#include <ogdf/basic/internal/parallel.h>
+#include <ogdf/decomposition/BlockSPQRTrees.h>
+#include <ogdf/decomposition/StaticSPQRTree.h>
+
+#include <atomic>
+
+namespace ogdf {
+
+void buildSPQRTrees(const NodeArrayP<Graph>& blockGraphs, NodeArray<StaticSPQRTree*>& spqrTrees,
+		unsigned int maxThreads) {
+	const Graph& tree = *blockGraphs.graphOf();
+	spqrTrees.init(tree, nullptr);
+
+	ArrayBuffer<node> blocks;
+	for (node v : tree.nodes) {
+		const Graph* block = blockGraphs[v].get();
+		if (block != nullptr && block->numberOfNodes() > 1 && block->numberOfEdges() > 2) {
+			blocks.push(v);
+		}
+	}
+	blocks.quicksort(GenericComparer<node, int, false>(
+			[&](node v) { return blockGraphs[v]->numberOfEdges(); }));
+
+	const int n = blocks.size();
+#ifdef OGDF_MEMORY_POOL_NTS
+	const unsigned int threads = 1;
+#else
+	const unsigned int threads = min(max(1u, maxThreads), static_cast<unsigned int>(max(1, n)));
+#endif
+	std::atomic<int> next(0);
+	internal::runThreads(threads, [&](unsigned int) {
+		for (int i = next++; i < n; i = next++) {
+			node v = blocks[i];
+			spqrTrees[v] = new StaticSPQRTree(*blockGraphs[v]);
+		}
+	});
+}
+
+}
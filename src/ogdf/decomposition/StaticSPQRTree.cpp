@@ -41,6 +41,7 @@
 #include <ogdf/decomposition/StaticSkeleton.h>
 #include <ogdf/graphalg/Triconnectivity.h>
 
+#include <tuple>
 #include <utility>
 
 namespace ogdf {
@@ -226,22 +227,29 @@ node StaticSPQRTree::rootTreeAt(node v) {
 }
 
 void StaticSPQRTree::rootRec(node v, edge eFather) {
-	for (adjEntry adj : v->adjEntries) {
-		edge e = adj->theEdge();
+	ArrayBuffer<std::pair<node, edge>> stack;
+	stack.push({v, eFather});
 
-		if (e == eFather) {
-			continue;
-		}
+	while (!stack.empty()) {
+		std::tie(v, eFather) = stack.popRet();
 
-		node w = e->target();
-		if (w == v) {
-			m_tree.reverseEdge(e);
-			std::swap(m_skEdgeSrc[e], m_skEdgeTgt[e]);
-			w = e->target();
-		}
+		for (adjEntry adj : v->adjEntries) {
+			edge e = adj->theEdge();
+
+			if (e == eFather) {
+				continue;
+			}
+
+			node w = e->target();
+			if (w == v) {
+				m_tree.reverseEdge(e);
+				std::swap(m_skEdgeSrc[e], m_skEdgeTgt[e]);
+				w = e->target();
+			}
 
-		m_sk[w]->m_referenceEdge = m_skEdgeTgt[e];
-		rootRec(w, e);
+			m_sk[w]->m_referenceEdge = m_skEdgeTgt[e];
+			stack.push({w, e});
+		}
 	}
 }
 
@@ -30,6 +30,7 @@
  */
 
 #include <ogdf/basic/Array.h>
+#include <ogdf/basic/BreadthFirstSearch.h>
 #include <ogdf/basic/Graph.h>
 #include <ogdf/basic/GraphAttributes.h>
 #include <ogdf/basic/GraphCopy.h>
@@ -262,6 +263,7 @@ void PivotMDS::getPivotDistanceMatrix(const GraphAttributes& GA, Array<Array<dou
 	NodeArray<double> shortestPathSingleSource(G);
 	// the current pivot node
 	node pivNode = G.firstNode();
+	BreadthFirstSearch bfs(G);
 	for (int i = 0; i < numberOfPivots; i++) {
 		// get the shortest path from the currently processed pivot node to
 		// all other nodes in the graph
@@ -269,7 +271,7 @@ void PivotMDS::getPivotDistanceMatrix(const GraphAttributes& GA, Array<Array<dou
 		if (hasEdgeCosts) {
 			dijkstra_SPSS(pivNode, G, shortestPathSingleSource, edgeCosts);
 		} else {
-			bfs_SPSS(pivNode, G, shortestPathSingleSource, m_edgeCosts);
+			bfs_SPSS(pivNode, bfs, shortestPathSingleSource, m_edgeCosts);
 		}
 		copySPSS(pivDistMatrix[i], shortestPathSingleSource);
 		// update the pivot and the minDistances array ... to ensure the
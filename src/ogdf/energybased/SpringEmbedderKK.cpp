@@ -29,12 +29,12 @@
  * http://www.gnu.org/copyleft/gpl.html
  */
 
+#include <ogdf/basic/BreadthFirstSearch.h>
 #include <ogdf/basic/EpsilonTest.h>
 #include <ogdf/basic/Graph.h>
 #include <ogdf/basic/GraphAttributes.h>
 #include <ogdf/basic/GraphList.h>
 #include <ogdf/basic/Math.h>
-#include <ogdf/basic/SList.h>
 #include <ogdf/basic/basic.h>
 #include <ogdf/basic/geometry.h>
 #include <ogdf/basic/simple_graph_alg.h>
@@ -443,27 +443,14 @@ double SpringEmbedderKK::allpairsspBFS(const Graph& G, NodeArray<NodeArray<doubl
 	}
 
 	//start in each node once
+	BreadthFirstSearch bfs(G);
 	for (node v : G.nodes) {
-		//do a bfs
-		NodeArray<bool> mark(G, true);
-		SListPure<node> bfs;
-		bfs.pushBack(v);
-		mark[v] = false;
-
-		while (!bfs.empty()) {
-			node w = bfs.popFrontRet();
-			double d = distance[v][w] + 1.0f;
-
-
-			for (adjEntry adj : w->adjEntries) {
-				node u = adj->twinNode();
-				if (mark[u]) {
-					mark[u] = false;
-					bfs.pushBack(u);
-					distance[v][u] = d;
-					Math::updateMax(maxDist, d);
-				}
-			}
+		bfs.run(v);
+		for (int i = 1; i < bfs.numberOfReachedNodes(); ++i) {
+			node u = bfs.reachedNode(i);
+			double d = bfs.distance(u);
+			distance[v][u] = d;
+			Math::updateMax(maxDist, d);
 		}
 	}
 	//check for negative cycles
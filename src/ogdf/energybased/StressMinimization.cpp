@@ -30,6 +30,7 @@
  * http://www.gnu.org/copyleft/gpl.html
  */
 
+#include <ogdf/basic/BreadthFirstSearch.h>
 #include <ogdf/basic/Graph.h>
 #include <ogdf/basic/GraphAttributes.h>
 #include <ogdf/basic/GraphList.h>
@@ -79,7 +80,11 @@ void StressMinimization::call(GraphAttributes& GA) {
 		// compute shortest path all pairs
 	} else {
 		m_avgEdgeCosts = m_edgeCosts;
-		bfs_SPAP(G, shortestPathMatrix, m_edgeCosts);
+		// one search engine for all sources, as in PivotMDS
+		BreadthFirstSearch bfs(G);
+		for (node v : G.nodes) {
+			bfs_SPSS(v, bfs, shortestPathMatrix[v], m_edgeCosts);
+		}
 	}
 	call(GA, shortestPathMatrix, weightMatrix);
 }
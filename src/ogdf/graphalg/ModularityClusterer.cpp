@@ -0,0 +1,631 @@
+/** \file
+ * \brief Implementation of ogdf::ModularityClusterer
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.md in the OGDF root directory for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, see
+ * http://www.gnu.org/copyleft/gpl.html
+ */
+
+#include <ogdf/basic/Array.h>
+#include <ogdf/basic/Graph.h>
+#include <ogdf/basic/GraphList.h>
+#include <ogdf/basic/SList.h>
+#include <ogdf/basic/basic.h>
+#include <ogdf/basic/internal/parallel.h>
+#include <ogdf/cluster/ClusterGraph.h>
+#include <ogdf/graphalg/ClustererModule.h>
+#include <ogdf/graphalg/ModularityClusterer.h>
+
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace ogdf {
+
+namespace {
+
+//! A weighted graph on the nodes 0, ..., n-1 stored as adjacency arrays without self-loops.
+struct LevelGraph {
+	int n = 0; //!< The number of nodes
+	std::vector<int> offset; //!< The adjacencies of \a v are offset[v], ..., offset[v+1]-1
+	std::vector<int> target; //!< The opposite node of each adjacency
+	std::vector<double> weight; //!< The edge weight of each adjacency
+	std::vector<double> loop; //!< Twice the weight of the edges within each node
+	std::vector<double> volume; //!< The weighted degree of each node, including #loop
+};
+
+//! Per-thread buffers for summing up edge weights by the label of the opposite node.
+struct Accumulator {
+	std::vector<int> position; //!< The position of each label in #labels or -1
+	std::vector<int> labels; //!< The labels seen so far
+	std::vector<double> sums; //!< The summed up weight of each label in #labels
+
+	//! Prepares the accumulator for labels 0, ..., \p n-1.
+	void init(int n) {
+		position.assign(n, -1);
+		labels.clear();
+		sums.clear();
+	}
+
+	//! Adds \p w to the weight of \p label.
+	void add(int label, double w) {
+		if (position[label] < 0) {
+			position[label] = static_cast<int>(labels.size());
+			labels.push_back(label);
+			sums.push_back(w);
+		} else {
+			sums[position[label]] += w;
+		}
+	}
+
+	//! Returns the weight of \p label.
+	double sum(int label) const { return position[label] < 0 ? 0 : sums[position[label]]; }
+
+	//! Forgets all labels seen so far.
+	void clear() {
+		for (int label : labels) {
+			position[label] = -1;
+		}
+		labels.clear();
+		sums.clear();
+	}
+};
+
+//! Runs the Leiden algorithm on the levels of a graph.
+class Leiden {
+	//! The number of groups the nodes are divided into for local moving. The moves of the nodes
+	//! of one group are evaluated simultaneously.
+	static constexpr int s_groups = 16;
+
+	//! The maximal number of sweeps over all nodes in one local moving phase.
+	static constexpr int s_maxSweeps = 32;
+
+	//! The maximal number of aggregation levels.
+	static constexpr int s_maxLevels = 64;
+
+	//! Number of consecutive items handed to a thread at once.
+	static constexpr int s_chunkSize = 512;
+
+	double m_resolution;
+	unsigned int m_maxThreads;
+	double m_totalVolume = 0; //!< The sum of all node volumes, i.e., twice the total edge weight
+	std::vector<Accumulator> m_accumulators; //!< The buffers of the threads
+
+public:
+	Leiden(double resolution, unsigned int maxThreads)
+		: m_resolution(resolution), m_maxThreads(maxThreads) { }
+
+	/**
+	 * Computes the clustering of \p g.
+	 *
+	 * @param g The graph of the finest level; it is replaced by the coarsest level.
+	 * @param cluster Is assigned the final cluster of each node of the finest level.
+	 * @param levels Is assigned the subcluster of each node of the finest level on each
+	 *        aggregation level.
+	 * @return The number of clusters
+	 */
+	int run(LevelGraph& g, std::vector<int>& cluster, std::vector<std::vector<int>>& levels) {
+		const int n = g.n;
+		m_totalVolume = 0;
+		for (double volume : g.volume) {
+			m_totalVolume += volume;
+		}
+		std::vector<int> block(n);
+		std::vector<int> community(n);
+		for (int v = 0; v < n; ++v) {
+			block[v] = v;
+			community[v] = v;
+		}
+		levels.clear();
+
+		if (m_totalVolume > 0) {
+			std::vector<int> sub;
+			for (int level = 0; level < s_maxLevels; ++level) {
+				localMoving(g, community);
+				const int k = refine(g, community, sub);
+				if (k == g.n) {
+					break;
+				}
+				for (int& b : block) {
+					b = sub[b];
+				}
+				levels.push_back(block);
+
+				LevelGraph aggregated;
+				aggregate(g, sub, k, aggregated);
+				std::vector<int> aggregatedCommunity(k);
+				for (int v = 0; v < g.n; ++v) {
+					aggregatedCommunity[sub[v]] = community[v];
+				}
+				number(aggregatedCommunity);
+				std::swap(g, aggregated);
+				std::swap(community, aggregatedCommunity);
+			}
+		}
+
+		const int k = number(community);
+		cluster.resize(n);
+		for (int v = 0; v < n; ++v) {
+			cluster[v] = community[block[v]];
+		}
+		return k;
+	}
+
+	//! Returns the modularity of clustering \p cluster of \p g.
+	double modularity(const LevelGraph& g, const std::vector<int>& cluster, int k) const {
+		if (m_totalVolume <= 0) {
+			return 0;
+		}
+		std::vector<double> inner(k, 0);
+		std::vector<double> volume(k, 0);
+		for (int v = 0; v < g.n; ++v) {
+			const int c = cluster[v];
+			volume[c] += g.volume[v];
+			inner[c] += g.loop[v];
+			for (int j = g.offset[v]; j < g.offset[v + 1]; ++j) {
+				if (cluster[g.target[j]] == c) {
+					inner[c] += g.weight[j];
+				}
+			}
+		}
+		double q = 0;
+		for (int c = 0; c < k; ++c) {
+			q += inner[c] - m_resolution * volume[c] * volume[c] / m_totalVolume;
+		}
+		return q / m_totalVolume;
+	}
+
+private:
+	/**
+	 * Calls \p fun(begin, end, accumulator) for consecutive chunks [begin, end) of [0, \p n).
+	 * The chunks are distributed over up to #m_maxThreads threads, each of which uses its own
+	 * accumulator prepared for labels 0, ..., \p labels-1.
+	 */
+	template<typename Fun>
+	void parallelFor(int n, int labels, const Fun& fun) {
+		const unsigned int threads = internal::parallelForThreads(m_maxThreads, n, s_chunkSize);
+		if (m_accumulators.size() < threads) {
+			m_accumulators.resize(threads);
+		}
+		for (unsigned int i = 0; i < threads; ++i) {
+			if (static_cast<int>(m_accumulators[i].position.size()) != labels) {
+				m_accumulators[i].init(labels);
+			}
+		}
+		internal::parallelFor(threads, n, s_chunkSize,
+				[&](int from, int to, unsigned int i) { fun(from, to, m_accumulators[i]); });
+	}
+
+	//! Sorts the nodes by \p label into \p members, such that the nodes with label \a i are
+	//! members[first[i]], ..., members[first[i+1]-1].
+	static void group(const std::vector<int>& label, int k, std::vector<int>& first,
+			std::vector<int>& members) {
+		first.assign(k + 1, 0);
+		for (int l : label) {
+			++first[l + 1];
+		}
+		for (int i = 0; i < k; ++i) {
+			first[i + 1] += first[i];
+		}
+		std::vector<int> fill(first.begin(), first.end() - 1);
+		members.resize(label.size());
+		for (int v = 0; v < static_cast<int>(label.size()); ++v) {
+			members[fill[label[v]]++] = v;
+		}
+	}
+
+	//! Numbers the labels in \p label consecutively and returns the number of labels.
+	static int number(std::vector<int>& label) {
+		std::vector<int> numberOf(label.size(), -1);
+		int k = 0;
+		for (int& l : label) {
+			int& i = numberOf[l];
+			if (i < 0) {
+				i = k++;
+			}
+			l = i;
+		}
+		return k;
+	}
+
+	//! Returns the group of node \p v for local moving.
+	static int groupOf(int v) {
+		return static_cast<int>((static_cast<uint32_t>(v) * 2654435761u) >> 28);
+	}
+
+	//! Moves the nodes of \p g between the clusters given by \p community as long as the
+	//! modularity increases.
+	void localMoving(const LevelGraph& g, std::vector<int>& community) {
+		static_assert(s_groups == 16, "groupOf() computes 4 bit hashes");
+		std::vector<double> volume(g.n, 0);
+		std::vector<int> groupLabel(g.n);
+		for (int v = 0; v < g.n; ++v) {
+			volume[community[v]] += g.volume[v];
+			groupLabel[v] = groupOf(v);
+		}
+		std::vector<int> first, order;
+		group(groupLabel, s_groups, first, order);
+		std::vector<int> proposal(g.n);
+
+		for (int sweep = 0; sweep < s_maxSweeps; ++sweep) {
+			int moved = 0;
+			for (int i = 0; i < s_groups; ++i) {
+				const int begin = first[i];
+				parallelFor(first[i + 1] - begin, g.n, [&](int from, int to, Accumulator& acc) {
+					for (int j = begin + from; j < begin + to; ++j) {
+						proposal[order[j]] = bestCommunity(g, order[j], community, volume, acc);
+					}
+				});
+				for (int j = begin; j < first[i + 1]; ++j) {
+					const int v = order[j];
+					if (proposal[v] != community[v]) {
+						volume[community[v]] -= g.volume[v];
+						volume[proposal[v]] += g.volume[v];
+						community[v] = proposal[v];
+						++moved;
+					}
+				}
+			}
+			if (moved == 0) {
+				break;
+			}
+		}
+	}
+
+	//! Returns the cluster that \p v should belong to given the clusters \p community of all
+	//! nodes and their volumes \p volume.
+	int bestCommunity(const LevelGraph& g, int v, const std::vector<int>& community,
+			const std::vector<double>& volume, Accumulator& acc) const {
+		for (int j = g.offset[v]; j < g.offset[v + 1]; ++j) {
+			acc.add(community[g.target[j]], g.weight[j]);
+		}
+		const int own = community[v];
+		const double kv = g.volume[v];
+		const double factor = m_resolution * kv / m_totalVolume;
+		int best = own;
+		double bestGain = acc.sum(own) - factor * (volume[own] - kv);
+		const double epsilon = 1e-10 * max(1.0, kv);
+		for (size_t i = 0; i < acc.labels.size(); ++i) {
+			const int c = acc.labels[i];
+			const double gain = acc.sums[i] - factor * volume[c];
+			if (c != own && gain > bestGain + epsilon) {
+				best = c;
+				bestGain = gain;
+			}
+		}
+		acc.clear();
+		return best;
+	}
+
+	//! Splits the clusters \p community of \p g into connected subclusters \p sub and returns
+	//! the number of subclusters.
+	int refine(const LevelGraph& g, std::vector<int>& community, std::vector<int>& sub) {
+		const int k = number(community);
+		std::vector<int> first, members;
+		group(community, k, first, members);
+
+		sub.resize(g.n);
+		std::vector<double> subVolume(g.volume);
+		std::vector<int> subSize(g.n, 1);
+		for (int v = 0; v < g.n; ++v) {
+			sub[v] = v;
+		}
+		// Every cluster is refined by a single thread, which only accesses its members.
+		parallelFor(k, g.n, [&](int from, int to, Accumulator& acc) {
+			for (int c = from; c < to; ++c) {
+				for (int i = first[c]; i < first[c + 1]; ++i) {
+					const int v = members[i];
+					// only nodes that still form a subcluster of their own are moved
+					if (sub[v] != v || subSize[v] != 1) {
+						continue;
+					}
+					for (int j = g.offset[v]; j < g.offset[v + 1]; ++j) {
+						const int w = g.target[j];
+						if (community[w] == c) {
+							acc.add(sub[w], g.weight[j]);
+						}
+					}
+					const double factor = m_resolution * g.volume[v] / m_totalVolume;
+					int best = -1;
+					double bestGain = 1e-10 * max(1.0, g.volume[v]);
+					for (size_t l = 0; l < acc.labels.size(); ++l) {
+						const int s = acc.labels[l];
+						const double gain = acc.sums[l] - factor * subVolume[s];
+						if (s != v && gain > bestGain) {
+							best = s;
+							bestGain = gain;
+						}
+					}
+					acc.clear();
+					if (best >= 0) {
+						sub[v] = best;
+						subVolume[best] += g.volume[v];
+						++subSize[best];
+						subSize[v] = 0;
+					}
+				}
+			}
+		});
+		return number(sub);
+	}
+
+	//! Contracts each subcluster \p sub of \p g into a single node of \p result.
+	void aggregate(const LevelGraph& g, const std::vector<int>& sub, int k, LevelGraph& result) {
+		std::vector<int> first, members;
+		group(sub, k, first, members);
+
+		result.n = k;
+		result.offset.assign(k + 1, 0);
+		result.loop.assign(k, 0);
+		result.volume.assign(k, 0);
+
+		// Sums up the weights from the members of c to each other subcluster and calls
+		// emit(subcluster, weight) for each of them.
+		auto collect = [&](int c, Accumulator& acc, auto&& emit) {
+			for (int i = first[c]; i < first[c + 1]; ++i) {
+				const int v = members[i];
+				for (int j = g.offset[v]; j < g.offset[v + 1]; ++j) {
+					acc.add(sub[g.target[j]], g.weight[j]);
+				}
+			}
+			for (size_t i = 0; i < acc.labels.size(); ++i) {
+				if (acc.labels[i] != c) {
+					emit(acc.labels[i], acc.sums[i]);
+				}
+			}
+			const double inner = acc.sum(c);
+			acc.clear();
+			return inner;
+		};
+
+		parallelFor(k, k, [&](int from, int to, Accumulator& acc) {
+			for (int c = from; c < to; ++c) {
+				double inner = collect(c, acc, [&](int, double) { ++result.offset[c + 1]; });
+				for (int i = first[c]; i < first[c + 1]; ++i) {
+					inner += g.loop[members[i]];
+					result.volume[c] += g.volume[members[i]];
+				}
+				result.loop[c] = inner;
+			}
+		});
+		for (int c = 0; c < k; ++c) {
+			result.offset[c + 1] += result.offset[c];
+		}
+		result.target.resize(result.offset[k]);
+		result.weight.resize(result.offset[k]);
+		parallelFor(k, k, [&](int from, int to, Accumulator& acc) {
+			for (int c = from; c < to; ++c) {
+				int pos = result.offset[c];
+				collect(c, acc, [&](int d, double w) {
+					result.target[pos] = d;
+					result.weight[pos++] = w;
+				});
+			}
+		});
+	}
+};
+
+}
+
+ModularityClusterer::ModularityClusterer(const Graph& G) : ClustererModule(G) { }
+
+ModularityClusterer::ModularityClusterer() {
+	m_pGraph = nullptr;
+}
+
+void ModularityClusterer::compute() {
+	OGDF_ASSERT(m_pGraph != nullptr);
+	// the graph of a ClustererModule can be replaced without notice
+	if (m_computed && m_changes.getGraph() == m_pGraph) {
+		return;
+	}
+	m_changes.reregister(m_pGraph);
+	const Graph& G = *m_pGraph;
+	const int n = G.numberOfNodes();
+
+	NodeArray<int> index(G);
+	int i = 0;
+	for (node v : G.nodes) {
+		index[v] = i++;
+	}
+
+	LevelGraph g;
+	g.n = n;
+	g.offset.assign(n + 1, 0);
+	g.loop.assign(n, 0);
+	g.volume.assign(n, 0);
+	for (node v : G.nodes) {
+		for (adjEntry adj : v->adjEntries) {
+			if (adj->twinNode() != v) {
+				++g.offset[index[v] + 1];
+			}
+		}
+	}
+	for (int v = 0; v < n; ++v) {
+		g.offset[v + 1] += g.offset[v];
+	}
+	g.target.resize(g.offset[n]);
+	g.weight.resize(g.offset[n]);
+	for (node v : G.nodes) {
+		const int iv = index[v];
+		int pos = g.offset[iv];
+		for (adjEntry adj : v->adjEntries) {
+			const double w = m_weights == nullptr ? 1.0 : (*m_weights)[adj->theEdge()];
+			OGDF_ASSERT(w >= 0);
+			g.volume[iv] += w;
+			if (adj->twinNode() == v) {
+				// both adjacency entries of a self-loop are visited
+				g.loop[iv] += w;
+			} else {
+				g.target[pos] = index[adj->twinNode()];
+				g.weight[pos++] = w;
+			}
+		}
+	}
+
+	Leiden leiden(m_resolution, m_maxThreads);
+	LevelGraph coarsest = g;
+	std::vector<int> clusterOf;
+	m_numberOfClusters = leiden.run(coarsest, clusterOf, m_levels);
+	m_modularity = leiden.modularity(g, clusterOf, m_numberOfClusters);
+
+	m_cluster.init(G);
+	for (node v : G.nodes) {
+		m_cluster[v] = clusterOf[index[v]];
+	}
+	m_computed = true;
+}
+
+const NodeArray<int>& ModularityClusterer::clusters() {
+	compute();
+	return m_cluster;
+}
+
+int ModularityClusterer::numberOfClusters() {
+	clusters();
+	return m_numberOfClusters;
+}
+
+double ModularityClusterer::modularity() {
+	clusters();
+	return m_modularity;
+}
+
+double ModularityClusterer::computeCIndex(const Graph& G, node v) {
+	OGDF_ASSERT(&G == m_pGraph);
+	OGDF_ASSERT(v->graphOf() == &G);
+	const NodeArray<int>& topCluster = clusters();
+	double inner = 0;
+	double total = 0;
+	for (adjEntry adj : v->adjEntries) {
+		const double w = m_weights == nullptr ? 1.0 : (*m_weights)[adj->theEdge()];
+		total += w;
+		if (topCluster[adj->twinNode()] == topCluster[v]) {
+			inner += w;
+		}
+	}
+	return total > 0 ? inner / total : 1.0;
+}
+
+std::vector<int> ModularityClusterer::buildHierarchy(
+		const std::function<int(const std::vector<int>&, int)>& createCluster) const {
+	const int n = m_pGraph->numberOfNodes();
+	// the current cluster of each node and the number of nodes in it
+	std::vector<int> current(n, 0);
+	std::vector<int> currentSize(n, n);
+
+	auto refineBy = [&](const std::vector<int>& label) {
+		std::vector<std::vector<int>> groups;
+		for (int v = 0; v < n; ++v) {
+			if (label[v] >= static_cast<int>(groups.size())) {
+				groups.resize(label[v] + 1);
+			}
+			groups[label[v]].push_back(v);
+		}
+		for (const std::vector<int>& members : groups) {
+			const int size = static_cast<int>(members.size());
+			if (size > 1 && size < currentSize[members.front()]) {
+				const int c = createCluster(members, current[members.front()]);
+				for (int v : members) {
+					current[v] = c;
+				}
+			}
+			for (int v : members) {
+				currentSize[v] = size;
+			}
+		}
+	};
+
+	std::vector<int> top(n);
+	int i = 0;
+	for (node v : m_pGraph->nodes) {
+		top[i++] = m_cluster[v];
+	}
+	refineBy(top);
+	for (auto level = m_levels.rbegin(); level != m_levels.rend(); ++level) {
+		refineBy(*level);
+	}
+	return current;
+}
+
+void ModularityClusterer::computeClustering(SList<SimpleCluster*>& sl) {
+	compute();
+	const Graph& G = *m_pGraph;
+	const int n = G.numberOfNodes();
+
+	SimpleCluster* root = new SimpleCluster();
+	root->m_size = n;
+	Array<node> nodes(n);
+	int i = 0;
+	for (node v : G.nodes) {
+		nodes[i++] = v;
+	}
+
+	std::vector<SimpleCluster*> created {root};
+	std::vector<int> innermost =
+			buildHierarchy([&](const std::vector<int>& members, int parentId) {
+				const int size = static_cast<int>(members.size());
+				SimpleCluster* parent = created[parentId];
+				SimpleCluster* s = new SimpleCluster(parent);
+				parent->pushBackChild(s);
+				sl.pushBack(s);
+				parent->m_size -= size;
+				s->m_size = size;
+				created.push_back(s);
+				return static_cast<int>(created.size()) - 1;
+			});
+
+	sl.pushFront(root);
+	for (int v = 0; v < n; ++v) {
+		created[innermost[v]]->pushBackVertex(nodes[v]);
+	}
+}
+
+void ModularityClusterer::createClusterGraph(ClusterGraph& C) {
+	OGDF_ASSERT(&(C.constGraph()) == m_pGraph);
+	// unlike clear(), this keeps the nodes in the root cluster
+	C.clearClusterTree(C.rootCluster());
+	compute();
+	const Graph& G = *m_pGraph;
+	const int n = G.numberOfNodes();
+
+	Array<node> nodes(n);
+	int i = 0;
+	for (node v : G.nodes) {
+		nodes[i++] = v;
+	}
+
+	std::vector<cluster> created {C.rootCluster()};
+	buildHierarchy([&](const std::vector<int>& members, int parentId) {
+		SList<node> clusterNodes;
+		for (int v : members) {
+			clusterNodes.pushBack(nodes[v]);
+		}
+		created.push_back(C.createCluster(clusterNodes, created[parentId]));
+		return static_cast<int>(created.size()) - 1;
+	});
+}
+
+}
@@ -0,0 +1,242 @@
+/** \file
+ * \brief Implementation of ogdf::NodeColoringSpeculative
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.md in the OGDF root directory for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, see
+ * http://www.gnu.org/copyleft/gpl.html
+ */
+
+#include <ogdf/basic/Array.h>
+#include <ogdf/basic/Graph.h>
+#include <ogdf/basic/GraphList.h>
+#include <ogdf/basic/Math.h>
+#include <ogdf/basic/System.h>
+#include <ogdf/basic/basic.h>
+#include <ogdf/basic/internal/intrinsics.h>
+#include <ogdf/basic/internal/parallel.h>
+#include <ogdf/graphalg/NodeColoringModule.h>
+#include <ogdf/graphalg/NodeColoringSpeculative.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+namespace ogdf {
+
+using NColor = NodeColoringModule::NodeColor;
+
+namespace {
+
+//! Number of consecutive nodes handed to a thread at once.
+constexpr int chunkSize = 256;
+
+//! Returns the index of the first unset bit in the bit set \p words of \p count words, which
+//! has to contain an unset bit.
+inline int firstFreeBit(const uint64_t* words, int count) {
+	int i = 0;
+	while (words[i] == ~uint64_t(0)) {
+		++i;
+		OGDF_ASSERT(i < count);
+	}
+	return 64 * i + lowestSetBit(~words[i]);
+}
+
+#ifdef OGDF_SSE3_EXTENSIONS
+//! Same as firstFreeBit() but skips full blocks of two words at once.
+inline int firstFreeBitSSE(const uint64_t* words, int count) {
+	const __m128i full = _mm_set1_epi32(-1);
+	int i = 0;
+	for (; i + 2 <= count; i += 2) {
+		__m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(words + i));
+		if (_mm_movemask_epi8(_mm_cmpeq_epi8(block, full)) != 0xFFFF) {
+			break;
+		}
+	}
+	return 64 * i + firstFreeBit(words + i, count - i);
+}
+#endif
+
+}
+
+NColor NodeColoringSpeculative::call(const Graph& graph, NodeArray<NColor>& colors, NColor start) {
+	const int n = graph.numberOfNodes();
+	m_rounds = 0;
+	if (n == 0) {
+		return NColor(0);
+	}
+
+	// Store the graph as adjacency arrays without self-loops; the adjacencies of v are
+	// neighbor[offset[v]], ..., neighbor[stop[v]-1]
+	Array<node> nodes(n);
+	NodeArray<int> index(graph);
+	std::vector<int> offset(n + 1, 0);
+	std::vector<int> stop(n);
+	int i = 0;
+	for (node v : graph.nodes) {
+		nodes[i] = v;
+		index[v] = i++;
+		offset[i] = offset[i - 1] + v->degree();
+	}
+	std::vector<int> neighbor(offset[n]);
+	internal::parallelFor(m_maxThreads, n, chunkSize, [&](int begin, int end, unsigned int) {
+		for (int v = begin; v < end; ++v) {
+			int pos = offset[v];
+			for (adjEntry adj : nodes[v]->adjEntries) {
+				if (adj->twinNode() != nodes[v]) {
+					neighbor[pos++] = index[adj->twinNode()];
+				}
+			}
+			stop[v] = pos;
+		}
+	});
+	int maxDegree = 0;
+	for (int v = 0; v < n; ++v) {
+		Math::updateMax(maxDegree, stop[v] - offset[v]);
+	}
+
+	// Sort the nodes decreasingly by degree; conflicts are resolved in favor of earlier nodes
+	std::vector<int> worklist(n);
+	std::vector<int> rank(n);
+	{
+		std::vector<int> first(maxDegree + 2, 0);
+		for (int v = 0; v < n; ++v) {
+			++first[maxDegree - (stop[v] - offset[v]) + 1];
+		}
+		for (int d = 0; d <= maxDegree; ++d) {
+			first[d + 1] += first[d];
+		}
+		for (int v = 0; v < n; ++v) {
+			rank[v] = first[maxDegree - (stop[v] - offset[v])]++;
+			worklist[rank[v]] = v;
+		}
+	}
+
+	// The colors are read and written concurrently during the speculative coloring
+	std::vector<std::atomic<int>> color(n);
+	for (auto& c : color) {
+		c.store(-1, std::memory_order_relaxed);
+	}
+
+	const unsigned int threads = m_maxThreads;
+	// per-thread bit sets of forbidden colors for nodes of large degree
+	Array<std::vector<uint64_t>> forbidden(threads);
+	// per-thread lists of nodes to be recolored
+	Array<std::vector<int>> conflicts(threads);
+#ifdef OGDF_SSE3_EXTENSIONS
+	const bool useSSE = System::cpuSupports(CPUFeature::SSE3);
+#endif
+
+	auto colorNode = [&](int v, unsigned int thread) {
+		const int degree = stop[v] - offset[v];
+		int c;
+		if (degree < 64) {
+			// the smallest free color is at most the degree
+			uint64_t mask = 0;
+			for (int j = offset[v]; j < stop[v]; ++j) {
+				const int cw = color[neighbor[j]].load(std::memory_order_relaxed);
+				if (cw >= 0 && cw < 64) {
+					mask |= uint64_t(1) << cw;
+				}
+			}
+			c = lowestSetBit(~mask);
+		} else {
+			const int words = degree / 64 + 1;
+			std::vector<uint64_t>& bits = forbidden[thread];
+			if (static_cast<int>(bits.size()) < words) {
+				bits.resize(words, 0);
+			}
+			for (int j = offset[v]; j < stop[v]; ++j) {
+				const int cw = color[neighbor[j]].load(std::memory_order_relaxed);
+				if (cw >= 0 && cw <= degree) {
+					bits[cw / 64] |= uint64_t(1) << (cw % 64);
+				}
+			}
+#ifdef OGDF_SSE3_EXTENSIONS
+			c = useSSE ? firstFreeBitSSE(bits.data(), words) : firstFreeBit(bits.data(), words);
+#else
+			c = firstFreeBit(bits.data(), words);
+#endif
+			std::fill(bits.begin(), bits.begin() + words, 0);
+		}
+		color[v].store(c, std::memory_order_relaxed);
+	};
+
+	while (!worklist.empty()) {
+		++m_rounds;
+		const int size = static_cast<int>(worklist.size());
+		internal::parallelFor(threads, size, chunkSize, [&](int begin, int end, unsigned int t) {
+			for (int j = begin; j < end; ++j) {
+				colorNode(worklist[j], t);
+			}
+		});
+
+		// A single thread colors the nodes sequentially, so there are no conflicts
+		if (threads == 1) {
+			break;
+		}
+
+		internal::parallelFor(threads, size, chunkSize, [&](int begin, int end, unsigned int t) {
+			for (int j = begin; j < end; ++j) {
+				const int v = worklist[j];
+				const int c = color[v].load(std::memory_order_relaxed);
+				for (int k = offset[v]; k < stop[v]; ++k) {
+					const int w = neighbor[k];
+					if (rank[w] < rank[v] && color[w].load(std::memory_order_relaxed) == c) {
+						conflicts[t].push_back(v);
+						break;
+					}
+				}
+			}
+		});
+
+		worklist.clear();
+		for (std::vector<int>& list : conflicts) {
+			worklist.insert(worklist.end(), list.begin(), list.end());
+			list.clear();
+		}
+		std::sort(worklist.begin(), worklist.end(),
+				[&](int v, int w) { return rank[v] < rank[w]; });
+	}
+
+	// Recolored nodes may leave colors unused, so number the used colors consecutively
+	std::vector<int> number(maxDegree + 1, -1);
+	for (int v = 0; v < n; ++v) {
+		number[color[v].load(std::memory_order_relaxed)] = 0;
+	}
+	NColor numberColors = NColor(0);
+	for (int& c : number) {
+		if (c == 0) {
+			c = static_cast<int>(numberColors++);
+		}
+	}
+	for (int v = 0; v < n; ++v) {
+		colors[nodes[v]] = start + NColor(number[color[v].load(std::memory_order_relaxed)]);
+	}
+
+	OGDF_ASSERT(checkColoring(graph, colors));
+	return numberColors;
+}
+
+}
@@ -30,12 +30,20 @@
  */
 
 
+#include <ogdf/basic/Array.h>
+#include <ogdf/basic/ArrayBuffer.h>
+#include <ogdf/basic/Barrier.h>
 #include <ogdf/basic/Graph.h>
+#include <ogdf/basic/basic.h>
+#include <ogdf/basic/internal/parallel.h>
 #include <ogdf/graphalg/PageRank.h>
 
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 namespace ogdf {
 
@@ -116,4 +124,288 @@ void BasicPageRank::call(const Graph& graph, const EdgeArray<double>& edgeWeight
 	// result is now between 0 and 1
 }
 
+PageRank::PageRank(const Graph& G, const EdgeArray<double>* weight, bool directed)
+	: m_G(G), m_weight(weight), m_directed(directed) {
+	readGraph();
+}
+
+void PageRank::readGraph() {
+	m_n = m_G.maxNodeIndex() + 1;
+	m_nodes.assign(m_n, nullptr);
+	m_outBegin.assign(m_n + 1, 0);
+	m_inBegin.assign(m_n + 1, 0);
+	std::vector<double> total(m_n, 0.0);
+	auto arcWeight = [&](edge e) { return m_weight == nullptr ? 1.0 : (*m_weight)[e]; };
+
+	for (node v : m_G.nodes) {
+		m_nodes[v->index()] = v;
+		for (adjEntry adj : v->adjEntries) {
+			if (!m_directed || adj->isSource()) {
+				OGDF_ASSERT(arcWeight(adj->theEdge()) > 0);
+				++m_outBegin[v->index() + 1];
+				++m_inBegin[adj->twinNode()->index() + 1];
+				total[v->index()] += arcWeight(adj->theEdge());
+			}
+		}
+	}
+	for (int v = 0; v < m_n; ++v) {
+		m_outBegin[v + 1] += m_outBegin[v];
+		m_inBegin[v + 1] += m_inBegin[v];
+	}
+
+	m_outHead.resize(m_outBegin[m_n]);
+	m_outWeight.resize(m_outBegin[m_n]);
+	m_inTail.resize(m_inBegin[m_n]);
+	m_inWeight.resize(m_inBegin[m_n]);
+	std::vector<int> in(m_inBegin.begin(), m_inBegin.end() - 1);
+	for (node v : m_G.nodes) {
+		int out = m_outBegin[v->index()];
+		for (adjEntry adj : v->adjEntries) {
+			if (!m_directed || adj->isSource()) {
+				const int w = adj->twinNode()->index();
+				const double a = arcWeight(adj->theEdge()) / total[v->index()];
+				m_outHead[out] = w;
+				m_outWeight[out++] = a;
+				m_inTail[in[w]] = v->index();
+				m_inWeight[in[w]++] = a;
+			}
+		}
+	}
+}
+
+int PageRank::compute() {
+	if (m_rank.empty()) {
+		m_rank.resize(m_n);
+		for (int v = 0; v < m_n; ++v) {
+			m_rank[v] = m_nodes[v] == nullptr ? 0.0 : 1.0;
+		}
+	}
+	OGDF_ASSERT(static_cast<int>(m_rank.size()) == m_n);
+	if (m_G.empty()) {
+		m_sum = 0;
+		return 0;
+	}
+
+	// every thread gets a range of nodes with about the same number of incoming arcs
+	const int64_t arcs = m_inBegin[m_n];
+	const unsigned int nThreads = static_cast<unsigned int>(
+			min<int64_t>(m_maxThreads, max<int64_t>(1, arcs / c_minArcsPerThread)));
+	std::vector<int> bound(nThreads + 1, m_n);
+	for (unsigned int t = 0; t < nThreads; ++t) {
+		bound[t] = static_cast<int>(
+				std::lower_bound(m_inBegin.begin(), m_inBegin.end() - 1, arcs * t / nThreads)
+				- m_inBegin.begin());
+	}
+
+	std::vector<double> buffer[2];
+	buffer[0] = std::move(m_rank);
+	buffer[1].resize(m_n);
+	std::vector<double> delta(nThreads), sum(nThreads);
+	const double d = m_dampingFactor;
+	const bool gaussSeidel = m_method == Method::GaussSeidel;
+	int iterations = 0;
+	Barrier barrier(nThreads);
+
+	auto worker = [&](unsigned int id) {
+		const int first = bound[id], last = bound[id + 1];
+		for (int it = 0;; ++it) {
+			const std::vector<double>& cur = buffer[it % 2];
+			std::vector<double>& next = buffer[1 - it % 2];
+			double myDelta = 0, mySum = 0;
+			for (int v = first; v < last; ++v) {
+				if (m_nodes[v] == nullptr) {
+					next[v] = 0;
+					continue;
+				}
+				double y = 0;
+				for (int j = m_inBegin[v]; j < m_inBegin[v + 1]; ++j) {
+					const int u = m_inTail[j];
+					y += m_inWeight[j] * (gaussSeidel && first <= u && u < v ? next[u] : cur[u]);
+				}
+				y = (1 - d) + d * y;
+				next[v] = y;
+				myDelta += fabs(y - cur[v]);
+				mySum += y;
+			}
+			delta[id] = myDelta;
+			sum[id] = mySum;
+			barrier.threadSync();
+
+			// all threads come to the same decision
+			double totalDelta = 0, total = 0;
+			for (unsigned int t = 0; t < nThreads; ++t) {
+				totalDelta += delta[t];
+				total += sum[t];
+			}
+			const bool done = totalDelta <= m_tolerance * total || it + 1 >= m_maxIterations;
+			barrier.threadSync();
+			if (done) {
+				if (id == 0) {
+					iterations = it + 1;
+					m_sum = total;
+				}
+				return;
+			}
+		}
+	};
+
+	internal::runThreads(nThreads, worker);
+
+	m_rank = std::move(buffer[iterations % 2]);
+	return iterations;
+}
+
+int PageRank::update() {
+	if (m_rank.empty()) {
+		readGraph();
+		return 0;
+	}
+
+	const int oldN = m_n;
+	const std::vector<node> oldNodes = std::move(m_nodes);
+	const std::vector<int> oldBegin = std::move(m_outBegin);
+	const std::vector<int> oldHead = std::move(m_outHead);
+	const std::vector<double> oldWeight = std::move(m_outWeight);
+	readGraph();
+	m_rank.resize(m_n, 0.0);
+
+	// collect the nodes whose incoming arcs (or their weights) changed
+	std::vector<double> residual(m_n, 0.0);
+	std::vector<char> queued(m_n, false);
+	std::vector<int> queue;
+	auto enqueue = [&](int v) {
+		if (v < m_n && m_nodes[v] != nullptr && !queued[v]) {
+			queued[v] = true;
+			queue.push_back(v);
+		}
+	};
+	for (int u = 0; u < max(oldN, m_n); ++u) {
+		const bool was = u < oldN && oldNodes[u] != nullptr;
+		const bool is = u < m_n && m_nodes[u] != nullptr;
+		if (!is && u < m_n) {
+			m_rank[u] = 0;
+		}
+		if (!was && is) {
+			enqueue(u);
+		}
+
+		bool changed = was != is;
+		if (was && is) {
+			const int oldDegree = oldBegin[u + 1] - oldBegin[u];
+			changed = oldDegree != m_outBegin[u + 1] - m_outBegin[u];
+			for (int j = 0; !changed && j < oldDegree; ++j) {
+				changed = oldHead[oldBegin[u] + j] != m_outHead[m_outBegin[u] + j]
+						|| oldWeight[oldBegin[u] + j] != m_outWeight[m_outBegin[u] + j];
+			}
+		}
+		if (changed) {
+			if (was) {
+				for (int j = oldBegin[u]; j < oldBegin[u + 1]; ++j) {
+					enqueue(oldHead[j]);
+				}
+			}
+			if (is) {
+				for (int j = m_outBegin[u]; j < m_outBegin[u + 1]; ++j) {
+					enqueue(m_outHead[j]);
+				}
+			}
+		}
+	}
+
+	const double d = m_dampingFactor;
+	for (int v : queue) {
+		double y = 0;
+		for (int j = m_inBegin[v]; j < m_inBegin[v + 1]; ++j) {
+			y += m_inWeight[j] * m_rank[m_inTail[j]];
+		}
+		residual[v] = (1 - d) + d * y - m_rank[v];
+	}
+
+	// push residuals until they are small (each node is in the queue at most once at a time)
+	const double threshold = m_tolerance * (1 - d);
+	int pushes = 0;
+	for (size_t i = 0; i < queue.size(); ++i) {
+		const int v = queue[i];
+		queued[v] = false;
+		const double r = residual[v];
+		if (fabs(r) <= threshold) {
+			continue;
+		}
+		++pushes;
+		residual[v] = 0;
+		m_rank[v] += r;
+		for (int j = m_outBegin[v]; j < m_outBegin[v + 1]; ++j) {
+			const int w = m_outHead[j];
+			residual[w] += d * m_outWeight[j] * r;
+			if (fabs(residual[w]) > threshold) {
+				enqueue(w);
+			}
+		}
+	}
+
+	m_sum = 0;
+	for (node v : m_G.nodes) {
+		m_sum += m_rank[v->index()];
+	}
+	return pushes;
+}
+
+void PageRank::scores(NodeArray<double>& result) const {
+	result.init(m_G, 0.0);
+	if (m_rank.empty()) {
+		return;
+	}
+	for (node v : m_G.nodes) {
+		OGDF_ASSERT(v->index() < m_n);
+		result[v] = score(v);
+	}
+}
+
+void PageRank::personalized(node s, ArrayBuffer<std::pair<node, double>>& result,
+		double epsilon) const {
+	OGDF_ASSERT(s->graphOf() == &m_G);
+	OGDF_ASSERT(s->index() < m_n);
+
+	// only nodes with positive residual are stored
+	std::unordered_map<int, double> rank, residual;
+	std::vector<int> queue {s->index()};
+	auto limit = [&](int u) { return epsilon * max(1, m_outBegin[u + 1] - m_outBegin[u]); };
+	const double d = m_dampingFactor;
+
+	residual[s->index()] = 1;
+	for (size_t i = 0; i < queue.size(); ++i) {
+		const int u = queue[i];
+		const double r = residual[u];
+		residual[u] = 0;
+		rank[u] += (1 - d) * r;
+		for (int j = m_outBegin[u]; j < m_outBegin[u + 1]; ++j) {
+			const int w = m_outHead[j];
+			double& rw = residual[w];
+			const bool wasQueued = rw > limit(w);
+			rw += d * m_outWeight[j] * r;
+			if (!wasQueued && rw > limit(w)) {
+				queue.push_back(w);
+			}
+		}
+	}
+
+	double total = 0;
+	std::vector<std::pair<node, double>> scores;
+	scores.reserve(rank.size());
+	for (const auto& entry : rank) {
+		scores.emplace_back(m_nodes[entry.first], entry.second);
+		total += entry.second;
+	}
+	std::sort(scores.begin(), scores.end(),
+			[](const std::pair<node, double>& a, const std::pair<node, double>& b) {
+				return a.second > b.second
+						|| (a.second == b.second && a.first->index() < b.first->index());
+			});
+
+	result.clear();
+	for (const auto& entry : scores) {
+		result.push(std::make_pair(entry.first, entry.second / total));
+	}
+}
+
 }
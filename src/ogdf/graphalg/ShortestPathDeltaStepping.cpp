@@ -0,0 +1,266 @@
+/** \file
+ * \brief Implementation of class ShortestPathDeltaStepping.
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.md in the OGDF root directory for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, see
+ * http://www.gnu.org/copyleft/gpl.html
+ */
+
+#include <ogdf/basic/Array.h>
+#include <ogdf/basic/Barrier.h>
+#include <ogdf/basic/Graph.h>
+#include <ogdf/basic/basic.h>
+#include <ogdf/basic/internal/parallel.h>
+#include <ogdf/graphalg/ShortestPathDeltaStepping.h>
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace ogdf {
+
+namespace {
+
+struct Arc {
+	int head;
+	int length;
+	edge original;
+};
+
+//! A relaxation request for a node owned by another thread.
+struct Request {
+	int node;
+	int distance;
+	edge pred;
+};
+
+}
+
+bool ShortestPathDeltaStepping::call(const Graph& G, const node s, const EdgeArray<int>& length,
+		NodeArray<int>& d, NodeArray<edge>& pi) {
+	for (edge e : G.edges) {
+		if (length[e] < 0) {
+			return false;
+		}
+	}
+
+	run(G, s, &length, d, pi);
+	return true;
+}
+
+void ShortestPathDeltaStepping::call(const Graph& G, const node s, NodeArray<int>& d,
+		NodeArray<edge>& pi) {
+	run(G, s, nullptr, d, pi);
+}
+
+void ShortestPathDeltaStepping::run(const Graph& G, node s, const EdgeArray<int>* length,
+		NodeArray<int>& d, NodeArray<edge>& pi) const {
+	const int infinity = std::numeric_limits<int>::max();
+	const int n = G.maxNodeIndex() + 1;
+	auto lengthOf = [&](edge e) { return length == nullptr ? 1 : (*length)[e]; };
+
+	// adjacency arrays; the light arcs of each node precede its heavy arcs
+	int maxLength = 0;
+	int64_t totalLength = 0;
+	std::vector<int> begin(n + 1, 0);
+	for (edge e : G.edges) {
+		maxLength = max(maxLength, lengthOf(e));
+		totalLength += lengthOf(e);
+		++begin[e->source()->index() + 1];
+		if (!m_directed) {
+			++begin[e->target()->index() + 1];
+		}
+	}
+	for (int v = 0; v < n; ++v) {
+		begin[v + 1] += begin[v];
+	}
+	const int numberOfArcs = begin[n];
+
+	int delta = length == nullptr ? 1 : m_delta;
+	if (delta == 0) {
+		delta = numberOfArcs == 0
+				? 1
+				: static_cast<int>(max(int64_t(1),
+						  (totalLength * (m_directed ? 1 : 2) + numberOfArcs - 1) / numberOfArcs));
+	}
+	delta = max(delta, maxLength / (c_maxBuckets - 2) + 1);
+	const int numberOfBuckets = maxLength / delta + 2;
+
+	std::vector<Arc> arcs(numberOfArcs);
+	std::vector<int> lightEnd(n);
+	{
+		std::vector<int> light(begin.begin(), begin.end() - 1);
+		std::vector<int> heavy(begin.begin() + 1, begin.end());
+		auto addArc = [&](int u, int v, edge e) {
+			int l = lengthOf(e);
+			arcs[l <= delta ? light[u]++ : --heavy[u]] = {v, l, e};
+		};
+		for (edge e : G.edges) {
+			addArc(e->source()->index(), e->target()->index(), e);
+			if (!m_directed) {
+				addArc(e->target()->index(), e->source()->index(), e);
+			}
+		}
+		for (int v = 0; v < n; ++v) {
+			lightEnd[v] = light[v];
+		}
+	}
+
+	const unsigned int nThreads = max(1u,
+			min(m_maxThreads, static_cast<unsigned int>(numberOfArcs / c_minArcsPerThread)));
+	auto owner = [&](int v) { return static_cast<unsigned int>(v) % nThreads; };
+
+	std::vector<int> distance(n, infinity);
+	std::vector<edge> pred(n, nullptr);
+	std::vector<int> mark(n, -1); // last round in which a node entered the frontier
+	std::vector<int> settledMark(n, -1); // last bucket from which a node was removed
+
+	// per thread: buckets (cyclic), requests per owner, frontier, nodes removed from the bucket
+	std::vector<std::vector<std::vector<int>>> bucket(nThreads,
+			std::vector<std::vector<int>>(numberOfBuckets));
+	std::vector<std::vector<std::vector<Request>>> requests(nThreads,
+			std::vector<std::vector<Request>>(nThreads));
+	std::vector<std::vector<int>> frontier(nThreads);
+	std::vector<std::vector<int>> settled(nThreads);
+	std::vector<int64_t> nextBucket(nThreads);
+	std::vector<size_t> frontierSize(nThreads);
+	Barrier barrier(nThreads);
+
+	distance[s->index()] = 0;
+	bucket[owner(s->index())][0].push_back(s->index());
+
+	auto worker = [&](unsigned int id) {
+		int64_t current = 0;
+		int round = 0;
+
+		auto relax = [&](int v, bool lightArcs) {
+			const int first = lightArcs ? begin[v] : lightEnd[v];
+			const int last = lightArcs ? lightEnd[v] : begin[v + 1];
+			for (int i = first; i < last; ++i) {
+				const Arc& arc = arcs[i];
+				OGDF_ASSERT(infinity - arc.length >= distance[v]);
+				requests[id][owner(arc.head)].push_back(
+						{arc.head, distance[v] + arc.length, arc.original});
+			}
+		};
+
+		auto applyRequests = [&] {
+			for (unsigned int t = 0; t < nThreads; ++t) {
+				for (const Request& r : requests[t][id]) {
+					if (r.distance < distance[r.node]) {
+						distance[r.node] = r.distance;
+						pred[r.node] = r.pred;
+						bucket[id][(r.distance / delta) % numberOfBuckets].push_back(r.node);
+					}
+				}
+				requests[t][id].clear();
+			}
+		};
+
+		// moves the valid entries of the current bucket to the frontier
+		auto fillFrontier = [&] {
+			++round;
+			std::vector<int>& entries = bucket[id][current % numberOfBuckets];
+			frontier[id].clear();
+			for (int v : entries) {
+				if (distance[v] / delta == current && mark[v] != round) {
+					mark[v] = round;
+					frontier[id].push_back(v);
+				}
+			}
+			entries.clear();
+		};
+
+		for (;;) {
+			// all tentative distances lie within numberOfBuckets - 1 buckets after current
+			nextBucket[id] = -1;
+			for (int64_t k = current; k < current + numberOfBuckets; ++k) {
+				if (!bucket[id][k % numberOfBuckets].empty()) {
+					nextBucket[id] = k;
+					break;
+				}
+			}
+			barrier.threadSync();
+
+			current = -1;
+			for (int64_t k : nextBucket) {
+				if (k >= 0 && (current < 0 || k < current)) {
+					current = k;
+				}
+			}
+			if (current < 0) {
+				break;
+			}
+			barrier.threadSync();
+
+			// light phases until the current bucket stays empty
+			fillFrontier();
+			for (;;) {
+				frontierSize[id] = frontier[id].size();
+				barrier.threadSync();
+
+				size_t total = 0;
+				for (size_t size : frontierSize) {
+					total += size;
+				}
+				if (total == 0) {
+					break;
+				}
+
+				for (int v : frontier[id]) {
+					if (settledMark[v] != static_cast<int>(current)) {
+						settledMark[v] = static_cast<int>(current);
+						settled[id].push_back(v);
+					}
+					relax(v, true);
+				}
+				barrier.threadSync();
+
+				applyRequests();
+				fillFrontier();
+			}
+
+			// heavy arcs lead to later buckets and are relaxed only once
+			for (int v : settled[id]) {
+				relax(v, false);
+			}
+			settled[id].clear();
+			barrier.threadSync();
+
+			applyRequests();
+			++current;
+		}
+	};
+
+	internal::runThreads(nThreads, worker);
+
+	d.init(G);
+	pi.init(G);
+	for (node v : G.nodes) {
+		d[v] = distance[v->index()];
+		pi[v] = pred[v->index()];
+	}
+}
+
+}
@@ -31,8 +31,6 @@
  */
 
 #include <ogdf/basic/Graph.h>
-#include <ogdf/basic/GraphCopy.h>
-#include <ogdf/graphalg/Dijkstra.h>
 #include <ogdf/graphalg/SpannerBasicGreedy.h>
 
 #include <cmath>
@@ -40,30 +38,16 @@
 namespace ogdf {
 
 // We need some rounding for maxLookupDist for the integer case:
-// maxLookupDist is a double, but the dijkstra implementation reuires an int, so we have to
-// ceil the maxLookupDist to not make mistakes when rounding down.
+// maxLookupDist is a double, but the distances are ints, so we have to ceil the maxLookupDist
+// to not make mistakes when rounding down.
 template<>
 double SpannerBasicGreedy<int>::distanceInSpanner(node s, node t, double maxLookupDist) {
-	NodeArray<int> distances;
-	NodeArray<edge> predecessor;
-	Dijkstra<int> dijkstra;
-	dijkstra.callBound(*m_spanner, m_spannerWeights, s, predecessor, distances,
-			false, // directed
-			false, // arcs reversed
-			t, ceil(maxLookupDist));
-	return distances[t];
+	return boundedDistance(s->index(), t->index(), static_cast<int>(ceil(maxLookupDist)));
 }
 
 template<>
 double SpannerBasicGreedy<double>::distanceInSpanner(node s, node t, double maxLookupDist) {
-	NodeArray<double> distances;
-	NodeArray<edge> predecessor;
-	Dijkstra<double> dijkstra;
-	dijkstra.callBound(*m_spanner, m_spannerWeights, s, predecessor, distances,
-			false, // directed
-			false, // arcs reversed
-			t, maxLookupDist);
-	return distances[t];
+	return boundedDistance(s->index(), t->index(), maxLookupDist);
 }
 
 }
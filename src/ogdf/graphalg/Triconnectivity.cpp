@@ -45,6 +45,7 @@
 
 #include <algorithm>
 #include <iostream>
+#include <utility>
 #include <vector>
 
 // #define OGDF_TRICONNECTIVITY_OUTPUT
@@ -567,37 +568,43 @@ void Triconnectivity::assembleTriconnectedComponents() {
 // The first dfs-search
 //  computes NUMBER[v], FATHER[v], LOWPT1[v], LOWPT2[v],
 //           ND[v], TYPE[e], DEGREE[v]
+// The search is iterative, so it also works on long paths.
 void Triconnectivity::DFS1(node v, node u, node& s1) {
-	node firstSon = nullptr;
-
-	m_NUMBER[v] = ++m_numCount;
-	m_FATHER[v] = u;
-	m_DEGREE[v] = v->degree();
-
-	m_LOWPT1[v] = m_LOWPT2[v] = m_NUMBER[v];
-	m_ND[v] = 1;
-
-	for (adjEntry adj : v->adjEntries) {
-		edge e = adj->theEdge();
-
-		if (m_TYPE[e] != EdgeType::unseen) {
-			continue;
-		}
-
-		node w = e->opposite(v);
+	struct Frame {
+		node v; // the current node
+		node u; // its father
+		adjEntry adj; // the next adjacency entry of v to consider
+		node firstSon; // the first son of v
+	};
+	ArrayBuffer<Frame> stack;
+
+	auto discover = [&](node x, node father) {
+		m_NUMBER[x] = ++m_numCount;
+		m_FATHER[x] = father;
+		m_DEGREE[x] = x->degree();
+
+		m_LOWPT1[x] = m_LOWPT2[x] = m_NUMBER[x];
+		m_ND[x] = 1;
+		stack.push({x, father, x->firstAdj(), nullptr});
+	};
+
+	discover(v, u);
+	while (!stack.empty()) {
+		Frame& f = stack.top();
+		v = f.v;
 
-		if (m_NUMBER[w] == 0) {
-			m_TYPE[e] = EdgeType::tree;
-			if (firstSon == nullptr) {
-				firstSon = w;
+		if (f.adj == nullptr) {
+			// v is finished, update its father
+			stack.pop();
+			if (stack.empty()) {
+				break;
 			}
-
-			m_TREE_ARC[w] = e;
-
-			DFS1(w, v, s1);
+			const node w = v;
+			const Frame& fu = stack.top();
+			v = fu.v;
 
 			// check for cut vertex
-			if (m_LOWPT1[w] >= m_NUMBER[v] && (w != firstSon || u != nullptr)) {
+			if (m_LOWPT1[w] >= m_NUMBER[v] && (w != fu.firstSon || fu.u != nullptr)) {
 				s1 = v;
 			}
 
@@ -613,6 +620,27 @@ void Triconnectivity::DFS1(node v, node u, node& s1) {
 			}
 
 			m_ND[v] += m_ND[w];
+			continue;
+		}
+
+		edge e = f.adj->theEdge();
+		f.adj = f.adj->succ();
+
+		if (m_TYPE[e] != EdgeType::unseen) {
+			continue;
+		}
+
+		node w = e->opposite(v);
+
+		if (m_NUMBER[w] == 0) {
+			m_TYPE[e] = EdgeType::tree;
+			if (f.firstSon == nullptr) {
+				f.firstSon = w;
+			}
+
+			m_TREE_ARC[w] = e;
+
+			discover(w, v); // invalidates f
 
 		} else {
 			m_TYPE[e] = EdgeType::frond;
@@ -653,11 +681,26 @@ void Triconnectivity::buildAcceptableAdjStruct() {
 	}
 }
 
-// The second dfs-search
+// The second dfs-search (iterative)
 void Triconnectivity::pathFinder(node v) {
+	ArrayBuffer<std::pair<node, ListIterator<edge>>> stack;
+
 	m_NEWNUM[v] = m_numCount - m_ND[v] + 1;
+	stack.push({v, m_A[v].begin()});
+
+	while (!stack.empty()) {
+		std::pair<node, ListIterator<edge>>& top = stack.top();
+		if (!top.second.valid()) {
+			stack.pop();
+			if (!stack.empty()) {
+				m_numCount--;
+			}
+			continue;
+		}
 
-	for (edge e : m_A[v]) {
+		v = top.first;
+		edge e = *top.second;
+		++top.second;
 		node w = e->opposite(v);
 
 		if (m_newPath) {
@@ -666,8 +709,8 @@ void Triconnectivity::pathFinder(node v) {
 		}
 
 		if (m_TYPE[e] == EdgeType::tree) {
-			pathFinder(w);
-			m_numCount--;
+			m_NEWNUM[w] = m_numCount - m_ND[w] + 1;
+			stack.push({w, m_A[w].begin()}); // invalidates top
 
 		} else {
 			m_IN_HIGH[e] = m_HIGHPT[w].pushBack(m_NEWNUM[v]);
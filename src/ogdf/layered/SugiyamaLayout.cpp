@@ -579,9 +579,14 @@ private:
 
 	const NodeArray<int>& arrange_compGC() const { return m_sugi.compGC(); }
 
+	int windowSize() const { return m_sugi.windowSize(); }
+
 	bool transposeLevel(int i, HierarchyLevels& levels, Array<bool>& levelChanged);
-	void doTranspose(HierarchyLevels& levels, Array<bool>& levelChanged);
-	void doTransposeRev(HierarchyLevels& levels, Array<bool>& levelChanged);
+	void doTranspose(HierarchyLevels& levels, int first, int last, Array<bool>& levelChanged);
+	void doTransposeRev(HierarchyLevels& levels, int first, int last, Array<bool>& levelChanged);
+
+	int calculateCrossings(const HierarchyLevels& levels, int first, int last,
+			bool useSimDraw) const;
 
 	int traverseTopDown(HierarchyLevels& levels, LayerByLayerSweep* pCrossMin,
 			TwoLayerCrossMinSimDraw* pCrossMinSimDraw, Array<bool>* pLevelChanged);
@@ -589,6 +594,17 @@ private:
 	int traverseBottomUp(HierarchyLevels& levels, LayerByLayerSweep* pCrossMin,
 			TwoLayerCrossMinSimDraw* pCrossMinSimDraw, Array<bool>* pLevelChanged);
 
+	void traverseTopDown(HierarchyLevels& levels, int first, int last,
+			LayerByLayerSweep* pCrossMin, TwoLayerCrossMinSimDraw* pCrossMinSimDraw,
+			Array<bool>* pLevelChanged);
+
+	void traverseBottomUp(HierarchyLevels& levels, int first, int last,
+			LayerByLayerSweep* pCrossMin, TwoLayerCrossMinSimDraw* pCrossMinSimDraw,
+			Array<bool>* pLevelChanged);
+
+	void traverseWindows(HierarchyLevels& levels, LayerByLayerSweep* pCrossMin,
+			TwoLayerCrossMinSimDraw* pCrossMinSimDraw, Array<bool>* pLevelChanged);
+
 	int queryBestKnown() const { return m_bestCR; }
 
 	bool postNewResult(int cr, NodeArray<int>* pPos);
@@ -648,40 +664,87 @@ bool LayerByLayerSweep::CrossMinMaster::transposeLevel(int i, HierarchyLevels& l
 	return (levelChanged[i] = improved);
 }
 
-void LayerByLayerSweep::CrossMinMaster::doTranspose(HierarchyLevels& levels,
-		Array<bool>& levelChanged) {
-	levelChanged.fill(true);
+void LayerByLayerSweep::CrossMinMaster::doTranspose(HierarchyLevels& levels, int first,
+		int last, Array<bool>& levelChanged) {
+	if (first == 0 && last == levels.high()) {
+		levelChanged.fill(true);
+	} else {
+		for (int i = first; i <= last; ++i) {
+			levelChanged[i] = true;
+		}
+	}
 
 	bool improved;
 	do {
 		improved = false;
 
-		for (int i = 0; i <= levels.high(); ++i) {
+		for (int i = first; i <= last; ++i) {
 			improved |= transposeLevel(i, levels, levelChanged);
 		}
 	} while (improved);
 }
 
-void LayerByLayerSweep::CrossMinMaster::doTransposeRev(HierarchyLevels& levels,
-		Array<bool>& levelChanged) {
-	levelChanged.fill(true);
+void LayerByLayerSweep::CrossMinMaster::doTransposeRev(HierarchyLevels& levels, int first,
+		int last, Array<bool>& levelChanged) {
+	if (first == 0 && last == levels.high()) {
+		levelChanged.fill(true);
+	} else {
+		for (int i = first; i <= last; ++i) {
+			levelChanged[i] = true;
+		}
+	}
 
 	bool improved;
 	do {
 		improved = false;
 
-		for (int i = levels.high(); i >= 0; --i) {
+		for (int i = last; i >= first; --i) {
 			improved |= transposeLevel(i, levels, levelChanged);
 		}
 	} while (improved);
 }
 
+int LayerByLayerSweep::CrossMinMaster::calculateCrossings(const HierarchyLevels& levels,
+		int first, int last, bool useSimDraw) const {
+	int nCrossings = 0;
+	for (int i = first; i <= min(last, levels.high() - 1); ++i) {
+		nCrossings += useSimDraw ? levels.calculateCrossingsSimDraw(i, subgraphs())
+								 : levels.calculateCrossings(i);
+	}
+	return nCrossings;
+}
+
 int LayerByLayerSweep::CrossMinMaster::traverseTopDown(HierarchyLevels& levels,
 		LayerByLayerSweep* pCrossMin, TwoLayerCrossMinSimDraw* pCrossMinSimDraw,
 		Array<bool>* pLevelChanged) {
+	traverseTopDown(levels, 0, levels.high(), pCrossMin, pCrossMinSimDraw, pLevelChanged);
+	if (!arrangeCCs()) {
+		levels.separateCCs(arrange_numCC(), arrange_compGC());
+	}
+
+	return (pCrossMin != nullptr) ? levels.calculateCrossings()
+								  : levels.calculateCrossingsSimDraw(subgraphs());
+}
+
+int LayerByLayerSweep::CrossMinMaster::traverseBottomUp(HierarchyLevels& levels,
+		LayerByLayerSweep* pCrossMin, TwoLayerCrossMinSimDraw* pCrossMinSimDraw,
+		Array<bool>* pLevelChanged) {
+	traverseBottomUp(levels, 0, levels.high(), pCrossMin, pCrossMinSimDraw, pLevelChanged);
+	if (!arrangeCCs()) {
+		levels.separateCCs(arrange_numCC(), arrange_compGC());
+	}
+
+	return (pCrossMin != nullptr) ? levels.calculateCrossings()
+								  : levels.calculateCrossingsSimDraw(subgraphs());
+}
+
+// Traverses the levels first+1,...,last top-down; level first is fixed.
+void LayerByLayerSweep::CrossMinMaster::traverseTopDown(HierarchyLevels& levels, int first,
+		int last, LayerByLayerSweep* pCrossMin, TwoLayerCrossMinSimDraw* pCrossMinSimDraw,
+		Array<bool>* pLevelChanged) {
 	levels.direction(HierarchyLevels::TraversingDir::downward);
 
-	for (int i = 1; i <= levels.high(); ++i) {
+	for (int i = first + 1; i <= last; ++i) {
 		if (pCrossMin != nullptr) {
 			pCrossMin->call(levels[i]);
 		} else {
@@ -690,22 +753,19 @@ int LayerByLayerSweep::CrossMinMaster::traverseTopDown(HierarchyLevels& levels,
 	}
 
 	if (pLevelChanged != nullptr) {
-		doTranspose(levels, *pLevelChanged);
-	}
-	if (!arrangeCCs()) {
-		levels.separateCCs(arrange_numCC(), arrange_compGC());
+		doTranspose(levels, first == 0 ? 0 : first + 1, last, *pLevelChanged);
 	}
-
-	return (pCrossMin != nullptr) ? levels.calculateCrossings()
-								  : levels.calculateCrossingsSimDraw(subgraphs());
 }
 
-int LayerByLayerSweep::CrossMinMaster::traverseBottomUp(HierarchyLevels& levels,
-		LayerByLayerSweep* pCrossMin, TwoLayerCrossMinSimDraw* pCrossMinSimDraw,
+// Traverses the levels last-1,...,first bottom-up. If first is not the top level,
+// it is the boundary to the previous window and kept fixed.
+void LayerByLayerSweep::CrossMinMaster::traverseBottomUp(HierarchyLevels& levels, int first,
+		int last, LayerByLayerSweep* pCrossMin, TwoLayerCrossMinSimDraw* pCrossMinSimDraw,
 		Array<bool>* pLevelChanged) {
 	levels.direction(HierarchyLevels::TraversingDir::upward);
 
-	for (int i = levels.high() - 1; i >= 0; i--) {
+	const int top = (first == 0) ? 0 : first + 1;
+	for (int i = min(last, levels.high() - 1); i >= top; i--) {
 		if (pCrossMin != nullptr) {
 			pCrossMin->call(levels[i]);
 		} else {
@@ -714,14 +774,45 @@ int LayerByLayerSweep::CrossMinMaster::traverseBottomUp(HierarchyLevels& levels,
 	}
 
 	if (pLevelChanged != nullptr) {
-		doTransposeRev(levels, *pLevelChanged);
+		doTransposeRev(levels, top, last, *pLevelChanged);
 	}
+}
+
+void LayerByLayerSweep::CrossMinMaster::traverseWindows(HierarchyLevels& levels,
+		LayerByLayerSweep* pCrossMin, TwoLayerCrossMinSimDraw* pCrossMinSimDraw,
+		Array<bool>* pLevelChanged) {
+	const int maxFails = fails();
+
+	for (int first = 0; first < levels.high(); first += windowSize() - 1) {
+		const int last = min(first + windowSize() - 1, levels.high());
+
+		const bool useSimDraw = pCrossMin == nullptr;
+		int nCrossingsOld = calculateCrossings(levels, first, last, useSimDraw);
+		int nFails = maxFails + 1;
+		while (nFails > 0 && nCrossingsOld > 0) {
+			traverseTopDown(levels, first, last, pCrossMin, pCrossMinSimDraw, pLevelChanged);
+			int nCrossingsNew = calculateCrossings(levels, first, last, useSimDraw);
+			if (nCrossingsNew < nCrossingsOld) {
+				nCrossingsOld = nCrossingsNew;
+				nFails = maxFails + 1;
+			} else {
+				--nFails;
+			}
+
+			traverseBottomUp(levels, first, last, pCrossMin, pCrossMinSimDraw, pLevelChanged);
+			nCrossingsNew = calculateCrossings(levels, first, last, useSimDraw);
+			if (nCrossingsNew < nCrossingsOld) {
+				nCrossingsOld = nCrossingsNew;
+				nFails = maxFails + 1;
+			} else {
+				--nFails;
+			}
+		}
+	}
+
 	if (!arrangeCCs()) {
 		levels.separateCCs(arrange_numCC(), arrange_compGC());
 	}
-
-	return (pCrossMin != nullptr) ? levels.calculateCrossings()
-								  : levels.calculateCrossingsSimDraw(subgraphs());
 }
 
 void LayerByLayerSweep::CrossMinMaster::doWorkHelper(LayerByLayerSweep* pCrossMin,
@@ -753,37 +844,51 @@ void LayerByLayerSweep::CrossMinMaster::doWorkHelper(LayerByLayerSweep* pCrossMi
 		(*pLevelChanged)[-1] = (*pLevelChanged)[levels.size()] = false;
 	}
 
+	const bool useWindows = windowSize() >= 2 && windowSize() < levels.size();
 	int maxFails = fails();
 	for (;;) {
-		int nFails = maxFails + 1;
-		do {
-			// top-down traversal
-			int nCrossingsNew = traverseTopDown(levels, pCrossMin, pCrossMinSimDraw, pLevelChanged);
-			if (nCrossingsNew < nCrossingsOld) {
-				if (nCrossingsNew < queryBestKnown() && postNewResult(nCrossingsNew, &bestPos)) {
-					levels.storePos(bestPos);
-				}
+		if (useWindows) {
+			traverseWindows(levels, pCrossMin, pCrossMinSimDraw, pLevelChanged);
 
-				nCrossingsOld = nCrossingsNew;
-				nFails = maxFails + 1;
-			} else {
-				--nFails;
+			nCrossingsOld = (pCrossMin != nullptr) ? levels.calculateCrossings()
+												   : levels.calculateCrossingsSimDraw(subgraphs());
+			if (nCrossingsOld < queryBestKnown() && postNewResult(nCrossingsOld, &bestPos)) {
+				levels.storePos(bestPos);
 			}
+		} else {
+			int nFails = maxFails + 1;
+			do {
+				// top-down traversal
+				int nCrossingsNew =
+						traverseTopDown(levels, pCrossMin, pCrossMinSimDraw, pLevelChanged);
+				if (nCrossingsNew < nCrossingsOld) {
+					if (nCrossingsNew < queryBestKnown()
+							&& postNewResult(nCrossingsNew, &bestPos)) {
+						levels.storePos(bestPos);
+					}
 
-			// bottom-up traversal
-			nCrossingsNew = traverseBottomUp(levels, pCrossMin, pCrossMinSimDraw, pLevelChanged);
-			if (nCrossingsNew < nCrossingsOld) {
-				if (nCrossingsNew < queryBestKnown() && postNewResult(nCrossingsNew, &bestPos)) {
-					levels.storePos(bestPos);
+					nCrossingsOld = nCrossingsNew;
+					nFails = maxFails + 1;
+				} else {
+					--nFails;
 				}
 
-				nCrossingsOld = nCrossingsNew;
-				nFails = maxFails + 1;
-			} else {
-				--nFails;
-			}
+				// bottom-up traversal
+				nCrossingsNew =
+						traverseBottomUp(levels, pCrossMin, pCrossMinSimDraw, pLevelChanged);
+				if (nCrossingsNew < nCrossingsOld) {
+					if (nCrossingsNew < queryBestKnown()
+							&& postNewResult(nCrossingsNew, &bestPos)) {
+						levels.storePos(bestPos);
+					}
 
-		} while (nFails > 0);
+					nCrossingsOld = nCrossingsNew;
+					nFails = maxFails + 1;
+				} else {
+					--nFails;
+				}
+			} while (nFails > 0);
+		}
 
 		if (!getNextRun()) {
 			break;
@@ -850,6 +955,7 @@ SugiyamaLayout::SugiyamaLayout() {
 
 	m_fails = 4;
 	m_runs = 15;
+	m_windowSize = 0;
 	m_transpose = true;
 	m_permuteFirst = false;
 
@@ -0,0 +1,208 @@
+/** \file
+ * \brief Implementation of class BatchPlanarityTest.
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.md in the OGDF root directory for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, see
+ * http://www.gnu.org/copyleft/gpl.html
+ */
+
+#include <ogdf/basic/Array.h>
+#include <ogdf/basic/Graph.h>
+#include <ogdf/basic/basic.h>
+#include <ogdf/basic/internal/parallel.h>
+#include <ogdf/planarity/BatchPlanarityTest.h>
+#include <ogdf/planarity/BoyerMyrvold.h>
+#include <ogdf/planarity/LRPlanarityTest.h>
+
+#include <atomic>
+#include <cctype>
+#include <functional>
+#include <istream>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace ogdf {
+
+using std::atomic;
+
+//! Number of graphs a thread takes at once.
+static const int c_chunkSize = 16;
+
+//! Number of lines of a graph6 stream that are read and tested at once.
+static const int c_streamBatchSize = 4096;
+
+unsigned int BatchPlanarityTest::numberOfThreads(int count) const {
+	int chunks = (count + c_chunkSize - 1) / c_chunkSize;
+	return max(1u, min(m_maxThreads, static_cast<unsigned int>(chunks)));
+}
+
+void BatchPlanarityTest::forAll(int count, unsigned int nThreads,
+		const std::function<void(int, unsigned int)>& work) const {
+	internal::parallelFor(nThreads, count, c_chunkSize, [&](int first, int last, unsigned int id) {
+		for (int i = first; i < last; ++i) {
+			work(i, id);
+		}
+	});
+}
+
+void BatchPlanarityTest::isPlanar(const std::vector<const Graph*>& graphs,
+		std::vector<bool>& planar) const {
+	const int count = static_cast<int>(graphs.size());
+	const unsigned int nThreads = numberOfThreads(count);
+
+	// std::vector<bool> must not be written concurrently
+	std::vector<char> result(count);
+	std::vector<BoyerMyrvold> bm(nThreads);
+	forAll(count, nThreads,
+			[&](int i, unsigned int id) { result[i] = bm[id].isPlanar(*graphs[i]); });
+
+	planar.assign(result.begin(), result.end());
+}
+
+void BatchPlanarityTest::planarEmbed(const std::vector<Graph*>& graphs,
+		std::vector<bool>& planar) const {
+	const int count = static_cast<int>(graphs.size());
+	const unsigned int nThreads = numberOfThreads(count);
+
+	std::vector<char> result(count);
+	std::vector<BoyerMyrvold> bm(nThreads);
+	forAll(count, nThreads,
+			[&](int i, unsigned int id) { result[i] = bm[id].planarEmbed(*graphs[i]); });
+
+	planar.assign(result.begin(), result.end());
+}
+
+bool BatchPlanarityTest::isPlanarGraph6(const std::vector<std::string>& graph6,
+		std::vector<bool>& planar) const {
+	const int count = static_cast<int>(graph6.size());
+	const unsigned int nThreads = numberOfThreads(count);
+
+	std::vector<char> result(count);
+	std::vector<LRPlanarityTest> test(nThreads);
+	atomic<bool> valid(true);
+	forAll(count, nThreads, [&](int i, unsigned int id) {
+		int n;
+		if (decodeGraph6(graph6[i], test[id], n)) {
+			result[i] = test[id].isPlanar(n);
+		} else {
+			result[i] = false;
+			valid = false;
+		}
+	});
+
+	planar.assign(result.begin(), result.end());
+	return valid;
+}
+
+bool BatchPlanarityTest::isPlanarGraph6(std::istream& is, std::vector<bool>& planar) const {
+	planar.clear();
+	bool valid = true;
+
+	// read and test the stream in batches, so only one batch is kept in memory
+	std::vector<std::string> graph6;
+	std::vector<bool> result;
+	for (;;) {
+		graph6.clear();
+		for (std::string line;
+				static_cast<int>(graph6.size()) < c_streamBatchSize && std::getline(is, line);) {
+			while (!line.empty() && isspace(static_cast<unsigned char>(line.back()))) {
+				line.pop_back();
+			}
+			if (!line.empty()) {
+				graph6.push_back(std::move(line));
+			}
+		}
+		if (graph6.empty()) {
+			return valid;
+		}
+
+		valid &= isPlanarGraph6(graph6, result);
+		planar.insert(planar.end(), result.begin(), result.end());
+	}
+}
+
+bool BatchPlanarityTest::decodeGraph6(const std::string& graph6, LRPlanarityTest& test, int& n) {
+	const int c_asciishift = 63;
+	const std::string header = ">>graph6<<";
+
+	test.clear();
+	n = 0;
+
+	size_t pos = graph6.compare(0, header.length(), header) == 0 ? header.length() : 0;
+	auto sixtet = [&](size_t i, long long& value) {
+		if (i >= graph6.length() || graph6[i] < '?' || graph6[i] > '~') {
+			return false;
+		}
+		value = (value << 6) | (graph6[i] - c_asciishift);
+		return true;
+	};
+
+	// number of nodes, encoded in 1, 4 or 8 bytes
+	long long numberOfNodes = 0;
+	if (pos < graph6.length() && graph6[pos] != '~') {
+		if (!sixtet(pos++, numberOfNodes)) {
+			return false;
+		}
+	} else {
+		int bytes = pos + 1 < graph6.length() && graph6[pos + 1] == '~' ? 6 : 3;
+		pos += bytes == 6 ? 2 : 1;
+		for (int i = 0; i < bytes; ++i) {
+			if (!sixtet(pos++, numberOfNodes)) {
+				return false;
+			}
+		}
+	}
+	if (numberOfNodes > std::numeric_limits<int>::max()) {
+		return false;
+	}
+	n = static_cast<int>(numberOfNodes);
+
+	// upper triangle of the adjacency matrix, column by column
+	long long bits = numberOfNodes * (numberOfNodes - 1) / 2;
+	if (static_cast<long long>(graph6.length() - pos) != (bits + 5) / 6) {
+		return false;
+	}
+
+	int source = 0, target = 1;
+	for (; pos < graph6.length(); ++pos) {
+		long long byte = 0;
+		if (!sixtet(pos, byte)) {
+			return false;
+		}
+		for (int bit = 5; bit >= 0 && target < n; --bit) {
+			if (byte & (1 << bit)) {
+				test.addEdge(source, target);
+			}
+			if (++source == target) {
+				source = 0;
+				++target;
+			}
+		}
+	}
+
+	return true;
+}
+
+}
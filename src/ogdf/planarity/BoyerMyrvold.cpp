@@ -46,26 +46,11 @@
 namespace ogdf {
 
 
-// returns true, if g is planar, false otherwise. this is the
-// routine, which avoids the overhead of copying the input graph.
-// it is therefore not suitable, if your graph must not be changed.
-bool BoyerMyrvold::isPlanarDestructive(Graph& g) {
-	clear();
-	nOfStructures = 0;
-
-	// less than 9 edges are always planar
-	if (g.numberOfEdges() < 9) {
-		return true;
-	}
-
-	SListPure<KuratowskiStructure> dummy;
-	pBMP = new BoyerMyrvoldPlanar(g, false, BoyerMyrvoldPlanar::EmbeddingGrade::doNotEmbed, false,
-			dummy, 0, true, false);
-	return pBMP->start();
-}
+// returns true, if g is planar, false otherwise.
+bool BoyerMyrvold::isPlanarDestructive(Graph& g) { return isPlanar(g); }
 
 // returns true, if g is planar, false otherwise.
-// use this slower routine, if your graph must not be changed.
+// the pure test does not need an embedding, so it runs on the reusable workspace.
 bool BoyerMyrvold::isPlanar(const Graph& g) {
 	clear();
 	nOfStructures = 0;
@@ -75,11 +60,7 @@ bool BoyerMyrvold::isPlanar(const Graph& g) {
 		return true;
 	}
 
-	Graph h(g);
-	SListPure<KuratowskiStructure> dummy;
-	pBMP = new BoyerMyrvoldPlanar(h, false, BoyerMyrvoldPlanar::EmbeddingGrade::doNotEmbed, false,
-			dummy, 0, true, false);
-	return pBMP->start();
+	return m_test.isPlanar(g);
 }
 
 // Transforms KuratowskiWrapper in KuratowskiSubdivision
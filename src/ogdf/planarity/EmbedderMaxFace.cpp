@@ -35,6 +35,7 @@
 #include <ogdf/basic/GraphList.h>
 #include <ogdf/basic/List.h>
 #include <ogdf/decomposition/BCTree.h>
+#include <ogdf/decomposition/BlockSPQRTrees.h>
 #include <ogdf/decomposition/StaticSPQRTree.h>
 #include <ogdf/planarity/EmbedderMaxFace.h>
 #include <ogdf/planarity/embedder/ConnectedSubgraph.h>
@@ -57,18 +58,7 @@ void EmbedderMaxFace::doCall(Graph& G, adjEntry& adjExternal) {
 	//First step: calculate maximum face and node lengths
 
 	//compute block graphs and SPQR trees:
-	blockG.init(pBCTree->bcTree());
-	for (node n : pBCTree->bcTree().nodes) {
-		blockG[n] = std::make_unique<Graph>();
-	}
-	nBlockEmbedding_to_nH.init(pBCTree->bcTree());
-	eBlockEmbedding_to_eH.init(pBCTree->bcTree());
-	nH_to_nBlockEmbedding.init(pBCTree->bcTree());
-	eH_to_eBlockEmbedding.init(pBCTree->bcTree());
-	nodeLength.init(pBCTree->bcTree());
-	cstrLength.init(pBCTree->bcTree());
-	spqrTrees.init(pBCTree->bcTree(), nullptr);
-	computeBlockGraphs(rootBlockNode, nullptr);
+	computeBlockGraphsAndSPQRTrees(rootBlockNode);
 
 	//Bottom-Up-Traversal:
 	for (adjEntry adj : rootBlockNode->adjEntries) {
@@ -114,6 +104,21 @@ void EmbedderMaxFace::doCall(Graph& G, adjEntry& adjExternal) {
 	delete pBCTree;
 }
 
+void EmbedderMaxFace::computeBlockGraphsAndSPQRTrees(const node& rootBlockNode) {
+	blockG.init(pBCTree->bcTree());
+	for (node n : pBCTree->bcTree().nodes) {
+		blockG[n] = std::make_unique<Graph>();
+	}
+	nBlockEmbedding_to_nH.init(pBCTree->bcTree());
+	eBlockEmbedding_to_eH.init(pBCTree->bcTree());
+	nH_to_nBlockEmbedding.init(pBCTree->bcTree());
+	eH_to_eBlockEmbedding.init(pBCTree->bcTree());
+	nodeLength.init(pBCTree->bcTree());
+	cstrLength.init(pBCTree->bcTree());
+	computeBlockGraphs(rootBlockNode, nullptr);
+	buildSPQRTrees(blockG, spqrTrees, m_maxThreads);
+}
+
 void EmbedderMaxFace::computeBlockGraphs(const node& bT, const node& cH) {
 	//recursion:
 	for (adjEntry adj : bT->adjEntries) {
@@ -143,9 +148,6 @@ void EmbedderMaxFace::computeBlockGraphs(const node& bT, const node& cH) {
 			eH_to_eBlockEmbedding[bT]);
 	nodeLength[bT].init(*blockG[bT], 0);
 	cstrLength[bT].init(*blockG[bT], 0);
-	if (!blockG[bT]->empty() && blockG[bT]->numberOfNodes() != 1 && blockG[bT]->numberOfEdges() > 2) {
-		spqrTrees[bT] = new StaticSPQRTree(*blockG[bT]);
-	}
 }
 
 int EmbedderMaxFace::constraintMaxFace(const node& bT, const node& cH) {
@@ -37,6 +37,7 @@
 #include <ogdf/basic/List.h>
 #include <ogdf/basic/basic.h>
 #include <ogdf/decomposition/BCTree.h>
+#include <ogdf/decomposition/BlockSPQRTrees.h>
 #include <ogdf/decomposition/StaticSPQRTree.h>
 #include <ogdf/planarity/EmbedderMinDepth.h>
 #include <ogdf/planarity/embedder/ConnectedSubgraph.h>
@@ -68,8 +69,8 @@ void EmbedderMinDepth::doCall(Graph& G, adjEntry& adjExternal) {
 	nH_to_nBlockEmbedding.init(pBCTree->bcTree());
 	eH_to_eBlockEmbedding.init(pBCTree->bcTree());
 	nodeLength.init(pBCTree->bcTree());
-	spqrTrees.init(pBCTree->bcTree(), nullptr);
 	computeBlockGraphs(rootBlockNode, nullptr);
+	buildSPQRTrees(blockG, spqrTrees, m_maxThreads);
 
 	//Edge lengths of BC-tree, values m_{c, B} for all (c, B) \in bcTree:
 	m_cB.init(pBCTree->bcTree(), 0);
@@ -161,10 +162,6 @@ void EmbedderMinDepth::computeBlockGraphs(const node& bT, const node& cH) {
 	embedder::ConnectedSubgraph<int>::call(pBCTree->auxiliaryGraph(), *blockG[bT], m_cH,
 			nBlockEmbedding_to_nH[bT], eBlockEmbedding_to_eH[bT], nH_to_nBlockEmbedding[bT],
 			eH_to_eBlockEmbedding[bT]);
-
-	if (!blockG[bT]->empty() && blockG[bT]->numberOfNodes() != 1 && blockG[bT]->numberOfEdges() > 2) {
-		spqrTrees[bT] = new StaticSPQRTree(*blockG[bT]);
-	}
 }
 
 int EmbedderMinDepth::bottomUpTraversal(const node& bT, const node& cH) {
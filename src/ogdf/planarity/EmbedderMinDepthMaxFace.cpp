@@ -59,6 +59,9 @@ void EmbedderMinDepthMaxFace::doCall(Graph& G, adjEntry& adjExternal) {
 		return;
 	}
 
+	//compute block graphs and SPQR trees:
+	computeBlockGraphsAndSPQRTrees(rootBlockNode);
+
 
 	// First step: calculate min depth and node lengths
 
@@ -167,6 +170,10 @@ void EmbedderMinDepthMaxFace::doCall(Graph& G, adjEntry& adjExternal) {
 		G.sort(n, newOrder[n]);
 	}
 
+	for (node v : pBCTree->bcTree().nodes) {
+		delete spqrTrees[v];
+	}
+
 	delete pBCTree;
 }
 
@@ -212,24 +219,20 @@ int EmbedderMinDepthMaxFace::bottomUpTraversal(const node& bT, const node& cH) {
 		md_nodeLength[*iterator] = 1;
 	}
 
-	//generate block graph of bT:
-	Graph blockGraph_bT;
-	node cInBlockGraph_bT;
-	NodeArray<int> nodeLengthSG(blockGraph_bT);
-	embedder::ConnectedSubgraph<int>::call(pBCTree->auxiliaryGraph(), blockGraph_bT, cH,
-			cInBlockGraph_bT, md_nodeLength, nodeLengthSG);
-
 	//leafs of BC-tree:
 	if (M_B.size() == 0) {
 		return 1;
 	}
 
+	NodeArray<int> nodeLengthSG;
+	blockNodeLengths(bT, md_nodeLength, nodeLengthSG);
+
 	//set edge length for all edges in block graph to 0:
-	EdgeArray<int> zeroEdgeLength(blockGraph_bT, 0);
+	EdgeArray<int> zeroEdgeLength(*blockG[bT], 0);
 
 	//compute maximum external face of block graph and get its size:
-	int cstrLength_B_c = EmbedderMaxFaceBiconnectedGraphs<int>::computeSize(blockGraph_bT,
-			cInBlockGraph_bT, nodeLengthSG, zeroEdgeLength);
+	int cstrLength_B_c = EmbedderMaxFaceBiconnectedGraphs<int>::computeSize(*blockG[bT],
+			nH_to_nBlockEmbedding[bT][cH], nodeLengthSG, zeroEdgeLength, spqrTrees[bT]);
 
 	if (cstrLength_B_c == M_B.size()) {
 		return m_B;
@@ -274,23 +277,17 @@ void EmbedderMinDepthMaxFace::topDownTraversal(const node& bT) {
 		m_nodeLength[*iterator] = 1;
 	}
 
-	//generate block graph of bT:
-	Graph blockGraph_bT;
-	NodeArray<int> nodeLengthSG(blockGraph_bT);
-	NodeArray<node> nG_to_nSG;
-	embedder::ConnectedSubgraph<int>::call(pBCTree->auxiliaryGraph(), blockGraph_bT,
-			(*(pBCTree->hEdges(bT).begin()))->source(), m_nodeLength, nodeLengthSG, nG_to_nSG);
+	//block graph of bT:
+	const Graph& blockGraph_bT = *blockG[bT];
+	NodeArray<int> nodeLengthSG;
+	blockNodeLengths(bT, m_nodeLength, nodeLengthSG);
+	const NodeArray<node>& nG_to_nSG = nH_to_nBlockEmbedding[bT];
 
 	//set edge length for all edges in block graph to 0:
 	EdgeArray<int> edgeLengthBlock(blockGraph_bT, 0);
 
 	//compute size of a maximum external face of block graph:
-	StaticSPQRTree* spqrTree = nullptr;
-	if (!blockGraph_bT.empty() && blockGraph_bT.numberOfNodes() != 1
-			&& blockGraph_bT.numberOfEdges() > 2) {
-		spqrTree = new StaticSPQRTree(blockGraph_bT);
-	}
-
+	StaticSPQRTree* spqrTree = spqrTrees[bT];
 	NodeArray<EdgeArray<int>> edgeLengthSkel;
 	int cstrLength_B_c = EmbedderMaxFaceBiconnectedGraphs<int>::computeSize(blockGraph_bT,
 			nodeLengthSG, edgeLengthBlock, spqrTree, edgeLengthSkel);
@@ -346,18 +343,15 @@ void EmbedderMinDepthMaxFace::topDownTraversal(const node& bT) {
 					md_nodeLength[*iterator] = 1;
 				}
 
-				Graph blockGraphBT;
-				node cInBlockGraph_bT;
-				NodeArray<int> nodeLengthSGBT(blockGraphBT);
-				embedder::ConnectedSubgraph<int>::call(pBCTree->auxiliaryGraph(), blockGraphBT, cH,
-						cInBlockGraph_bT, md_nodeLength, nodeLengthSGBT);
+				NodeArray<int> nodeLengthSGBT;
+				blockNodeLengths(bT, md_nodeLength, nodeLengthSGBT);
 
 				//set edge length for all edges in block graph to 0:
-				EdgeArray<int> zeroEdgeLength(blockGraphBT, 0);
+				EdgeArray<int> zeroEdgeLength(blockGraph_bT, 0);
 
 				//compute a maximum external face size of a face containing c in block graph:
 				int maxFaceSizeInBlock = EmbedderMaxFaceBiconnectedGraphs<int>::computeSize(
-						blockGraphBT, cInBlockGraph_bT, nodeLengthSGBT, zeroEdgeLength);
+						blockGraph_bT, nG_to_nSG[cH], nodeLengthSGBT, zeroEdgeLength, spqrTree);
 				if (M2[bT].size() == 0) {
 					cB[e_bT_cT] = 1;
 				} else {
@@ -538,46 +532,39 @@ void EmbedderMinDepthMaxFace::topDownTraversal(const node& bT) {
 	} else {
 		minDepth[bT] = m_B + 2;
 	}
-
-	delete spqrTree;
 }
 
 int EmbedderMinDepthMaxFace::constraintMaxFace(const node& bT, const node& cH) {
 	computeNodeLength(bT, [&](node vH) -> int& { return mf_nodeLength[vH]; });
 
 	mf_nodeLength[cH] = 0;
-	Graph blockGraph;
-	node cInBlockGraph;
-	NodeArray<int> nodeLengthSG(blockGraph);
-	embedder::ConnectedSubgraph<int>::call(pBCTree->auxiliaryGraph(), blockGraph, cH, cInBlockGraph,
-			mf_nodeLength, nodeLengthSG);
-	EdgeArray<int> edgeLengthSG(blockGraph, 1);
-	int cstrLengthBc = EmbedderMaxFaceBiconnectedGraphs<int>::computeSize(blockGraph, cInBlockGraph,
-			nodeLengthSG, edgeLengthSG);
+	NodeArray<int> nodeLengthSG;
+	blockNodeLengths(bT, mf_nodeLength, nodeLengthSG);
+	EdgeArray<int> edgeLengthSG(*blockG[bT], 1);
+	int cstrLengthBc = EmbedderMaxFaceBiconnectedGraphs<int>::computeSize(*blockG[bT],
+			nH_to_nBlockEmbedding[bT][cH], nodeLengthSG, edgeLengthSG, spqrTrees[bT]);
 	mf_cstrLength[cH] = cstrLengthBc;
 	return cstrLengthBc;
 }
 
 void EmbedderMinDepthMaxFace::maximumFaceRec(const node& bT, node& bT_opt, int& ell_opt) {
 	//(B*, \ell*) := (B, size of a maximum face in B):
-	Graph blockGraph_bT;
-	NodeArray<int> nodeLengthSG(blockGraph_bT);
-	NodeArray<node> nG_to_nSG;
-	embedder::ConnectedSubgraph<int>::call(pBCTree->auxiliaryGraph(), blockGraph_bT,
-			(*(pBCTree->hEdges(bT).begin()))->source(), mf_nodeLength, nodeLengthSG, nG_to_nSG);
-	StaticSPQRTree* spqrTree = nullptr;
-	if (!blockGraph_bT.empty() && blockGraph_bT.numberOfNodes() != 1
-			&& blockGraph_bT.numberOfEdges() > 2) {
-		spqrTree = new StaticSPQRTree(blockGraph_bT);
-	}
+	NodeArray<int> nodeLengthSG;
+	blockNodeLengths(bT, mf_nodeLength, nodeLengthSG);
 
 	internalMaximumFaceRec(
-			bT, bT_opt, ell_opt, blockGraph_bT, nodeLengthSG, spqrTree,
-			[&](node cH) -> node& { return nG_to_nSG[cH]; },
+			bT, bT_opt, ell_opt, *blockG[bT], nodeLengthSG, spqrTrees[bT],
+			[&](node cH) -> node& { return nH_to_nBlockEmbedding[bT][cH]; },
 			[&](node v, node u) -> int& { return mf_cstrLength[u]; },
 			[&](node v, node u) -> int& { return mf_nodeLength[u]; }, &maxFaceSize[bT]);
+}
 
-	delete spqrTree;
+void EmbedderMinDepthMaxFace::blockNodeLengths(const node& bT, const NodeArray<int>& nodeLengthH,
+		NodeArray<int>& nodeLengthBlock) {
+	nodeLengthBlock.init(*blockG[bT]);
+	for (node vB : blockG[bT]->nodes) {
+		nodeLengthBlock[vB] = nodeLengthH[nBlockEmbedding_to_nH[bT][vB]];
+	}
 }
 
 void EmbedderMinDepthMaxFace::embedBlock(const node& bT, const node& cT,
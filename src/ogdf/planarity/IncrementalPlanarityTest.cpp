@@ -0,0 +1,249 @@
+/** \file
+ * \brief Implementation of class IncrementalPlanarityTest.
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.md in the OGDF root directory for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, see
+ * http://www.gnu.org/copyleft/gpl.html
+ */
+
+#include <ogdf/basic/Graph.h>
+#include <ogdf/basic/basic.h>
+#include <ogdf/planarity/IncrementalPlanarityTest.h>
+
+#include <utility>
+#include <vector>
+
+namespace ogdf {
+
+IncrementalPlanarityTest::IncrementalPlanarityTest(const Graph& G) : m_G(G) {
+	const int n = G.maxNodeIndex() + 1;
+
+	m_component.resize(n);
+	for (int x = 0; x < n; ++x) {
+		m_component[x] = x;
+	}
+	m_componentSize.assign(n, 1);
+	m_parent.assign(n, -1);
+	m_depth.assign(n, 0);
+	m_treeBlock.assign(n, -1);
+	m_treeAdj.resize(n);
+	m_nodeMark.assign(n, 0);
+	m_localIndex.resize(n);
+}
+
+int IncrementalPlanarityTest::findComponent(int x) {
+	int r = x;
+	while (m_component[r] != r) {
+		r = m_component[r];
+	}
+	while (m_component[x] != r) {
+		int next = m_component[x];
+		m_component[x] = r;
+		x = next;
+	}
+	return r;
+}
+
+int IncrementalPlanarityTest::findBlock(int b) {
+	int r = b;
+	while (m_block[r] != r) {
+		r = m_block[r];
+	}
+	while (m_block[b] != r) {
+		int next = m_block[b];
+		m_block[b] = r;
+		b = next;
+	}
+	return r;
+}
+
+int IncrementalPlanarityTest::newBlock(int top, int numberOfNodes) {
+	int b = static_cast<int>(m_block.size());
+	m_block.push_back(b);
+	m_blockTop.push_back(top);
+	m_blockNodes.push_back(numberOfNodes);
+	m_blockEdges.emplace_back();
+	m_blockMark.push_back(0);
+	++m_numberOfBlocks;
+	return b;
+}
+
+int IncrementalPlanarityTest::collectPath(int x, int y) {
+	++m_stamp;
+	m_path.clear();
+
+	// always ascend from the deeper node to the top of its block
+	while (x != y) {
+		int& w = m_depth[x] >= m_depth[y] ? x : y;
+		int b = parentBlock(w);
+		if (m_blockMark[b] != m_stamp) {
+			m_blockMark[b] = m_stamp;
+			m_path.push_back(b);
+		}
+		w = m_blockTop[b];
+	}
+
+	return x;
+}
+
+bool IncrementalPlanarityTest::isPlanarWith(node u, node v) {
+	int x = index(u), y = index(v);
+	if (x == y || findComponent(x) != findComponent(y)) {
+		// self-loops and bridges never destroy planarity
+		return true;
+	}
+
+	collectPath(x, y);
+
+	// the merged block is planar iff G+(u,v) is planar
+	int numberOfNodes = 1;
+	for (int b : m_path) {
+		numberOfNodes += m_blockNodes[b] - 1;
+	}
+	if (numberOfNodes < 5) {
+		return true;
+	}
+
+	++m_stamp;
+	int n = 0;
+	auto localIndex = [&](int w) {
+		if (m_nodeMark[w] != m_stamp) {
+			m_nodeMark[w] = m_stamp;
+			m_localIndex[w] = n++;
+		}
+		return m_localIndex[w];
+	};
+
+	m_test.clear();
+	for (int b : m_path) {
+		const std::vector<int>& edges = m_blockEdges[b];
+		for (size_t i = 0; i < edges.size(); i += 2) {
+			m_test.addEdge(localIndex(edges[i]), localIndex(edges[i + 1]));
+		}
+	}
+	m_test.addEdge(localIndex(x), localIndex(y));
+
+	OGDF_ASSERT(n == numberOfNodes);
+	return m_test.isPlanar(n);
+}
+
+void IncrementalPlanarityTest::insert(node u, node v) {
+	int x = index(u), y = index(v);
+	if (x == y) {
+		return;
+	}
+	++m_numberOfEdges;
+
+	int cx = findComponent(x), cy = findComponent(y);
+	if (cx != cy) {
+		// the edge is a bridge, so it forms a block of its own
+		if (m_componentSize[cx] > m_componentSize[cy]) {
+			std::swap(x, y);
+			std::swap(cx, cy);
+		}
+		int b = newBlock(y, 2);
+		m_blockEdges[b] = {x, y};
+		attach(x, y, b);
+
+		m_component[cx] = cy;
+		m_componentSize[cy] += m_componentSize[cx];
+		return;
+	}
+
+	// merge all blocks on the path into the one with the most edges
+	int top = collectPath(x, y);
+	int r = m_path.front();
+	int numberOfNodes = 1;
+	for (int b : m_path) {
+		if (m_blockEdges[b].size() > m_blockEdges[r].size()) {
+			r = b;
+		}
+		numberOfNodes += m_blockNodes[b] - 1;
+	}
+
+	std::vector<int>& edges = m_blockEdges[r];
+	for (int b : m_path) {
+		if (b != r) {
+			edges.insert(edges.end(), m_blockEdges[b].begin(), m_blockEdges[b].end());
+			std::vector<int>().swap(m_blockEdges[b]);
+			m_block[b] = r;
+			--m_numberOfBlocks;
+		}
+	}
+	edges.push_back(x);
+	edges.push_back(y);
+	m_blockNodes[r] = numberOfNodes;
+	m_blockTop[r] = top;
+}
+
+void IncrementalPlanarityTest::attach(int x, int y, int b) {
+	m_treeAdj[x].push_back(y);
+	m_treeAdj[y].push_back(x);
+
+	// Reroot the tree of x at x. Each stack entry stores a node together with
+	// its old parent and the old block of the edge to it, since the tree edge
+	// to the old parent now belongs to the child in the new orientation.
+	++m_stamp;
+	m_stack.clear();
+	m_stack.push_back(x);
+	m_stack.push_back(m_parent[x]);
+	m_stack.push_back(m_treeBlock[x]);
+	m_parent[x] = y;
+	m_depth[x] = m_depth[y] + 1;
+	m_treeBlock[x] = b;
+
+	while (!m_stack.empty()) {
+		int oldBlock = m_stack.back();
+		m_stack.pop_back();
+		int oldParent = m_stack.back();
+		m_stack.pop_back();
+		int w = m_stack.back();
+		m_stack.pop_back();
+
+		for (int z : m_treeAdj[w]) {
+			if (z == m_parent[w]) {
+				continue;
+			}
+
+			int edgeBlock = z == oldParent ? oldBlock : m_treeBlock[z];
+
+			// nodes are visited after their parents, so the first visited
+			// edge of a block starts at its topmost node
+			int rb = findBlock(edgeBlock);
+			if (m_blockMark[rb] != m_stamp) {
+				m_blockMark[rb] = m_stamp;
+				m_blockTop[rb] = w;
+			}
+
+			m_stack.push_back(z);
+			m_stack.push_back(m_parent[z]);
+			m_stack.push_back(m_treeBlock[z]);
+			m_parent[z] = w;
+			m_depth[z] = m_depth[w] + 1;
+			m_treeBlock[z] = edgeBlock;
+		}
+	}
+}
+
+}
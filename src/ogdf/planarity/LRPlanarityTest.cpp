@@ -0,0 +1,444 @@
+/** \file
+ * \brief Implementation of class LRPlanarityTest.
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.md in the OGDF root directory for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, see
+ * http://www.gnu.org/copyleft/gpl.html
+ */
+
+#include <ogdf/basic/Graph.h>
+#include <ogdf/basic/basic.h>
+#include <ogdf/planarity/LRPlanarityTest.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace ogdf {
+
+bool LRPlanarityTest::isPlanar(const Graph& G) {
+	m_nodeIndex.resize(G.maxNodeIndex() + 1);
+	int n = 0;
+	for (node v : G.nodes) {
+		m_nodeIndex[v->index()] = n++;
+	}
+
+	clear();
+	m_source.reserve(G.numberOfEdges());
+	m_target.reserve(G.numberOfEdges());
+	for (edge e : G.edges) {
+		addEdge(m_nodeIndex[e->source()->index()], m_nodeIndex[e->target()->index()]);
+	}
+
+	return isPlanar(n);
+}
+
+bool LRPlanarityTest::isPlanar(int n, const std::vector<int>& source,
+		const std::vector<int>& target) {
+	OGDF_ASSERT(source.size() == target.size());
+	m_source.assign(source.begin(), source.end());
+	m_target.assign(target.begin(), target.end());
+	return isPlanar(n);
+}
+
+bool LRPlanarityTest::isPlanar(int n) {
+	OGDF_ASSERT(n >= 0);
+	OGDF_ASSERT(m_source.size() == m_target.size());
+
+	// graphs with less than 5 nodes are always planar
+	if (n < 5) {
+		return true;
+	}
+
+	removeMultiEdges(n);
+	const int m = static_cast<int>(m_tail.size());
+
+	// graphs with less than 9 edges are always planar, and
+	// simple planar graphs have at most 3n-6 edges
+	if (m < 9) {
+		return true;
+	}
+	if (m > 3 * n - 6) {
+		return false;
+	}
+
+	buildAdjacency(n);
+
+	// orientation phase
+	m_height.assign(n, -1);
+	m_parentEdge.assign(n, -1);
+	m_returning.assign(n, 0);
+	m_lowpt.assign(m, -1);
+	m_lowpt2.resize(m);
+	m_nesting.resize(m);
+	m_roots.clear();
+	for (int v = 0; v < n; ++v) {
+		if (m_height[v] == -1) {
+			m_roots.push_back(v);
+			orient(v);
+		}
+	}
+
+	sortByNestingDepth(n);
+
+	// testing phase
+	m_ref.assign(m, -1);
+	m_lowptEdge.assign(m, -1);
+	m_stackBottom.resize(m);
+	for (int root : m_roots) {
+		m_S.clear();
+		if (!testRoot(root)) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void LRPlanarityTest::removeMultiEdges(int n) {
+	const int m = static_cast<int>(m_source.size());
+
+	// bucket the edges by their smaller endpoint
+	m_adjStart.assign(n + 1, 0);
+	for (int i = 0; i < m; ++i) {
+		OGDF_ASSERT(0 <= m_source[i] && m_source[i] < n);
+		OGDF_ASSERT(0 <= m_target[i] && m_target[i] < n);
+		if (m_source[i] != m_target[i]) {
+			++m_adjStart[std::min(m_source[i], m_target[i]) + 1];
+		}
+	}
+	for (int v = 0; v < n; ++v) {
+		m_adjStart[v + 1] += m_adjStart[v];
+	}
+
+	m_adjPos.assign(m_adjStart.begin(), m_adjStart.end() - 1);
+	m_bucket.resize(m_adjStart[n]);
+	for (int i = 0; i < m; ++i) {
+		int u = m_source[i], v = m_target[i];
+		if (u != v) {
+			m_bucket[m_adjPos[std::min(u, v)]++] = std::max(u, v);
+		}
+	}
+
+	// keep the first of all edges with the same larger endpoint
+	m_height.assign(n, -1); // used as time stamps
+	m_tail.clear();
+	m_head.clear();
+	for (int u = 0; u < n; ++u) {
+		for (int i = m_adjStart[u]; i < m_adjStart[u + 1]; ++i) {
+			int v = m_bucket[i];
+			if (m_height[v] != u) {
+				m_height[v] = u;
+				m_tail.push_back(u);
+				m_head.push_back(v);
+			}
+		}
+	}
+}
+
+void LRPlanarityTest::buildAdjacency(int n) {
+	const int m = static_cast<int>(m_tail.size());
+
+	m_adjStart.assign(n + 1, 0);
+	for (int e = 0; e < m; ++e) {
+		++m_adjStart[m_tail[e] + 1];
+		++m_adjStart[m_head[e] + 1];
+	}
+	for (int v = 0; v < n; ++v) {
+		m_adjStart[v + 1] += m_adjStart[v];
+	}
+
+	m_adjPos.assign(m_adjStart.begin(), m_adjStart.end() - 1);
+	m_adj.resize(2 * m);
+	for (int e = 0; e < m; ++e) {
+		m_adj[m_adjPos[m_tail[e]]++] = e;
+		m_adj[m_adjPos[m_head[e]]++] = e;
+	}
+
+	m_adjPos.assign(m_adjStart.begin(), m_adjStart.end() - 1);
+}
+
+void LRPlanarityTest::orient(int root) {
+	m_height[root] = 0;
+	m_dfsStack.clear();
+	m_dfsStack.push_back(root);
+
+	while (!m_dfsStack.empty()) {
+		int v = m_dfsStack.back();
+		if (m_adjPos[v] == m_adjStart[v + 1]) {
+			m_dfsStack.pop_back();
+			continue;
+		}
+
+		int e = m_adj[m_adjPos[v]];
+		if (m_returning[v]) {
+			// the tree edge e has been completely processed
+			m_returning[v] = 0;
+		} else {
+			if (m_lowpt[e] != -1) {
+				// e has already been oriented
+				++m_adjPos[v];
+				continue;
+			}
+
+			int w = m_tail[e] == v ? m_head[e] : m_tail[e];
+			m_tail[e] = v;
+			m_head[e] = w;
+			m_lowpt[e] = m_lowpt2[e] = m_height[v];
+
+			if (m_height[w] == -1) {
+				// tree edge
+				m_parentEdge[w] = e;
+				m_height[w] = m_height[v] + 1;
+				m_returning[v] = 1;
+				m_dfsStack.push_back(w);
+				continue;
+			}
+
+			// back edge
+			m_lowpt[e] = m_height[w];
+		}
+
+		// determine nesting depth
+		m_nesting[e] = 2 * m_lowpt[e] + (m_lowpt2[e] < m_height[v] ? 1 : 0);
+
+		// update lowpoints of the parent edge
+		int parent = m_parentEdge[v];
+		if (parent != -1) {
+			if (m_lowpt[e] < m_lowpt[parent]) {
+				m_lowpt2[parent] = std::min(m_lowpt[parent], m_lowpt2[e]);
+				m_lowpt[parent] = m_lowpt[e];
+			} else if (m_lowpt[e] > m_lowpt[parent]) {
+				m_lowpt2[parent] = std::min(m_lowpt2[parent], m_lowpt[e]);
+			} else {
+				m_lowpt2[parent] = std::min(m_lowpt2[parent], m_lowpt2[e]);
+			}
+		}
+
+		++m_adjPos[v];
+	}
+}
+
+void LRPlanarityTest::sortByNestingDepth(int n) {
+	const int m = static_cast<int>(m_tail.size());
+
+	// bucket sort all edges by nesting depth (which is at most 2n-1)...
+	m_bucket.assign(2 * n + 1, 0);
+	for (int e = 0; e < m; ++e) {
+		++m_bucket[m_nesting[e] + 1];
+	}
+	for (int i = 0; i < 2 * n; ++i) {
+		m_bucket[i + 1] += m_bucket[i];
+	}
+	m_dfsStack.resize(m);
+	for (int e = 0; e < m; ++e) {
+		m_dfsStack[m_bucket[m_nesting[e]]++] = e;
+	}
+
+	// ...and distribute them stably to the out-edge lists of their tails
+	m_adjStart.assign(n + 1, 0);
+	for (int e = 0; e < m; ++e) {
+		++m_adjStart[m_tail[e] + 1];
+	}
+	for (int v = 0; v < n; ++v) {
+		m_adjStart[v + 1] += m_adjStart[v];
+	}
+
+	m_adjPos.assign(m_adjStart.begin(), m_adjStart.end() - 1);
+	for (int e : m_dfsStack) {
+		m_adj[m_adjPos[m_tail[e]]++] = e;
+	}
+
+	m_adjPos.assign(m_adjStart.begin(), m_adjStart.end() - 1);
+}
+
+bool LRPlanarityTest::testRoot(int root) {
+	m_dfsStack.clear();
+	m_dfsStack.push_back(root);
+
+	while (!m_dfsStack.empty()) {
+		int v = m_dfsStack.back();
+		int ei;
+
+		if (m_returning[v]) {
+			// the tree edge ei has been completely processed
+			m_returning[v] = 0;
+			ei = m_adj[m_adjPos[v]];
+		} else {
+			if (m_adjPos[v] == m_adjStart[v + 1]) {
+				// remove back edges returning to the parent
+				m_dfsStack.pop_back();
+				if (m_parentEdge[v] != -1) {
+					removeBackEdges(m_parentEdge[v]);
+				}
+				continue;
+			}
+
+			ei = m_adj[m_adjPos[v]];
+			m_stackBottom[ei] = static_cast<int>(m_S.size());
+
+			int w = m_head[ei];
+			if (m_parentEdge[w] == ei) {
+				// tree edge
+				m_returning[v] = 1;
+				m_dfsStack.push_back(w);
+				continue;
+			}
+
+			// back edge
+			m_lowptEdge[ei] = ei;
+			m_S.emplace_back();
+			m_S.back().rightLow = m_S.back().rightHigh = ei;
+		}
+
+		// integrate new return edges
+		if (m_lowpt[ei] < m_height[v]) {
+			int e = m_parentEdge[v];
+			if (m_adjPos[v] == m_adjStart[v]) {
+				m_lowptEdge[e] = m_lowptEdge[ei];
+			} else if (!addConstraints(ei, e)) {
+				return false;
+			}
+		}
+
+		++m_adjPos[v];
+	}
+
+	return true;
+}
+
+bool LRPlanarityTest::addConstraints(int ei, int e) {
+	ConflictPair P;
+
+	// merge return edges of ei into P.right
+	do {
+		ConflictPair Q = m_S.back();
+		m_S.pop_back();
+		if (!Q.leftEmpty()) {
+			Q.swap();
+		}
+		if (!Q.leftEmpty()) {
+			return false;
+		}
+		if (m_lowpt[Q.rightLow] > m_lowpt[e]) {
+			// merge intervals
+			if (P.rightEmpty()) {
+				P.rightHigh = Q.rightHigh;
+			} else {
+				m_ref[P.rightLow] = Q.rightHigh;
+			}
+			P.rightLow = Q.rightLow;
+		} else {
+			// align
+			m_ref[Q.rightLow] = m_lowptEdge[e];
+		}
+	} while (static_cast<int>(m_S.size()) != m_stackBottom[ei]);
+
+	// merge conflicting return edges of the preceding siblings into P.left
+	while (!m_S.empty()
+			&& (conflicting(m_S.back().leftHigh, ei) || conflicting(m_S.back().rightHigh, ei))) {
+		ConflictPair Q = m_S.back();
+		m_S.pop_back();
+		if (conflicting(Q.rightHigh, ei)) {
+			Q.swap();
+		}
+		if (conflicting(Q.rightHigh, ei)) {
+			return false;
+		}
+
+		// merge interval below lowpt(ei) into P.right
+		if (P.rightLow != -1) {
+			m_ref[P.rightLow] = Q.rightHigh;
+		}
+		if (Q.rightLow != -1) {
+			P.rightLow = Q.rightLow;
+		}
+
+		if (P.leftEmpty()) {
+			P.leftHigh = Q.leftHigh;
+		} else {
+			m_ref[P.leftLow] = Q.leftHigh;
+		}
+		P.leftLow = Q.leftLow;
+	}
+
+	if (!P.leftEmpty() || !P.rightEmpty()) {
+		m_S.push_back(P);
+	}
+	return true;
+}
+
+int LRPlanarityTest::lowest(const ConflictPair& P) const {
+	if (P.leftEmpty()) {
+		return m_lowpt[P.rightLow];
+	}
+	if (P.rightEmpty()) {
+		return m_lowpt[P.leftLow];
+	}
+	return std::min(m_lowpt[P.leftLow], m_lowpt[P.rightLow]);
+}
+
+void LRPlanarityTest::removeBackEdges(int e) {
+	const int u = m_tail[e];
+
+	// drop entire conflict pairs
+	while (!m_S.empty() && lowest(m_S.back()) == m_height[u]) {
+		m_S.pop_back();
+	}
+
+	if (!m_S.empty()) {
+		// one more conflict pair to consider
+		ConflictPair& P = m_S.back();
+
+		// trim left interval
+		while (P.leftHigh != -1 && m_head[P.leftHigh] == u) {
+			P.leftHigh = m_ref[P.leftHigh];
+		}
+		if (P.leftHigh == -1 && P.leftLow != -1) {
+			m_ref[P.leftLow] = P.rightLow;
+			P.leftLow = -1;
+		}
+
+		// trim right interval
+		while (P.rightHigh != -1 && m_head[P.rightHigh] == u) {
+			P.rightHigh = m_ref[P.rightHigh];
+		}
+		if (P.rightHigh == -1 && P.rightLow != -1) {
+			m_ref[P.rightLow] = P.leftLow;
+			P.rightLow = -1;
+		}
+	}
+
+	// side of e is side of a highest return edge
+	if (m_lowpt[e] < m_height[u] && !m_S.empty()) {
+		int hl = m_S.back().leftHigh;
+		int hr = m_S.back().rightHigh;
+		if (hl != -1 && (hr == -1 || m_lowpt[hl] > m_lowpt[hr])) {
+			m_ref[e] = hl;
+		} else {
+			m_ref[e] = hr;
+		}
+	}
+}
+
+}
@@ -72,7 +72,7 @@ using embedder::CrossingStructure;
 
 class SubgraphPlanarizer::ThreadMaster {
 	CrossingStructure* m_pCS;
-	int m_bestCR;
+	atomic<int> m_bestCR;
 
 	const PlanRep& m_pr;
 	int m_cc;
@@ -85,12 +85,14 @@ class SubgraphPlanarizer::ThreadMaster {
 	int m_seed;
 	atomic<int> m_perms;
 	int64_t m_stopTime;
+	bool m_boundedInsertion;
 	mutex m_mutex;
 
 public:
 	ThreadMaster(const PlanRep& pr, int cc, const EdgeArray<int>* pCost,
 			const EdgeArray<bool>* pForbid, const EdgeArray<uint32_t>* pEdgeSubGraphs,
-			const List<edge>& delEdges, int seed, int perms, int64_t stopTime);
+			const List<edge>& delEdges, int seed, int perms, int64_t stopTime,
+			bool boundedInsertion);
 
 	~ThreadMaster() { delete m_pCS; }
 
@@ -110,6 +112,9 @@ public:
 
 	int queryBestKnown() const { return m_bestCR; }
 
+	//! Returns the bound for edge insertion if bounded insertion is enabled, and nullptr otherwise.
+	const atomic<int>* insertionBound() const { return m_boundedInsertion ? &m_bestCR : nullptr; }
+
 	CrossingStructure* postNewResult(CrossingStructure* pCS);
 	bool getNextPerm();
 
@@ -136,7 +141,7 @@ private:
 
 SubgraphPlanarizer::ThreadMaster::ThreadMaster(const PlanRep& pr, int cc, const EdgeArray<int>* pCost,
 		const EdgeArray<bool>* pForbid, const EdgeArray<uint32_t>* pEdgeSubGraphs,
-		const List<edge>& delEdges, int seed, int perms, int64_t stopTime)
+		const List<edge>& delEdges, int seed, int perms, int64_t stopTime, bool boundedInsertion)
 	: m_pCS(nullptr)
 	, m_bestCR(std::numeric_limits<int>::max())
 	, m_pr(pr)
@@ -147,7 +152,8 @@ SubgraphPlanarizer::ThreadMaster::ThreadMaster(const PlanRep& pr, int cc, const
 	, m_delEdges(delEdges)
 	, m_seed(seed)
 	, m_perms(perms)
-	, m_stopTime(stopTime) { }
+	, m_stopTime(stopTime)
+	, m_boundedInsertion(boundedInsertion) { }
 
 CrossingStructure* SubgraphPlanarizer::ThreadMaster::postNewResult(CrossingStructure* pCS) {
 	int newCR = pCS->weightedCrossingNumber();
@@ -190,6 +196,10 @@ bool SubgraphPlanarizer::doSinglePermutation(PlanRepLight& prl, int cc, const Ed
 	deletedEdges.permute(rng);
 
 	ReturnType ret = inserter.callEx(prl, deletedEdges, pCost, pForbid, pEdgeSubGraphs);
+	if (!isSolution(ret)) {
+		return false; // no solution found (or insertion aborted due to the crossing bound)
+	}
+
 	SListPure<edge> reinsertedEdges;
 	for (int i = 0; i <= high; ++i) {
 		reinsertedEdges.pushBack(deletedEdges[i]);
@@ -197,10 +207,6 @@ bool SubgraphPlanarizer::doSinglePermutation(PlanRepLight& prl, int cc, const Ed
 
 	prl.removeNonSimpleCrossings(reinsertedEdges);
 
-	if (!isSolution(ret)) {
-		return false; // no solution found, that's bad...
-	}
-
 	crossingNumber = computeCrossingNumber(prl, pCost, pEdgeSubGraphs);
 	return true;
 }
@@ -223,6 +229,12 @@ void SubgraphPlanarizer::doWorkHelper(ThreadMaster& master, EdgeInsertionModule&
 	const EdgeArray<bool>* pForbid = master.forbid();
 	const EdgeArray<uint32_t>* pEdgeSubGraphs = master.edgeSubGraphs();
 
+	// a bound set by the caller stays in effect unless insertion is bounded here
+	const atomic<int>* callerBound = inserter.crossingBound();
+	if (master.insertionBound() != nullptr) {
+		inserter.crossingBound(master.insertionBound());
+	}
+
 	do {
 		int crossingNumber;
 		if (doSinglePermutation(prl, cc, pCost, pForbid, pEdgeSubGraphs, deletedEdges, inserter,
@@ -235,6 +247,8 @@ void SubgraphPlanarizer::doWorkHelper(ThreadMaster& master, EdgeInsertionModule&
 		}
 
 	} while (master.getNextPerm());
+
+	inserter.crossingBound(callerBound);
 }
 
 void SubgraphPlanarizer::Worker::operator()() {
@@ -254,6 +268,7 @@ SubgraphPlanarizer::SubgraphPlanarizer() {
 
 	m_permutations = 1;
 	m_setTimeout = true;
+	m_boundedInsertion = false;
 
 #ifdef OGDF_MEMORY_POOL_NTS
 	m_maxThreads = 1u;
@@ -270,6 +285,7 @@ SubgraphPlanarizer::SubgraphPlanarizer(const SubgraphPlanarizer& planarizer)
 
 	m_permutations = planarizer.m_permutations;
 	m_setTimeout = planarizer.m_setTimeout;
+	m_boundedInsertion = planarizer.m_boundedInsertion;
 	m_maxThreads = planarizer.m_maxThreads;
 }
 
@@ -286,6 +302,7 @@ SubgraphPlanarizer& SubgraphPlanarizer::operator=(const SubgraphPlanarizer& plan
 
 	m_permutations = planarizer.m_permutations;
 	m_setTimeout = planarizer.m_setTimeout;
+	m_boundedInsertion = planarizer.m_boundedInsertion;
 	m_maxThreads = planarizer.m_maxThreads;
 
 	return *this;
@@ -354,7 +371,7 @@ Module::ReturnType SubgraphPlanarizer::doCall(PlanRep& pr, int cc, const EdgeArr
 		// Parallel implementation
 		//
 		ThreadMaster master(pr, cc, pCostOrig, pForbiddenOrig, pEdgeSubGraphs, delEdges, seed,
-				m_permutations - nThreads, stopTime);
+				m_permutations - nThreads, stopTime, m_boundedInsertion);
 
 		Array<Worker*> worker(nThreads - 1);
 		Array<Thread> thread(nThreads - 1);
@@ -386,6 +403,12 @@ Module::ReturnType SubgraphPlanarizer::doCall(PlanRep& pr, int cc, const EdgeArr
 
 		bool foundSolution = false;
 		CrossingStructure cs;
+		atomic<int> bestCR(std::numeric_limits<int>::max());
+		const atomic<int>* callerBound = inserter.crossingBound();
+		if (m_boundedInsertion) {
+			inserter.crossingBound(&bestCR);
+		}
+
 		for (int i = 1; i <= m_permutations; ++i) {
 			int cr;
 			bool ok = doSinglePermutation(prl, cc, pCostOrig, pForbiddenOrig, pEdgeSubGraphs,
@@ -394,15 +417,18 @@ Module::ReturnType SubgraphPlanarizer::doCall(PlanRep& pr, int cc, const EdgeArr
 			if (ok && (!foundSolution || cr < cs.weightedCrossingNumber())) {
 				foundSolution = true;
 				cs.init(prl, cr);
+				bestCR = cr;
 			}
 
 			if (stopTime >= 0 && System::realTime() >= stopTime) {
 				if (!foundSolution) {
+					inserter.crossingBound(callerBound);
 					return ReturnType::TimeoutInfeasible; // not able to find a solution...
 				}
 				break;
 			}
 		}
+		inserter.crossingBound(callerBound);
 
 		cs.restore(pr, cc); // restore best solution in pr
 		crossingNumber = cs.weightedCrossingNumber();
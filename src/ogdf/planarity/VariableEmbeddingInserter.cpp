@@ -52,6 +52,7 @@ Module::ReturnType VariableEmbeddingInserter::doCall(PlanRepLight& pr, const Arr
 		const EdgeArray<uint32_t>* pEdgeSubgraph) {
 	VarEdgeInserterCore core(pr, pCostOrig, pForbiddenOrig, pEdgeSubgraph);
 	core.timeLimit(timeLimit());
+	core.crossingBound(crossingBound());
 
 	ReturnType retVal = core.call(origEdges, removeReinsert(), percentMostCrossed());
 	runsPostprocessing(core.runsPostprocessing());
@@ -47,6 +47,7 @@
 #include <ogdf/decomposition/StaticPlanarSPQRTree.h>
 #include <ogdf/decomposition/StaticSPQRTree.h>
 #include <ogdf/decomposition/StaticSkeleton.h>
+#include <ogdf/planarity/CrossingMinimizationModule.h>
 #include <ogdf/planarity/PlanRepLight.h>
 #include <ogdf/planarity/RemoveReinsertType.h>
 #include <ogdf/planarity/embedding_inserter/CrossingsBucket.h>
@@ -74,6 +75,13 @@ Module::ReturnType VarEdgeInserterCore::call(const Array<edge>& origEdges,
 		}
 	}
 
+	// crossing number of m_pr, only maintained if insertion is bounded
+	int crossingNumber = 0;
+	if (m_pCrossingBound != nullptr) {
+		crossingNumber =
+				CrossingMinimizationModule::computeCrossingNumber(m_pr, m_pCost, m_pSubgraph);
+	}
+
 	// insertion of edges
 	bool doIncrementalPostprocessing =
 			(rrPost == RemoveReinsertType::Incremental || rrPost == RemoveReinsertType::IncInserted);
@@ -86,6 +94,9 @@ Module::ReturnType VarEdgeInserterCore::call(const Array<edge>& origEdges,
 		insert(m_pr.copy(eOrig->source()), m_pr.copy(eOrig->target()), eip);
 
 		m_pr.insertEdgePath(eOrig, eip);
+		if (m_pCrossingBound != nullptr) {
+			crossingNumber += crossingNumberOf(eOrig);
+		}
 
 		if (doIncrementalPostprocessing) {
 			currentOrigEdges.pushBack(eOrig);
@@ -102,6 +113,9 @@ Module::ReturnType VarEdgeInserterCore::call(const Array<edge>& origEdges,
 						continue; // cannot improve
 					}
 
+					if (m_pCrossingBound != nullptr) {
+						crossingNumber -= crossingNumberOf(eOrigRR);
+					}
 					m_pr.removeEdgePath(eOrigRR);
 
 					storeTypeOfCurrentEdge(eOrigRR);
@@ -111,6 +125,9 @@ Module::ReturnType VarEdgeInserterCore::call(const Array<edge>& origEdges,
 					m_st = eOrigRR;
 					insert(m_pr.copy(eOrigRR->source()), m_pr.copy(eOrigRR->target()), iep);
 					m_pr.insertEdgePath(eOrigRR, iep);
+					if (m_pCrossingBound != nullptr) {
+						crossingNumber += crossingNumberOf(eOrigRR);
+					}
 
 					int newPathLength = (m_pCost != nullptr) ? costCrossed(eOrigRR)
 															 : (m_pr.chain(eOrigRR).size() - 1);
@@ -122,6 +139,10 @@ Module::ReturnType VarEdgeInserterCore::call(const Array<edge>& origEdges,
 				}
 			} while (improved);
 		}
+
+		if (m_pCrossingBound != nullptr && crossingNumber >= *m_pCrossingBound) {
+			return Module::ReturnType::NoFeasibleSolution;
+		}
 	}
 
 	if (!doIncrementalPostprocessing) {
@@ -336,6 +357,16 @@ static edge crossedEdge(adjEntry adj) {
 	return adj->theEdge();
 }
 
+int VarEdgeInserterCore::sharedSubgraphs(edge eOrig1, edge eOrig2) const {
+	int counter = 0;
+	for (int i = 0; i < 32; i++) {
+		if ((*m_pSubgraph)[eOrig1] & (*m_pSubgraph)[eOrig2] & (1 << i)) {
+			counter++;
+		}
+	}
+	return counter;
+}
+
 int VarEdgeInserterCore::costCrossed(edge eOrig) const {
 	int c = 0;
 
@@ -344,14 +375,8 @@ int VarEdgeInserterCore::costCrossed(edge eOrig) const {
 	ListConstIterator<edge> it = L.begin();
 	if (m_pSubgraph != nullptr) {
 		for (++it; it.valid(); ++it) {
-			int counter = 0;
 			edge e = m_pr.original(crossedEdge((*it)->adjSource()));
-			for (int i = 0; i < 32; i++) {
-				if ((*m_pSubgraph)[eOrig] & (*m_pSubgraph)[e] & (1 << i)) {
-					counter++;
-				}
-			}
-			c += counter * (*m_pCost)[e];
+			c += sharedSubgraphs(eOrig, e) * (*m_pCost)[e];
 		}
 		c *= c_bigM;
 		if (c == 0) {
@@ -366,6 +391,28 @@ int VarEdgeInserterCore::costCrossed(edge eOrig) const {
 	return c;
 }
 
+// returns the crossings on the path of eOrig, weighted as in
+// CrossingMinimizationModule::computeCrossingNumber()
+int VarEdgeInserterCore::crossingNumberOf(edge eOrig) const {
+	const List<edge>& L = m_pr.chain(eOrig);
+	if (m_pCost == nullptr) {
+		return L.size() - 1;
+	}
+
+	int c = 0;
+	ListConstIterator<edge> it = L.begin();
+	for (++it; it.valid(); ++it) {
+		edge e = m_pr.original(crossedEdge((*it)->adjSource()));
+		int cost = (*m_pCost)[eOrig] * (*m_pCost)[e];
+		if (m_pSubgraph != nullptr) {
+			cost *= sharedSubgraphs(eOrig, e);
+		}
+		c += cost;
+	}
+
+	return c;
+}
+
 // find optimal edge insertion path from s to t in connected
 // graph G
 void VarEdgeInserterCore::insert(node s, node t, SList<adjEntry>& eip) {
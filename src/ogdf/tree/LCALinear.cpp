@@ -0,0 +1,274 @@
+/** \file
+ * \brief Implementation of linear-space lowest common ancestors.
+ *
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.md in the OGDF root directory for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, see
+ * http://www.gnu.org/copyleft/gpl.html
+ */
+
+#include <ogdf/basic/Array.h>
+#include <ogdf/basic/Graph.h>
+#include <ogdf/basic/GraphList.h>
+#include <ogdf/basic/basic.h>
+#include <ogdf/basic/internal/intrinsics.h>
+#include <ogdf/basic/internal/parallel.h>
+#include <ogdf/tree/LCALinear.h>
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#ifdef OGDF_DEBUG
+#	include <ogdf/basic/simple_graph_alg.h>
+#endif
+
+namespace ogdf {
+
+namespace {
+
+node findRoot(const Graph& G) {
+	for (node v : G.nodes) {
+		if (v->indeg() == 0) {
+			return v;
+		}
+	}
+	return nullptr;
+}
+
+}
+
+LCALinear::LCALinear(const Graph& G, node root, unsigned int maxThreads)
+	: m_root(root == nullptr ? findRoot(G) : root), m_preorder(G, -1) {
+	this->maxThreads(maxThreads);
+	if (!G.empty()) {
+		OGDF_ASSERT(m_root != nullptr);
+		OGDF_ASSERT(m_root->graphOf() == &G);
+		number(G);
+		buildRMQ();
+	}
+}
+
+node LCALinear::call(node u, node v) const {
+	OGDF_ASSERT(u->graphOf() == m_root->graphOf());
+	OGDF_ASSERT(v->graphOf() == m_root->graphOf());
+	OGDF_ASSERT(m_preorder[u] >= 0);
+	OGDF_ASSERT(m_preorder[v] >= 0);
+
+	int i = m_preorder[u];
+	int j = m_preorder[v];
+	if (i == j) {
+		return u;
+	}
+	if (i > j) {
+		std::swap(i, j);
+	}
+	return m_parent[rmq(i + 1, j)];
+}
+
+void LCALinear::call(const std::vector<std::pair<node, node>>& queries,
+		std::vector<node>& result) const {
+	const int q = static_cast<int>(queries.size());
+	result.resize(q);
+	if (q == 0) {
+		return;
+	}
+
+	// look up the preorder ranges and bucket them by the block of their start
+	Array<std::pair<int, int>> range(q);
+	Array<int> first(m_blocks + 1);
+	first.fill(0);
+	for (int k = 0; k < q; ++k) {
+		int i = m_preorder[queries[k].first];
+		int j = m_preorder[queries[k].second];
+		OGDF_ASSERT(i >= 0);
+		OGDF_ASSERT(j >= 0);
+		if (i > j) {
+			std::swap(i, j);
+		}
+		range[k] = {i, j};
+		++first[(i >> s_logBlockSize) + 1];
+	}
+	for (int b = 0; b < m_blocks; ++b) {
+		first[b + 1] += first[b];
+	}
+	Array<int> order(q);
+	for (int k = 0; k < q; ++k) {
+		order[first[range[k].first >> s_logBlockSize]++] = k;
+	}
+
+	internal::parallelFor(m_maxThreads, q, 4096, [&](int begin, int end, unsigned int) {
+		for (int l = begin; l < end; ++l) {
+			const int k = order[l];
+			const int i = range[k].first;
+			const int j = range[k].second;
+			result[k] = i == j ? queries[k].first : m_parent[rmq(i + 1, j)];
+		}
+	});
+}
+
+void LCALinear::number(const Graph& G) {
+	OGDF_ASSERT(isSimple(G));
+	OGDF_ASSERT(isArborescence(G));
+
+	// collect the children of all nodes in adjacency arrays
+	const int size = G.maxNodeIndex() + 1;
+	Array<node> byIndex(size);
+	Array<node> all(G.numberOfNodes());
+	int k = 0;
+	for (node v : G.nodes) {
+		byIndex[v->index()] = v;
+		all[k++] = v;
+	}
+	Array<int> offset(size + 1);
+	offset.fill(0);
+	internal::parallelFor(m_maxThreads, all.size(), 1024, [&](int begin, int end, unsigned int) {
+		for (int l = begin; l < end; ++l) {
+			offset[all[l]->index() + 1] = all[l]->outdeg();
+		}
+	});
+	for (int i = 0; i < size; ++i) {
+		offset[i + 1] += offset[i];
+	}
+	Array<int> children(offset[size]);
+	internal::parallelFor(m_maxThreads, all.size(), 1024, [&](int begin, int end, unsigned int) {
+		for (int l = begin; l < end; ++l) {
+			const node v = all[l];
+			int pos = offset[v->index()];
+			for (adjEntry adj : v->adjEntries) {
+				if (adj->isSource()) {
+					children[pos++] = adj->twinNode()->index();
+				}
+			}
+		}
+	});
+
+	// traverse the tree in BFS order to obtain depths and subtree sizes
+	Array<int> bfs(G.numberOfNodes());
+	Array<int> parent(size);
+	Array<int> depth(size);
+	Array<int> subtree(size);
+	bfs[0] = m_root->index();
+	parent[m_root->index()] = -1;
+	depth[m_root->index()] = 0;
+	m_n = 1;
+	for (int head = 0; head < m_n; ++head) {
+		const int v = bfs[head];
+		for (int l = offset[v]; l < offset[v + 1]; ++l) {
+			const int w = children[l];
+			parent[w] = v;
+			depth[w] = depth[v] + 1;
+			bfs[m_n++] = w;
+		}
+	}
+	for (int l = m_n - 1; l >= 0; --l) {
+		const int v = bfs[l];
+		subtree[v] = 1;
+		for (int c = offset[v]; c < offset[v + 1]; ++c) {
+			subtree[v] += subtree[children[c]];
+		}
+	}
+
+	// place each subtree right after its parent and its preceding siblings' subtrees
+	Array<int> preorder(size);
+	preorder[m_root->index()] = 0;
+	for (int l = 0; l < m_n; ++l) {
+		const int v = bfs[l];
+		int pos = preorder[v] + 1;
+		for (int c = offset[v]; c < offset[v + 1]; ++c) {
+			preorder[children[c]] = pos;
+			pos += subtree[children[c]];
+		}
+	}
+
+	m_parent.init(m_n);
+	m_depth.init(m_n);
+	internal::parallelFor(m_maxThreads, m_n, 1024, [&](int begin, int end, unsigned int) {
+		for (int l = begin; l < end; ++l) {
+			const int v = bfs[l];
+			const int i = preorder[v];
+			m_preorder[byIndex[v]] = i;
+			m_parent[i] = parent[v] < 0 ? nullptr : byIndex[parent[v]];
+			m_depth[i] = depth[v];
+		}
+	});
+}
+
+void LCALinear::buildRMQ() {
+	m_blocks = (m_n + s_blockSize - 1) >> s_logBlockSize;
+	m_rangeJ = highestSetBit(static_cast<uint64_t>(m_blocks)) + 1;
+	m_stack.init(m_n);
+	m_table.init(m_rangeJ * m_blocks);
+
+	// in each block, record the positions of the suffix minima at each position
+	internal::parallelFor(m_maxThreads, m_blocks, 64, [&](int begin, int end, unsigned int) {
+		for (int b = begin; b < end; ++b) {
+			const int start = b << s_logBlockSize;
+			const int stop = min(start + s_blockSize, m_n);
+			uint64_t stack = 0;
+			for (int i = start; i < stop; ++i) {
+				while (stack != 0 && m_depth[start + highestSetBit(stack)] > m_depth[i]) {
+					stack &= ~(uint64_t(1) << highestSetBit(stack));
+				}
+				stack |= uint64_t(1) << (i - start);
+				m_stack[i] = stack;
+			}
+			m_table[b] = start + lowestSetBit(stack);
+		}
+	});
+
+	// row k of the sparse table holds the minimum positions of 2^k consecutive blocks
+	for (int k = 1; k < m_rangeJ; ++k) {
+		const int* prev = &m_table[(k - 1) * m_blocks];
+		int* row = &m_table[k * m_blocks];
+		const int half = 1 << (k - 1);
+		internal::parallelFor(m_maxThreads, m_blocks - 2 * half + 1, 4096,
+				[&](int begin, int end, unsigned int) {
+					for (int b = begin; b < end; ++b) {
+						row[b] = minPos(prev[b], prev[b + half]);
+					}
+				});
+	}
+}
+
+int LCALinear::rmq(int i, int j) const {
+	OGDF_ASSERT(0 <= i);
+	OGDF_ASSERT(i <= j);
+	OGDF_ASSERT(j < m_n);
+	const int bi = i >> s_logBlockSize;
+	const int bj = j >> s_logBlockSize;
+	if (bi == bj) {
+		return rmqInBlock(i, j);
+	}
+	int result = minPos(rmqInBlock(i, ((bi + 1) << s_logBlockSize) - 1),
+			rmqInBlock(bj << s_logBlockSize, j));
+	if (bi + 1 < bj) {
+		const int k = highestSetBit(static_cast<uint64_t>(bj - bi - 1));
+		const int* row = &m_table[k * m_blocks];
+		result = minPos(result, minPos(row[bi + 1], row[bj - (1 << k)]));
+	}
+	return result;
+}
+
+}
@@ -0,0 +1,182 @@
+/** \file
+ * \brief Tests for the breadth-first search engine.
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.md in the OGDF root directory for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, see
+ * http://www.gnu.org/copyleft/gpl.html
+ */
+
+#include <ogdf/basic/BreadthFirstSearch.h>
+#include <ogdf/basic/Graph.h>
+#include <ogdf/basic/Queue.h>
+#include <ogdf/basic/basic.h>
+#include <ogdf/basic/graph_generators.h>
+
+#include <string>
+
+#include <testing.h>
+
+//! Runs a queue-based BFS and stores distances, parents and the visiting order.
+static void queueBFS(const Graph& G, node s, bool directed, NodeArray<int>& distance,
+		NodeArray<edge>& parent, List<node>& order) {
+	distance.init(G, -1);
+	parent.init(G, nullptr);
+	order.clear();
+
+	Queue<node> queue;
+	queue.append(s);
+	distance[s] = 0;
+	while (!queue.empty()) {
+		node v = queue.pop();
+		order.pushBack(v);
+		for (adjEntry adj : v->adjEntries) {
+			node w = adj->twinNode();
+			if ((!directed || adj->isSource()) && distance[w] < 0) {
+				distance[w] = distance[v] + 1;
+				parent[w] = adj->theEdge();
+				queue.append(w);
+			}
+		}
+	}
+}
+
+//! Compares the result of \p bfs with a queue-based BFS from \p s.
+static void validate(const Graph& G, node s, bool directed, const BreadthFirstSearch& bfs,
+		bool sameOrder) {
+	NodeArray<int> distance;
+	NodeArray<edge> parent;
+	List<node> order;
+	queueBFS(G, s, directed, distance, parent, order);
+
+	AssertThat(bfs.numberOfReachedNodes(), Equals(order.size()));
+	for (node v : G.nodes) {
+		AssertThat(bfs.distance(v), Equals(distance[v]));
+		AssertThat(bfs.reached(v), Equals(distance[v] >= 0));
+		edge e = bfs.parent(v);
+		if (v == s || distance[v] < 0) {
+			AssertThat(e, IsNull());
+		} else {
+			AssertThat(e, !IsNull());
+			AssertThat(directed ? e->target() == v : e->isIncident(v), IsTrue());
+			AssertThat(bfs.distance(e->opposite(v)), Equals(distance[v] - 1));
+		}
+	}
+
+	for (int level = 0; level < bfs.numberOfLevels(); ++level) {
+		AssertThat(bfs.levelBegin(level), IsLessThan(bfs.levelBegin(level + 1)));
+		for (int i = bfs.levelBegin(level); i < bfs.levelBegin(level + 1); ++i) {
+			AssertThat(bfs.distance(bfs.reachedNode(i)), Equals(level));
+		}
+	}
+	AssertThat(bfs.levelBegin(bfs.numberOfLevels()), Equals(bfs.numberOfReachedNodes()));
+
+	if (sameOrder) {
+		int i = 0;
+		for (node v : order) {
+			AssertThat(bfs.reachedNode(i++), Equals(v));
+			AssertThat(bfs.parent(v), Equals(parent[v]));
+		}
+	}
+}
+
+static void testGraph(const Graph& G, bool directed, bool directionOptimizing,
+		unsigned int threads) {
+	BreadthFirstSearch bfs(G, directed);
+	bfs.directionOptimizing(directionOptimizing);
+	bfs.maxThreads(threads);
+
+	for (int i = 0; i < 3; ++i) {
+		node s = G.chooseNode();
+		bfs.run(s);
+		validate(G, s, directed, bfs, !directionOptimizing && threads == 1);
+	}
+}
+
+go_bandit([] {
+	describe("BreadthFirstSearch", [] {
+		for (bool directed : {false, true}) {
+			for (bool directionOptimizing : {false, true}) {
+				for (unsigned int threads : {1u, 4u}) {
+					std::string title = std::string(directed ? "directed" : "undirected")
+							+ (directionOptimizing ? ", direction-optimizing" : ", top-down")
+							+ ", " + to_string(threads) + " thread(s)";
+
+					it("works on sparse random graphs (" + title + ")", [&] {
+						Graph G;
+						randomGraph(G, 2000, 4000);
+						testGraph(G, directed, directionOptimizing, threads);
+					});
+
+					it("works on dense random graphs (" + title + ")", [&] {
+						Graph G;
+						randomGraph(G, 20000, 200000);
+						testGraph(G, directed, directionOptimizing, threads);
+					});
+
+					it("works on grids (" + title + ")", [&] {
+						Graph G;
+						gridGraph(G, 50, 50, false, false);
+						testGraph(G, directed, directionOptimizing, threads);
+					});
+				}
+			}
+		}
+
+		it("works on graphs with deleted nodes", [] {
+			Graph G;
+			randomGraph(G, 500, 2000);
+			for (int i = 0; i < 100; ++i) {
+				G.delNode(G.chooseNode());
+			}
+			testGraph(G, false, true, 1);
+		});
+
+		it("computes distance and parent arrays", [] {
+			Graph G;
+			node s = G.newNode();
+			node v = G.newNode();
+			node w = G.newNode();
+			node isolated = G.newNode();
+			edge e = G.newEdge(s, v);
+			edge f = G.newEdge(w, v);
+
+			BreadthFirstSearch bfs(G);
+			bfs.run(s);
+			NodeArray<int> distance;
+			NodeArray<edge> parent;
+			bfs.distances(distance);
+			bfs.parents(parent);
+
+			AssertThat(distance[s], Equals(0));
+			AssertThat(distance[v], Equals(1));
+			AssertThat(distance[w], Equals(2));
+			AssertThat(distance[isolated], Equals(-1));
+			AssertThat(parent[s], IsNull());
+			AssertThat(parent[v], Equals(e));
+			AssertThat(parent[w], Equals(f));
+			AssertThat(parent[isolated], IsNull());
+			AssertThat(bfs.numberOfLevels(), Equals(3));
+		});
+	});
+});
@@ -29,15 +29,20 @@
  * http://www.gnu.org/copyleft/gpl.html
  */
 
+#include <ogdf/basic/ConcurrentDisjointSets.h>
 #include <ogdf/basic/DisjointSets.h>
+#include <ogdf/basic/Thread.h>
 #include <ogdf/basic/basic.h>
 
 #include <algorithm>
 #include <exception>
 #include <functional>
 #include <memory>
+#include <random>
 #include <sstream>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include <testing.h>
 
@@ -212,6 +217,64 @@ static void registerTestSuite(const string typeName) {
 	});
 }
 
+template<typename ConcurrentDisjointSetsClass>
+static void registerConcurrencyTests(const string typeName) {
+	describe(typeName + " used by several threads", [&]() {
+		for (int n : {10, 1000, 100000}) {
+			it("agrees with sequential unions of " + to_string(n) + " elements", [n]() {
+				std::minstd_rand rng(n);
+				std::uniform_int_distribution<int> dist(0, n - 1);
+				std::vector<std::pair<int, int>> pairs(n);
+				for (auto& pair : pairs) {
+					pair = {dist(rng), dist(rng)};
+				}
+
+				DisjointSets<> sequential(n);
+				ConcurrentDisjointSetsClass concurrent(n);
+				for (int i = 0; i < n; ++i) {
+					sequential.makeSet();
+					concurrent.makeSet();
+				}
+				int sequentialUnions = 0;
+				for (auto& pair : pairs) {
+					sequentialUnions += sequential.quickUnion(pair.first, pair.second);
+				}
+
+				const int threads = 4;
+				std::vector<int> unions(threads, 0);
+				std::vector<std::function<void()>> jobs;
+				for (int t = 0; t < threads; ++t) {
+					jobs.emplace_back([&, t]() {
+						for (int i = t; i < n; i += threads) {
+							unions[t] += concurrent.quickUnion(pairs[i].first, pairs[i].second);
+						}
+					});
+				}
+				std::vector<Thread> worker;
+				for (auto& job : jobs) {
+					worker.emplace_back(job);
+				}
+				for (Thread& thread : worker) {
+					thread.join();
+				}
+
+				int concurrentUnions = 0;
+				for (int u : unions) {
+					concurrentUnions += u;
+				}
+				AssertThat(concurrentUnions, Equals(sequentialUnions));
+				AssertThat(concurrent.getNumberOfSets(), Equals(sequential.getNumberOfSets()));
+				for (int i = 0; i < n; ++i) {
+					int j = dist(rng);
+					AssertThat(concurrent.sameSet(i, j),
+							Equals(sequential.find(i) == sequential.find(j)));
+					AssertThat(concurrent.find(i), Equals(concurrent.getRepresentative(i)));
+				}
+			});
+		}
+	});
+}
+
 go_bandit([]() {
 	describe("Disjoint Sets", []() {
 		registerTestSuite<DisjointSets<>>("Default");
@@ -231,4 +294,18 @@ go_bandit([]() {
 		registerTestSuite<DisjointSets<LinkOptions::Rank, CompressionOptions::Disabled,
 				InterleavingOptions::Disabled>>("No Linking, No Compression, No Interleaving");
 	});
+
+	describe("Concurrent Disjoint Sets", []() {
+		registerTestSuite<ConcurrentDisjointSets<>>("Default");
+		registerTestSuite<
+				ConcurrentDisjointSets<LinkOptions::Index, CompressionOptions::PathHalving>>(
+				"Linking by Index, Path Halving");
+		registerTestSuite<ConcurrentDisjointSets<LinkOptions::Index, CompressionOptions::Disabled>>(
+				"Linking by Index, No Compression");
+
+		registerConcurrencyTests<ConcurrentDisjointSets<>>("Default");
+		registerConcurrencyTests<
+				ConcurrentDisjointSets<LinkOptions::Index, CompressionOptions::PathHalving>>(
+				"Linking by Index, Path Halving");
+	});
 });
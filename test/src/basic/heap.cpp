@@ -37,6 +37,7 @@
 #include <ogdf/basic/graph_generators.h>
 #include <ogdf/basic/heap/BinaryHeap.h>
 #include <ogdf/basic/heap/BinomialHeap.h>
+#include <ogdf/basic/heap/DaryHeap.h>
 #include <ogdf/basic/heap/FibonacciHeap.h>
 #include <ogdf/basic/heap/HotQueue.h>
 #include <ogdf/basic/heap/PairingHeap.h>
@@ -557,6 +558,13 @@ void radixHeapSortingTest(std::size_t n) {
 				last = str.size();
 			}
 		});
+
+		it("returns the value that is popped next as top", [&]() {
+			while (!heap->empty()) {
+				std::string str = heap->top();
+				AssertThat(heap->pop(), Equals(str));
+			}
+		});
 	});
 }
 
@@ -703,6 +711,7 @@ void describeHeap(const char* title, bool supportsDecrease = true, bool supports
 go_bandit([]() {
 	describe("Heaps", []() {
 		describeHeap<BinaryHeap>("Binary heap", true, false);
+		describeHeap<DaryHeap>("4-ary heap", true, false);
 		describeHeap<PairingHeap>("Pairing heap");
 		describeHeap<BinomialHeap>("Binomial heap", false);
 		describeHeap<FibonacciHeap>("Fibonacci heap");
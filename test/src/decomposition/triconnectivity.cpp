@@ -38,6 +38,7 @@
 #include <ogdf/basic/basic.h>
 #include <ogdf/basic/graph_generators.h>
 #include <ogdf/basic/simple_graph_alg.h>
+#include <ogdf/decomposition/StaticSPQRTree.h>
 #include <ogdf/graphalg/Triconnectivity.h>
 
 #include <algorithm>
@@ -527,6 +528,58 @@ go_bandit([]() {
 					GraphSizes(), 3, MAX_SIZE);
 		});
 
+		describe("for long ladders", []() {
+			// deep enough to overflow the stack with a recursive DFS
+			const int rungs = 100000;
+			Graph G;
+			gridGraph(G, 2, rungs, false, false);
+
+			it("computes components", [&G]() {
+				Triconnectivity T(G);
+				int polygons = 0, bonds = 0;
+				for (int i = 0; i < T.m_numComp; ++i) {
+					const auto& comp = T.m_component[i];
+					if (comp.m_edges.empty()) {
+						continue;
+					}
+					AssertThat(comp.m_type, !Equals(Triconnectivity::CompType::triconnected));
+					if (comp.m_type == Triconnectivity::CompType::polygon) {
+						AssertThat(comp.m_edges.size(), Equals(4));
+						++polygons;
+					} else {
+						AssertThat(comp.m_edges.size(), Equals(3));
+						++bonds;
+					}
+				}
+				AssertThat(polygons, Equals(rungs - 1));
+				AssertThat(bonds, Equals(rungs - 2));
+			});
+
+			it("computes split pairs", [&G]() {
+				bool isTric = true;
+				node s1 = nullptr;
+				node s2 = nullptr;
+				Triconnectivity _(G, isTric, s1, s2);
+				AssertThat(isTric, IsFalse());
+				AssertThat(s1, !IsNull());
+				AssertThat(s2, !IsNull());
+			});
+
+			it("builds and reroots the SPQR-tree", [&G]() {
+				StaticSPQRTree T(G);
+				AssertThat(T.numberOfSNodes(), Equals(rungs - 1));
+				AssertThat(T.numberOfPNodes(), Equals(rungs - 2));
+				AssertThat(T.numberOfRNodes(), Equals(0));
+
+				edge e = G.lastEdge();
+				node root = T.rootTreeAt(e);
+				AssertThat(T.rootEdge(), Equals(e));
+				for (node v : T.tree().nodes) {
+					AssertThat(v->indeg(), Equals(v == root ? 0 : 1));
+				}
+			});
+		});
+
 		// TODO check that random SPQR tree structure matches
 		// TODO check that separation pair occurs in random SPQR tree
 		// TODO fix and reenable parallel edges case
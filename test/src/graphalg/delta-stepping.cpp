@@ -0,0 +1,143 @@
+/** \file
+ * \brief Tests for the delta-stepping shortest path algorithm.
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.md in the OGDF root directory for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, see
+ * http://www.gnu.org/copyleft/gpl.html
+ */
+
+#include <ogdf/basic/Graph.h>
+#include <ogdf/basic/basic.h>
+#include <ogdf/basic/graph_generators.h>
+#include <ogdf/graphalg/Dijkstra.h>
+#include <ogdf/graphalg/ShortestPathDeltaStepping.h>
+
+#include <limits>
+#include <string>
+
+#include <testing.h>
+
+//! Asserts that \p d equals the distances computed by Dijkstra and that \p pi is consistent.
+static void validate(const Graph& G, node s, const EdgeArray<int>& length, bool directed,
+		const NodeArray<int>& d, const NodeArray<edge>& pi) {
+	Dijkstra<int> dijkstra;
+	NodeArray<int> expected;
+	NodeArray<edge> pred;
+	dijkstra.call(G, length, s, pred, expected, directed);
+
+	for (node v : G.nodes) {
+		AssertThat(d[v], Equals(expected[v]));
+		if (v == s || d[v] == std::numeric_limits<int>::max()) {
+			AssertThat(pi[v], IsNull());
+		} else {
+			edge e = pi[v];
+			AssertThat(e, !IsNull());
+			AssertThat(directed ? e->target() == v : e->isIncident(v), IsTrue());
+			AssertThat(d[e->opposite(v)] + length[e], Equals(d[v]));
+		}
+	}
+}
+
+static void testRandomGraphs(bool directed, int delta, unsigned int threads, int maxLength) {
+	ShortestPathDeltaStepping sp;
+	sp.directed(directed);
+	sp.delta(delta);
+	sp.maxThreads(threads);
+
+	for (int i = 0; i < 3; ++i) {
+		Graph G;
+		randomGraph(G, 3000, 12000);
+		EdgeArray<int> length(G);
+		for (edge e : G.edges) {
+			length[e] = randomNumber(0, maxLength);
+		}
+
+		node s = G.chooseNode();
+		NodeArray<int> d;
+		NodeArray<edge> pi;
+		AssertThat(sp.call(G, s, length, d, pi), IsTrue());
+		validate(G, s, length, directed, d, pi);
+	}
+}
+
+go_bandit([] {
+	describe("ShortestPathDeltaStepping", [] {
+		for (unsigned int threads : {1u, 4u}) {
+			std::string suffix = " using " + to_string(threads) + " thread(s)";
+
+			for (bool directed : {true, false}) {
+				std::string kind = directed ? "directed" : "undirected";
+
+				it("computes " + kind + " shortest paths with automatic delta" + suffix,
+						[&] { testRandomGraphs(directed, 0, threads, 100); });
+				it("computes " + kind + " shortest paths with small delta" + suffix,
+						[&] { testRandomGraphs(directed, 3, threads, 100); });
+				it("computes " + kind + " shortest paths with large delta" + suffix,
+						[&] { testRandomGraphs(directed, 1000, threads, 100); });
+				it("computes " + kind + " shortest paths with zero lengths" + suffix,
+						[&] { testRandomGraphs(directed, 0, threads, 1); });
+			}
+
+			it("computes breadth-first search distances" + suffix, [&] {
+				Graph G;
+				gridGraph(G, 60, 60, false, false);
+				EdgeArray<int> unit(G, 1);
+				node s = G.chooseNode();
+
+				ShortestPathDeltaStepping sp;
+				sp.directed(false);
+				sp.maxThreads(threads);
+				NodeArray<int> d;
+				NodeArray<edge> pi;
+				sp.call(G, s, d, pi);
+				validate(G, s, unit, false, d, pi);
+			});
+		}
+
+		it("rejects negative lengths", [] {
+			Graph G;
+			completeGraph(G, 4);
+			EdgeArray<int> length(G, 1);
+			length[G.lastEdge()] = -1;
+
+			ShortestPathDeltaStepping sp;
+			NodeArray<int> d;
+			NodeArray<edge> pi;
+			AssertThat(sp.call(G, G.firstNode(), length, d, pi), IsFalse());
+		});
+
+		it("works on a single node", [] {
+			Graph G;
+			node s = G.newNode();
+			EdgeArray<int> length(G);
+
+			ShortestPathDeltaStepping sp;
+			NodeArray<int> d;
+			NodeArray<edge> pi;
+			AssertThat(sp.call(G, s, length, d, pi), IsTrue());
+			AssertThat(d[s], Equals(0));
+			AssertThat(pi[s], IsNull());
+		});
+	});
+});
@@ -34,6 +34,8 @@
 #include <ogdf/basic/List.h>
 #include <ogdf/basic/basic.h>
 #include <ogdf/basic/graph_generators/deterministic.h>
+#include <ogdf/basic/graph_generators/randomized.h>
+#include <ogdf/basic/heap/DaryHeap.h>
 #include <ogdf/basic/heap/PairingHeap.h>
 #include <ogdf/graphalg/Dijkstra.h>
 
@@ -69,7 +71,7 @@ struct DijkstraTestNode {
 };
 
 //! An instance of a graph Dijkstra can be called on, with expected resulting shortest path tree.
-template<typename T>
+template<typename T, template<typename, typename> class H>
 struct DijkstraTestInstance {
 	//! Constructs a new test instance.
 	//! @note In order to be valid, an instance needs to be supplied with a size using setSize(int).
@@ -199,7 +201,7 @@ protected:
 			weights[G.newEdge(nodes[e.m_from], nodes[e.m_to])] = e.m_weight;
 		}
 
-		Dijkstra<T, PairingHeap> dij;
+		Dijkstra<T, H> dij;
 		NodeArray<edge> predecessor(G);
 		NodeArray<T> distance(G);
 
@@ -230,25 +232,25 @@ protected:
 	Array<DijkstraTestNode<T>> m_terminationDistance_nodes;
 };
 
-template<typename T>
-void forAllInstances(std::function<void(const DijkstraTestInstance<T>&)> doTest) {
+template<typename T, template<typename, typename> class H>
+void forAllInstances(std::function<void(const DijkstraTestInstance<T, H>&)> doTest) {
 	auto testInstance = [&](const string& desc,
-								std::function<void(DijkstraTestInstance<T>&)> populateInstance) {
+								std::function<void(DijkstraTestInstance<T, H>&)> populateInstance) {
 		it("works on a " + desc, [&] {
-			DijkstraTestInstance<T> instance;
+			DijkstraTestInstance<T, H> instance;
 			populateInstance(instance);
 			doTest(instance);
 		});
 	};
 
-	testInstance("three node graph", [](DijkstraTestInstance<T>& instance) {
+	testInstance("three node graph", [](DijkstraTestInstance<T, H>& instance) {
 		instance.setSize(3)
 				.edges({{0, 1, 5}, {0, 2, 10}, {1, 2, 4}})
 				.expectedPredecessorRelation({{0, -1, 0}, {1, 0, 5}, {2, 1, 9}})
 				.terminationTarget(1, {{0, -1, 0}, {1, 0, 5}, {2, 0, 10}});
 	});
 
-	testInstance("K5 with uniform weights", [](DijkstraTestInstance<T>& instance) {
+	testInstance("K5 with uniform weights", [](DijkstraTestInstance<T, H>& instance) {
 		instance.setSize(5)
 				.edges({{0, 1, 1}, {0, 2, 1}, {0, 3, 1}, {0, 4, 1}, {1, 2, 1}, {1, 3, 1}, {1, 4, 1},
 						{2, 3, 1}, {2, 4, 1}, {3, 4, 1}})
@@ -256,7 +258,7 @@ void forAllInstances(std::function<void(const DijkstraTestInstance<T>&)> doTest)
 				.terminationTarget(2, {{0, -1, 0}, {1, 0, 1}, {2, 0, 1}, {3, 0, 1}, {4, 0, 1}});
 	});
 
-	testInstance("disconnected graph", [](DijkstraTestInstance<T>& instance) {
+	testInstance("disconnected graph", [](DijkstraTestInstance<T, H>& instance) {
 		instance.setSize(5)
 				.edges({{0, 1, 5}, {0, 2, 3}, {1, 2, 1}, {3, 4, 2}})
 				.expectedPredecessorRelation(
@@ -268,21 +270,21 @@ void forAllInstances(std::function<void(const DijkstraTestInstance<T>&)> doTest)
 								{4, -1, std::numeric_limits<T>::max()}});
 	});
 
-	testInstance("graph without edges", [](DijkstraTestInstance<T>& instance) {
+	testInstance("graph without edges", [](DijkstraTestInstance<T, H>& instance) {
 		instance.setSize(7).edges({}).expectedPredecessorRelation({{0, -1, 0},
 				{1, -1, std::numeric_limits<T>::max()}, {2, -1, std::numeric_limits<T>::max()},
 				{3, -1, std::numeric_limits<T>::max()}, {4, -1, std::numeric_limits<T>::max()},
 				{5, -1, std::numeric_limits<T>::max()}, {6, -1, std::numeric_limits<T>::max()}});
 	});
 
-	testInstance("graph with similar path lengths", [](DijkstraTestInstance<T>& instance) {
+	testInstance("graph with similar path lengths", [](DijkstraTestInstance<T, H>& instance) {
 		instance.setSize(4)
 				.edges({{0, 1, 20}, {0, 2, 20}, {1, 3, 30}, {2, 3, 29}})
 				.expectedPredecessorRelation({{0, -1, 0}, {1, 0, 20}, {2, 0, 20}, {3, 2, 49}});
 	});
 
 	testInstance("graph with similar path lengths on two symmetric sides",
-			[](DijkstraTestInstance<T>& instance) {
+			[](DijkstraTestInstance<T, H>& instance) {
 				instance.setSize(8)
 						.edges({{0, 1, 1}, {1, 2, 2}, {1, 3, 5}, {1, 4, 10}, {2, 3, 2}, {3, 4, 5},
 								{0, 5, 1}, {5, 6, 2}, {5, 7, 5}, {5, 4, 10}, {6, 7, 2}, {7, 4, 4}})
@@ -297,7 +299,7 @@ void forAllInstances(std::function<void(const DijkstraTestInstance<T>&)> doTest)
 										{6, 5, 3}, {7, 6, 5}});
 			});
 
-	testInstance("directed graph", [](DijkstraTestInstance<T>& instance) {
+	testInstance("directed graph", [](DijkstraTestInstance<T, H>& instance) {
 		instance.setSize(5)
 				.setDirected()
 				.edges({{0, 1, 4}, {0, 2, 2}, {1, 2, 1}, {2, 3, 5}, {3, 4, 1}, {4, 0, 1}})
@@ -312,11 +314,11 @@ void forAllInstances(std::function<void(const DijkstraTestInstance<T>&)> doTest)
 	});
 }
 
-template<typename T>
+template<typename T, template<typename, typename> class H>
 void compareDijkstraAlgorithms(const Graph& G, bool testMultipleSource) {
 	EdgeArray<T> weights(G, 1);
 
-	Dijkstra<T, PairingHeap> dij;
+	Dijkstra<T, H> dij;
 	NodeArray<edge> predecessorBasic(G);
 	NodeArray<edge> predecessorEarlyTerminated(G);
 	NodeArray<edge> predecessorNotEarlyTerminated(G);
@@ -362,24 +364,25 @@ void compareDijkstraAlgorithms(const Graph& G, bool testMultipleSource) {
 	AssertThat(distanceBasic, EqualsContainer(distanceNotEarlyTerminated));
 }
 
-template<typename T>
+template<typename T, template<typename, typename> class H>
 void performTestsSingleSource() {
 	describe("Finding a shortest path tree on simple instances", [] {
-		forAllInstances<T>([](const DijkstraTestInstance<T>& instance) { instance.testBasic(); });
+		forAllInstances<T, H>(
+				[](const DijkstraTestInstance<T, H>& instance) { instance.testBasic(); });
 	});
 	describe("Finding the same shortest path tree with early termination parameters set to last node",
 			[] {
-				forAllInstances<T>([](const DijkstraTestInstance<T>& instance) {
+				forAllInstances<T, H>([](const DijkstraTestInstance<T, H>& instance) {
 					instance.testEarlyTerminationSafe();
 				});
 			});
 	describe("Terminating early on a given target node", [] {
-		forAllInstances<T>([](const DijkstraTestInstance<T>& instance) {
+		forAllInstances<T, H>([](const DijkstraTestInstance<T, H>& instance) {
 			instance.testEarlyTerminationTarget();
 		});
 	});
 	describe("Terminating early on a given maximal distance", [] {
-		forAllInstances<T>([](const DijkstraTestInstance<T>& instance) {
+		forAllInstances<T, H>([](const DijkstraTestInstance<T, H>& instance) {
 			instance.testEarlyTerminationDistance();
 		});
 	});
@@ -388,26 +391,76 @@ void performTestsSingleSource() {
 			if (G.numberOfNodes() == 0) {
 				return;
 			}
-			compareDijkstraAlgorithms<T>(G, false);
+			compareDijkstraAlgorithms<T, H>(G, false);
 		});
 	});
 }
 
-template<typename T>
+template<typename T, template<typename, typename> class H>
 void performTestsMultipleSource() {
 	describe("Finding the same shortest paths using different setups", [] {
 		forEachGraphItWorks({}, [&](const Graph& G) {
 			if (G.numberOfNodes() < 3) {
 				return;
 			}
-			compareDijkstraAlgorithms<T>(G, true);
+			compareDijkstraAlgorithms<T, H>(G, true);
 		});
 	});
 }
 
+//! Checks that Dijkstra<int, DaryHeap>, which uses a RadixHeap, breaks ties like the DaryHeap
+//! used for floating point weights, on graphs with many shortest paths of equal length.
+void testSamePredecessorsWithTies(int minWeight) {
+	for (int i = 0; i < 20; i++) {
+		setSeed(i);
+		Graph G;
+		randomGraph(G, 100, 400);
+		EdgeArray<int> weight(G);
+		EdgeArray<double> doubleWeight(G);
+		for (edge e : G.edges) {
+			weight[e] = randomNumber(minWeight, minWeight + 1);
+			doubleWeight[e] = weight[e];
+		}
+		List<node> sources {G.firstNode(), G.lastNode()};
+
+		for (bool directed : {false, true}) {
+			NodeArray<edge> pred, radixPred, daryPred;
+			NodeArray<int> dist, radixDist;
+			NodeArray<double> daryDist;
+			Dijkstra<int>().call(G, weight, sources, pred, dist, directed);
+			Dijkstra<int, DaryHeap>().call(G, weight, sources, radixPred, radixDist, directed);
+			Dijkstra<double, DaryHeap>().call(G, doubleWeight, sources, daryPred, daryDist,
+					directed);
+			for (node v : G.nodes) {
+				AssertThat(radixDist[v], Equals(dist[v]));
+				AssertThat(radixPred[v], Equals(daryPred[v]));
+			}
+		}
+	}
+}
+
 go_bandit([] {
-	describe("Dijkstra<int> single source", [] { performTestsSingleSource<int>(); });
-	describe("Dijkstra<double> single source", [] { performTestsSingleSource<double>(); });
-	describe("Dijkstra<int> multiple sources", [] { performTestsMultipleSource<int>(); });
-	describe("Dijkstra<double> multiple sources", [] { performTestsMultipleSource<double>(); });
+	describe("Dijkstra<int> single source", [] { performTestsSingleSource<int, PairingHeap>(); });
+	describe("Dijkstra<double> single source",
+			[] { performTestsSingleSource<double, PairingHeap>(); });
+	describe("Dijkstra<int> multiple sources",
+			[] { performTestsMultipleSource<int, PairingHeap>(); });
+	describe("Dijkstra<double> multiple sources",
+			[] { performTestsMultipleSource<double, PairingHeap>(); });
+
+	// DaryHeap selects the flat-array implementation
+	describe("Dijkstra<int, DaryHeap> single source",
+			[] { performTestsSingleSource<int, DaryHeap>(); });
+	describe("Dijkstra<double, DaryHeap> single source",
+			[] { performTestsSingleSource<double, DaryHeap>(); });
+	describe("Dijkstra<int, DaryHeap> multiple sources",
+			[] { performTestsMultipleSource<int, DaryHeap>(); });
+	describe("Dijkstra<double, DaryHeap> multiple sources",
+			[] { performTestsMultipleSource<double, DaryHeap>(); });
+	describe("Dijkstra<int, DaryHeap> with many ties", [] {
+		it("finds the same predecessors as Dijkstra<double, DaryHeap> for positive weights",
+				[] { testSamePredecessorsWithTies(1); });
+		it("finds the same predecessors as Dijkstra<double, DaryHeap> for zero weights",
+				[] { testSamePredecessorsWithTies(0); });
+	});
 });
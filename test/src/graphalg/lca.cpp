@@ -35,33 +35,37 @@
 #include <ogdf/basic/List.h>
 #include <ogdf/basic/graph_generators.h>
 #include <ogdf/tree/LCA.h>
+#include <ogdf/tree/LCALinear.h>
 
 #include <functional>
+#include <random>
 #include <set>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include <graphs.h>
 
 #include <testing.h>
 
+template<typename LCAType>
 static void trivial() {
 	it("constructs LCA data structure on an empty graph", [] {
 		Graph G;
-		LCA lca(G);
+		LCAType lca(G);
 	});
 
 	it("answers level query on an arborescence with one node", [] {
 		Graph G;
 		node root = G.newNode();
-		LCA lca(G);
+		LCAType lca(G);
 		AssertThat(lca.level(root), Equals(0));
 	});
 
 	it("answers LCA query on an arborescence with one node", [] {
 		Graph G;
 		node root = G.newNode();
-		LCA lca(G);
+		LCAType lca(G);
 		node commonAncestor = lca.call(root, root);
 		AssertThat(commonAncestor, Equals(root));
 	});
@@ -69,7 +73,7 @@ static void trivial() {
 	it("answers LCA queries on an arborescence with two nodes", [] {
 		Graph G;
 		customGraph(G, 2, {{0, 1}});
-		LCA lca(G);
+		LCAType lca(G);
 		AssertThat(lca.call(G.firstNode(), G.firstNode()), Equals(G.firstNode()));
 		AssertThat(lca.call(G.lastNode(), G.firstNode()), Equals(G.firstNode()));
 		AssertThat(lca.call(G.firstNode(), G.lastNode()), Equals(G.firstNode()));
@@ -80,7 +84,7 @@ static void trivial() {
 		Graph G;
 		Array<node> nodes;
 		customGraph(G, 3, {{0, 1}, {0, 2}}, nodes);
-		LCA lca(G);
+		LCAType lca(G);
 		AssertThat(lca.call(nodes[0], nodes[0]), Equals(nodes[0]));
 		AssertThat(lca.call(nodes[0], nodes[1]), Equals(nodes[0]));
 		AssertThat(lca.call(nodes[0], nodes[2]), Equals(nodes[0]));
@@ -93,6 +97,7 @@ static void trivial() {
 	});
 }
 
+template<typename LCAType>
 static void interesting() {
 	const List<std::pair<int, int>> arborescence({{4, 0}, {5, 1}, {5, 2}, {5, 3}, {5, 4}, {7, 6},
 			{7, 5}, {13, 9}, {13, 11}, {13, 12}, {11, 10}, {9, 8}, {9, 7}});
@@ -101,7 +106,7 @@ static void interesting() {
 	customGraph(G, 14, arborescence, nodes);
 
 	it("answers level queries on a more interesting arborescence", [&] {
-		LCA lca(G);
+		LCAType lca(G);
 		AssertThat(lca.level(nodes[0]), Equals(5));
 		AssertThat(lca.level(nodes[1]), Equals(4));
 		AssertThat(lca.level(nodes[5]), Equals(3));
@@ -112,7 +117,7 @@ static void interesting() {
 	});
 
 	it("answers LCA queries on a more interesting arborescence", [&] {
-		LCA lca(G);
+		LCAType lca(G);
 		AssertThat(lca.call(nodes[0], nodes[0]), Equals(nodes[0]));
 		AssertThat(lca.call(nodes[0], nodes[1]), Equals(nodes[5]));
 		AssertThat(lca.call(nodes[0], nodes[4]), Equals(nodes[4]));
@@ -124,7 +129,7 @@ static void interesting() {
 	});
 
 	it("answers LCA queries when initialization is on sub-arborescence", [&] {
-		LCA lca(G, nodes[5]);
+		LCAType lca(G, nodes[5]);
 		AssertThat(lca.call(nodes[0], nodes[0]), Equals(nodes[0]));
 		AssertThat(lca.call(nodes[0], nodes[1]), Equals(nodes[5]));
 		AssertThat(lca.call(nodes[0], nodes[4]), Equals(nodes[4]));
@@ -134,26 +139,97 @@ static void interesting() {
 	});
 }
 
-go_bandit([] {
-	describe("Lowest Common Ancestor algorithm", [] {
-		describe("on trivial arborescences", [] { trivial(); });
-
-		describe("on more interesting arborescence", [] { interesting(); });
-
-		describe("on arborescences of varying sizes", [] {
-			forEachGraphItWorks(
-					{GraphProperty::arborescenceForest, GraphProperty::connected},
-					[&](const Graph& G) {
-						LCA lca(G);
-						for (node v : G.nodes) {
-							for (node w : G.nodes) {
-								int lcaLevel = lca.level(lca.call(v, w));
-								AssertThat(lcaLevel, IsLessThanOrEqualTo(lca.level(v)));
-								AssertThat(lcaLevel, IsLessThanOrEqualTo(lca.level(w)));
-							}
+template<typename LCAType>
+static void describeLCA() {
+	describe("on trivial arborescences", [] { trivial<LCAType>(); });
+
+	describe("on more interesting arborescence", [] { interesting<LCAType>(); });
+
+	describe("on arborescences of varying sizes", [] {
+		forEachGraphItWorks(
+				{GraphProperty::arborescenceForest, GraphProperty::connected},
+				[&](const Graph& G) {
+					LCAType lca(G);
+					for (node v : G.nodes) {
+						for (node w : G.nodes) {
+							int lcaLevel = lca.level(lca.call(v, w));
+							AssertThat(lcaLevel, IsLessThanOrEqualTo(lca.level(v)));
+							AssertThat(lcaLevel, IsLessThanOrEqualTo(lca.level(w)));
 						}
-					},
-					GraphSizes(10, 1000, 10));
+					}
+				},
+				GraphSizes(10, 1000, 10));
+	});
+}
+
+//! Creates a random arborescence with \p n nodes whose depth is about \p n / \p width.
+static void randomArborescence(Graph& G, int n, int width, std::minstd_rand& rng) {
+	Array<node> nodes(n);
+	for (int i = 0; i < n; ++i) {
+		nodes[i] = G.newNode();
+		if (i > 0) {
+			std::uniform_int_distribution<int> dist(max(0, i - width), i - 1);
+			G.newEdge(nodes[dist(rng)], nodes[i]);
+		}
+	}
+}
+
+static void describeLCALinear() {
+	for (int width : {1, 3, 1000}) {
+		it("agrees with LCA on a random arborescence of width " + std::to_string(width), [&] {
+			std::minstd_rand rng(width);
+			Graph G;
+			randomArborescence(G, 5000, width, rng);
+			LCA lca(G);
+			LCALinear lcaLinear(G, nullptr, 4);
+			std::uniform_int_distribution<int> dist(0, G.numberOfNodes() - 1);
+			Array<node> nodes;
+			G.allNodes(nodes);
+			for (node v : G.nodes) {
+				AssertThat(lcaLinear.level(v), Equals(lca.level(v)));
+			}
+			for (int k = 0; k < 20000; ++k) {
+				node u = nodes[dist(rng)];
+				node v = nodes[dist(rng)];
+				AssertThat(lcaLinear.call(u, v), Equals(lca.call(u, v)));
+			}
 		});
+	}
+
+	for (unsigned int threads : {1, 4}) {
+		it("answers batch queries using " + std::to_string(threads) + " thread(s)", [&] {
+			std::minstd_rand rng(threads);
+			Graph G;
+			randomArborescence(G, 20000, 10, rng);
+			Array<node> nodes;
+			G.allNodes(nodes);
+			std::uniform_int_distribution<int> dist(0, G.numberOfNodes() - 1);
+			std::vector<std::pair<node, node>> queries;
+			for (int k = 0; k < 50000; ++k) {
+				queries.emplace_back(nodes[dist(rng)], nodes[dist(rng)]);
+			}
+			queries.emplace_back(nodes[7], nodes[7]);
+
+			LCA lca(G);
+			LCALinear lcaLinear(G, nullptr, threads);
+			std::vector<node> result;
+			lcaLinear.call(queries, result);
+			AssertThat(result.size(), Equals(queries.size()));
+			for (size_t k = 0; k < queries.size(); ++k) {
+				AssertThat(result[k], Equals(lca.call(queries[k].first, queries[k].second)));
+			}
+
+			lcaLinear.call(std::vector<std::pair<node, node>>(), result);
+			AssertThat(result.empty(), IsTrue());
+		});
+	}
+}
+
+go_bandit([] {
+	describe("Lowest Common Ancestor algorithm", [] { describeLCA<LCA>(); });
+
+	describe("Linear-space Lowest Common Ancestor algorithm", [] {
+		describeLCA<LCALinear>();
+		describeLCALinear();
 	});
 });
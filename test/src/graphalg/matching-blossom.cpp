@@ -29,15 +29,18 @@
  * http://www.gnu.org/copyleft/gpl.html
  */
 
+#include <ogdf/basic/Array.h>
 #include <ogdf/basic/Graph.h>
 #include <ogdf/basic/GraphList.h>
 #include <ogdf/basic/List.h>
+#include <ogdf/basic/basic.h>
 #include <ogdf/basic/graph_generators.h>
 #include <ogdf/graphalg/Matching.h>
 #include <ogdf/graphalg/MatchingBlossom.h>
 #include <ogdf/graphalg/MatchingBlossomV.h>
 
 #include <algorithm>
+#include <cmath>
 #include <functional>
 #include <string>
 #include <tuple>
@@ -387,7 +390,104 @@ void runAllTests() {
 	});
 }
 
+//! Creates a complete graph on \p n random points in the unit square weighted by distance.
+void createGeometricGraph(Graph& graph, EdgeArray<double>& weights, int n) {
+	completeGraph(graph, n);
+	NodeArray<double> x(graph), y(graph);
+	for (node v : graph.nodes) {
+		x[v] = randomDouble(0, 1);
+		y[v] = randomDouble(0, 1);
+	}
+	weights.init(graph);
+	for (edge e : graph.edges) {
+		node u = e->source();
+		node v = e->target();
+		weights[e] = std::hypot(x[u] - x[v], y[u] - y[v]);
+	}
+}
+
+void testBlossomVThreads() {
+	for (bool greedyInit : {true, false}) {
+		it("finds the same matching weight with multiple threads on a dense geometric graph"
+				+ std::string(greedyInit ? "" : " without greedy initialization"),
+				[&] {
+					Graph graph;
+					EdgeArray<double> weights;
+					createGeometricGraph(graph, weights, 400);
+
+					MatchingBlossomV<double> single(greedyInit);
+					single.maxThreads(1);
+					std::unordered_set<edge> matchingSingle;
+					AssertThat(single.minimumWeightPerfectMatching(graph, weights, matchingSingle),
+							IsTrue());
+					AssertThat(isPerfectMatching(graph, matchingSingle), IsTrue());
+
+					MatchingBlossomV<double> multi(greedyInit);
+					multi.maxThreads(4);
+					std::unordered_set<edge> matchingMulti;
+					AssertThat(multi.minimumWeightPerfectMatching(graph, weights, matchingMulti),
+							IsTrue());
+					AssertThat(isPerfectMatching(graph, matchingMulti), IsTrue());
+
+					AssertThat(multi.matchingWeight(matchingMulti, weights),
+							EqualsWithDelta(single.matchingWeight(matchingSingle, weights), DELTA));
+				});
+	}
+}
+
+void testBlossomVParallelDualChange() {
+	it("splits the dual changes of a large aux graph between threads", [] {
+		// without greedy initialization, every node starts as a tree of its own, so the aux
+		// graph has more than the 65536 items that MatchingBlossomV hands to a single thread
+		setSeed(7);
+		const int n = 16000;
+		Graph graph;
+		NodeArray<double> x(graph), y(graph);
+		Array<node> nodes(n);
+		for (int i = 0; i < n; ++i) {
+			nodes[i] = graph.newNode();
+			x[nodes[i]] = randomDouble(0, 1);
+			y[nodes[i]] = randomDouble(0, 1);
+		}
+		for (int i = 0; i < n; i += 2) {
+			graph.newEdge(nodes[i], nodes[i + 1]);
+		}
+		for (int i = 0; i < 4 * n; ++i) {
+			node u = nodes[randomNumber(0, n - 1)];
+			node v = nodes[randomNumber(0, n - 1)];
+			if (u != v) {
+				graph.newEdge(u, v);
+			}
+		}
+		EdgeArray<double> weights(graph);
+		for (edge e : graph.edges) {
+			node u = e->source();
+			node v = e->target();
+			weights[e] = std::hypot(x[u] - x[v], y[u] - y[v]);
+		}
+
+		MatchingBlossomV<double> single(false);
+		single.maxThreads(1);
+		std::unordered_set<edge> matchingSingle;
+		AssertThat(single.minimumWeightPerfectMatching(graph, weights, matchingSingle), IsTrue());
+		AssertThat(isPerfectMatching(graph, matchingSingle), IsTrue());
+
+		MatchingBlossomV<double> multi(false);
+		multi.maxThreads(4);
+		std::unordered_set<edge> matchingMulti;
+		AssertThat(multi.minimumWeightPerfectMatching(graph, weights, matchingMulti), IsTrue());
+		AssertThat(isPerfectMatching(graph, matchingMulti), IsTrue());
+
+		AssertThat(multi.matchingWeight(matchingMulti, weights),
+				EqualsWithDelta(single.matchingWeight(matchingSingle, weights), DELTA));
+	});
+}
+
 go_bandit([] {
 	describe("Blossom I", [&] { runAllTests<MatchingBlossom>(); });
-	describe("Blossom V", [&] { runAllTests<MatchingBlossomV>(); });
+	describe("Blossom V", [&] {
+		runAllTests<MatchingBlossomV>();
+		testBlossomVThreads();
+		testBlossomVParallelDualChange();
+	});
 });
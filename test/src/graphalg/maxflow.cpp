@@ -42,6 +42,7 @@
 #include <ogdf/graphalg/ConnectivityTester.h>
 #include <ogdf/graphalg/MaxFlowEdmondsKarp.h>
 #include <ogdf/graphalg/MaxFlowGoldbergTarjan.h> // IWYU pragma: keep
+#include <ogdf/graphalg/MaxFlowPushRelabel.h> // IWYU pragma: keep
 #include <ogdf/graphalg/MaxFlowSTPlanarDigraph.h> // IWYU pragma: keep
 #include <ogdf/graphalg/MaxFlowSTPlanarItaiShiloach.h> // IWYU pragma: keep
 
@@ -351,6 +352,7 @@ void registerTestSuite(const string typeName) {
 			MFR_CONNECTED | MFR_ST_PLANAR);
 	describeMaxFlowModule<MaxFlowEdmondsKarp<T>, T>("MaxFlowEdmondsKarp" + suffix);
 	describeMaxFlowModule<MaxFlowGoldbergTarjan<T>, T>("MaxFlowGoldbergTarjan" + suffix);
+	describeMaxFlowModule<MaxFlowPushRelabel<T>, T>("MaxFlowPushRelabel" + suffix);
 }
 
 /**
@@ -456,6 +458,27 @@ go_bandit([]() {
 		registerTestSuite<int>("int");
 		registerTestSuite<double>("double");
 		registerTestSuite<unsigned long long int>("unsigned long long int");
+
+		it("computes large flows with MaxFlowPushRelabel using 4 threads", [] {
+			Graph graph;
+			randomGraph(graph, 30000, 150000);
+			EdgeArray<int> caps(graph);
+			for (edge e : graph.edges) {
+				caps[e] = randomNumber(1, 100);
+			}
+			node s = graph.chooseNode();
+			node t = graph.chooseNode([&](node v) { return v != s; });
+
+			MaxFlowPushRelabel<int> alg(graph);
+			alg.maxThreads(4);
+			EdgeArray<int> flow(graph);
+			int value = alg.computeValue(caps, s, t);
+			alg.computeFlowAfterValue(flow);
+
+			MaxFlowGoldbergTarjan<int> reference(graph);
+			AssertThat(value, Equals(reference.computeValue(caps, s, t)));
+			validateFlow(graph, caps, s, t, flow, value);
+		});
 	});
 
 	describe("Connectivity Tester", []() {
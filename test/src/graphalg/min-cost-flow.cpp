@@ -30,6 +30,7 @@
  */
 
 #include <ogdf/basic/Graph.h>
+#include <ogdf/graphalg/MinCostFlowCostScaling.h>
 #include <ogdf/graphalg/MinCostFlowModule.h>
 #include <ogdf/graphalg/MinCostFlowReinelt.h>
 
@@ -125,6 +126,98 @@ void testModule(const char* name, MinCostFlowModule<TCost>* alg, TCost base) {
 	delete alg;
 }
 
+//! Checks that \p dual certifies the optimality of \p flow.
+static void assertOptimalDual(const Graph& G, const EdgeArray<int>& lb, const EdgeArray<int>& ub,
+		const EdgeArray<int>& cost, const EdgeArray<int>& flow, const NodeArray<int>& dual) {
+	for (edge e : G.edges) {
+		if (e->isSelfLoop()) {
+			continue;
+		}
+		int reducedCost = cost[e] - dual[e->source()] + dual[e->target()];
+		if (flow[e] < ub[e]) {
+			AssertThat(reducedCost, IsGreaterThanOrEqualTo(0));
+		}
+		if (flow[e] > lb[e]) {
+			AssertThat(reducedCost, IsLessThanOrEqualTo(0));
+		}
+	}
+}
+
+static void describeCostScaling() {
+	describe("MinCostFlowCostScaling on random instances", []() {
+		for (int n : {10, 100, 1000}) {
+			std::string title = "computes the same cost as MinCostFlowReinelt with " + to_string(n)
+					+ " nodes";
+			it(title, [n]() {
+				for (int i = 0; i < 5; ++i) {
+					Graph G;
+					EdgeArray<int> lb(G), ub(G), cost(G);
+					NodeArray<int> supply(G);
+					MinCostFlowModule<int>::generateProblem(G, n, 4 * n, lb, ub, cost, supply);
+					for (edge e : G.edges) {
+						cost[e] -= 30;
+					}
+
+					EdgeArray<int> flowReinelt(G), flow(G);
+					NodeArray<int> dual(G);
+					MinCostFlowReinelt<int> reinelt;
+					MinCostFlowCostScaling<int> scaling;
+					bool feasible = reinelt.call(G, lb, ub, cost, supply, flowReinelt);
+					AssertThat(scaling.call(G, lb, ub, cost, supply, flow, dual), Equals(feasible));
+					if (!feasible) {
+						continue;
+					}
+
+					int value, valueReinelt;
+					AssertThat(MinCostFlowModule<int>::checkComputedFlow(G, lb, ub, cost, supply,
+									   flow, value),
+							IsTrue());
+					MinCostFlowModule<int>::checkComputedFlow(G, lb, ub, cost, supply, flowReinelt,
+							valueReinelt);
+					AssertThat(value, Equals(valueReinelt));
+					assertOptimalDual(G, lb, ub, cost, flow, dual);
+				}
+			});
+		}
+
+		it("reoptimizes from a warm start", []() {
+			Graph G;
+			EdgeArray<int> lb(G), ub(G), cost(G);
+			NodeArray<int> supply(G);
+			MinCostFlowModule<int>::generateProblem(G, 500, 2000, lb, ub, cost, supply);
+
+			MinCostFlowCostScaling<int> scaling;
+			scaling.warmStart(true);
+			EdgeArray<int> flow;
+			NodeArray<int> dual;
+			AssertThat(scaling.call(G, lb, ub, cost, supply, flow, dual), IsTrue());
+
+			for (int round = 0; round < 5; ++round) {
+				for (int i = 0; i < 20; ++i) {
+					edge e = G.chooseEdge();
+					cost[e] = randomNumber(0, 100);
+					ub[e] = max(lb[e], ub[e] + randomNumber(-2, 2));
+				}
+
+				EdgeArray<int> flowReinelt(G);
+				MinCostFlowReinelt<int> reinelt;
+				bool feasible = reinelt.call(G, lb, ub, cost, supply, flowReinelt);
+				AssertThat(scaling.call(G, lb, ub, cost, supply, flow, dual), Equals(feasible));
+				if (feasible) {
+					int value, valueReinelt;
+					AssertThat(MinCostFlowModule<int>::checkComputedFlow(G, lb, ub, cost, supply,
+									   flow, value),
+							IsTrue());
+					MinCostFlowModule<int>::checkComputedFlow(G, lb, ub, cost, supply,
+							flowReinelt, valueReinelt);
+					AssertThat(value, Equals(valueReinelt));
+					assertOptimalDual(G, lb, ub, cost, flow, dual);
+				}
+			}
+		});
+	});
+}
+
 go_bandit([]() {
 	describe("Min-Cost Flow algorithms", []() {
 		testModule<int>("MinCostFlowReinelt with integral cost", new MinCostFlowReinelt<int>(), 1);
@@ -132,5 +225,7 @@ go_bandit([]() {
 				new MinCostFlowReinelt<double>(), 1.92);
 		testModule<double>("MinCostFlowReinelt wit real (double) cost [2]",
 				new MinCostFlowReinelt<double>(), 0.1432);
+		testModule<int>("MinCostFlowCostScaling", new MinCostFlowCostScaling<int>(), 1);
+		describeCostScaling();
 	});
 });
@@ -36,6 +36,7 @@
 #include <ogdf/basic/graph_generators.h>
 #include <ogdf/graphalg/MaxFlowEdmondsKarp.h>
 #include <ogdf/graphalg/MaxFlowGoldbergTarjan.h>
+#include <ogdf/graphalg/MaxFlowPushRelabel.h>
 #include <ogdf/graphalg/MinSTCutBFS.h>
 #include <ogdf/graphalg/MinSTCutDijkstra.h>
 #include <ogdf/graphalg/MinSTCutMaxFlow.h>
@@ -275,6 +276,8 @@ go_bandit([]() {
 	describe("MinSTCut from a graph", []() {
 		MinSTCutMaxFlow<int> mFint(true, new MaxFlowGoldbergTarjan<int>());
 		describeMSTCutSuite<int>(mFint, "MaxFlow(GoldbergTarjan)", "int", true);
+		MinSTCutMaxFlow<int> mPRint(true, new MaxFlowPushRelabel<int>());
+		describeMSTCutSuite<int>(mPRint, "MaxFlow(PushRelabel)", "int", true);
 		MinSTCutMaxFlow<double> mFdouble;
 		describeMSTCutSuite<double>(mFdouble, "MaxFlow(EdmondsKarp)", "double", true);
 		MinSTCutDijkstra<int> mDint;
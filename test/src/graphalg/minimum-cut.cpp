@@ -36,6 +36,7 @@
 #include <ogdf/basic/basic.h>
 #include <ogdf/basic/graph_generators.h>
 #include <ogdf/graphalg/MinimumCutNagamochiIbaraki.h>
+#include <ogdf/graphalg/MinimumCutParallel.h>
 #include <ogdf/graphalg/MinimumCutStoerWagner.h>
 
 #include <functional>
@@ -179,6 +180,64 @@ static void minCutTests(std::string&& type, MinimumCutModule<T>& minCut,
 	});
 }
 
+template<typename T>
+static void compareWithStoerWagner(MinimumCutParallel<T>& minCut) {
+	for (int n : {10, 50, 200}) {
+		it("computes the same value as StoerWagner on random graphs with " + to_string(n)
+						+ " nodes",
+				[&, n] {
+					for (int i = 0; i < 5; ++i) {
+						Graph graph;
+						randomSimpleConnectedGraph(graph, n, 3 * n);
+						EdgeArray<T> weights {graph};
+						for (T& w : weights) {
+							w = randomNumber(1, 10);
+						}
+
+						MinimumCutStoerWagner<T> reference;
+						T expected {reference.call(graph, weights)};
+						AssertThat(minCut.call(graph, weights), Equals(expected));
+
+						T cut {};
+						for (edge e : minCut.edges()) {
+							cut += weights[e];
+						}
+						AssertThat(cut, Equals(expected));
+						AssertThat(minCut.nodes().size(), IsGreaterThan(0));
+						AssertThat(minCut.nodes().size(), IsLessThan(n));
+					}
+				});
+	}
+
+	it("computes the value of two dense clusters joined by few edges", [&] {
+		Graph graph;
+		completeGraph(graph, 100);
+		// remove all edges between the first and the second half except for three
+		int removed = 0;
+		safeForEach(graph.edges, [&](edge e) {
+			bool firstHalf = e->source()->index() < 50;
+			if (firstHalf != (e->target()->index() < 50) && ++removed > 3) {
+				graph.delEdge(e);
+			}
+		});
+		EdgeArray<T> weights {graph, 2};
+		AssertThat(minCut.call(graph, weights), Equals(T(6)));
+		AssertThat(minCut.edges().size(), Equals(3));
+		AssertThat(minCut.nodes().size(), Equals(50));
+	});
+
+	it("reports the time of each phase", [&] {
+		Graph graph;
+		randomSimpleConnectedGraph(graph, 100, 400);
+		minCut.call(graph);
+		using Phase = typename MinimumCutParallel<T>::Phase;
+		for (Phase phase : {Phase::labelPropagation, Phase::padbergRinaldi, Phase::capforest,
+					 Phase::contraction}) {
+			AssertThat(minCut.seconds(phase), IsGreaterThanOrEqualTo(0.0));
+		}
+	});
+}
+
 go_bandit([] {
 	describe("StoerWagner", [] {
 		MinimumCutStoerWagner<double> minCut;
@@ -188,6 +247,22 @@ go_bandit([] {
 		minCutTests<int>("int", minCut2, true);
 	});
 
+	describe("Parallel", [] {
+		for (unsigned int threads : {1, 4}) {
+			describe("with " + to_string(threads) + " threads", [&] {
+				MinimumCutParallel<double> minCut;
+				minCut.maxThreads(threads);
+				minCutTests<double>("double", minCut, true);
+				compareWithStoerWagner(minCut);
+
+				MinimumCutParallel<int> minCut2;
+				minCut2.maxThreads(threads);
+				minCutTests<int>("int", minCut2, true);
+				compareWithStoerWagner(minCut2);
+			});
+		}
+	});
+
 	describe("NagamochiIbaraki", [] {
 		describe("no preprocessing and no Padberg-Rinaldi heuristics", [] {
 			MinimumCutNagamochiIbaraki minCut {false, false, Logger::Level::Force};
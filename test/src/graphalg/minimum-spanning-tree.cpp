@@ -0,0 +1,181 @@
+/** \file
+ * \brief Tests for minimum spanning tree algorithms.
+ *
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.md in the OGDF root directory for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, see
+ * http://www.gnu.org/copyleft/gpl.html
+ */
+
+#include <ogdf/basic/DisjointSets.h>
+#include <ogdf/basic/EdgeArray.h>
+#include <ogdf/basic/Graph.h>
+#include <ogdf/basic/GraphCopy.h>
+#include <ogdf/basic/GraphList.h>
+#include <ogdf/basic/basic.h>
+#include <ogdf/basic/extended_graph_alg.h>
+#include <ogdf/basic/graph_generators/randomized.h>
+#include <ogdf/basic/internal/parallel_sort.h>
+#include <ogdf/basic/simple_graph_alg.h>
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <graphs.h>
+
+#include <testing.h>
+
+//! Assigns random weights in [1, \p maxWeight + 1) to the edges of \p G.
+//! Floating-point weights also get a random fractional part.
+template<typename T>
+static void randomWeights(const Graph& G, EdgeArray<T>& weight, int maxWeight, int seed) {
+	std::minstd_rand rng(seed);
+	std::uniform_int_distribution<int> dist(1, maxWeight);
+	weight.init(G);
+	for (edge e : G.edges) {
+		weight[e] = T(dist(rng)) + T(dist(rng) % 4) / T(4);
+	}
+}
+
+//! Checks that \p isInTree is a minimum spanning forest of \p G of weight \p total.
+template<typename T>
+static void assertMinSpanningForest(const Graph& G, const EdgeArray<T>& weight,
+		const EdgeArray<bool>& isInTree, T total) {
+	// a spanning forest
+	DisjointSets<> sets(G.maxNodeIndex() + 1);
+	for (int i = 0; i <= G.maxNodeIndex(); ++i) {
+		sets.makeSet();
+	}
+	int treeEdges = 0;
+	T treeWeight(0);
+	for (edge e : G.edges) {
+		if (isInTree[e]) {
+			AssertThat(sets.quickUnion(e->source()->index(), e->target()->index()), IsTrue());
+			++treeEdges;
+			treeWeight += weight[e];
+		}
+	}
+	AssertThat(treeEdges, Equals(G.numberOfNodes() - connectedComponents(G)));
+
+	// of minimum weight
+	GraphCopy copy(G);
+	EdgeArray<T> copyWeight(copy);
+	for (edge e : copy.edges) {
+		copyWeight[e] = weight[copy.original(e)];
+	}
+	T expected = makeMinimumSpanningTree(copy, copyWeight);
+	AssertThat(std::abs(double(treeWeight - total)), IsLessThan(1e-6 * (1 + std::abs(total))));
+	AssertThat(std::abs(double(expected - total)), IsLessThan(1e-6 * (1 + std::abs(total))));
+}
+
+template<typename T>
+static void describeParallelMinST(const std::string& typeName) {
+	for (unsigned int threads : {1u, 2u, 4u}) {
+		describe("with " + typeName + " weights using " + to_string(threads) + " thread(s)",
+				[threads] {
+					forEachGraphItWorks({}, [threads](const Graph& G) {
+						EdgeArray<T> weight;
+						randomWeights(G, weight, 10, G.numberOfEdges());
+						EdgeArray<bool> isInTree;
+						T total = parallelComputeMinST(G, weight, isInTree, threads);
+						assertMinSpanningForest(G, weight, isInTree, total);
+					});
+
+					for (int m : {60000, 200000}) {
+						it("works on a large graph with " + to_string(m) + " edges", [threads, m] {
+							Graph G;
+							randomGraph(G, 50000, m);
+							EdgeArray<T> weight;
+							randomWeights(G, weight, 100000, m);
+							EdgeArray<bool> isInTree;
+							T total = parallelComputeMinST(G, weight, isInTree, threads);
+							assertMinSpanningForest(G, weight, isInTree, total);
+						});
+					}
+
+					it("agrees with Prim's algorithm on a connected graph", [threads] {
+						Graph G;
+						randomSimpleConnectedGraph(G, 20000, 100000);
+						EdgeArray<T> weight;
+						randomWeights(G, weight, 5000, 3);
+						EdgeArray<bool> isInTree;
+						EdgeArray<bool> isInPrimTree;
+						T total = parallelComputeMinST(G, weight, isInTree, threads);
+						T primTotal = computeMinST(G, weight, isInPrimTree);
+						AssertThat(std::abs(double(total - primTotal)),
+								IsLessThan(1e-6 * (1 + std::abs(total))));
+					});
+				});
+	}
+
+	it("computes the same forest for any number of threads", [] {
+		Graph G;
+		randomGraph(G, 30000, 150000);
+		EdgeArray<T> weight;
+		// few distinct weights to make ties common
+		randomWeights(G, weight, 5, 17);
+		EdgeArray<bool> expected;
+		parallelComputeMinST(G, weight, expected, 1);
+		for (unsigned int threads : {2u, 3u, 4u}) {
+			EdgeArray<bool> isInTree;
+			parallelComputeMinST(G, weight, isInTree, threads);
+			for (edge e : G.edges) {
+				AssertThat(isInTree[e], Equals(expected[e]));
+			}
+		}
+	});
+}
+
+go_bandit([] {
+	describe("Parallel minimum spanning forest", [] {
+		describeParallelMinST<int>("int");
+		describeParallelMinST<double>("double");
+	});
+
+	describe("Parallel sort", [] {
+		for (int n : {0, 1, 1000, 100000, 300001}) {
+			it("sorts " + to_string(n) + " numbers", [n] {
+				std::minstd_rand rng(n);
+				std::vector<int> values(n);
+				for (int& x : values) {
+					x = rng() % 1000;
+				}
+				std::vector<int> expected(values);
+				std::sort(expected.begin(), expected.end());
+				for (unsigned int threads : {1u, 3u, 4u}) {
+					std::vector<int> sorted(values);
+					internal::parallelSort(sorted.begin(), sorted.end(), threads);
+					AssertThat(sorted, Equals(expected));
+				}
+				internal::parallelSort(values.begin(), values.end(), 4, std::greater<int>());
+				std::reverse(expected.begin(), expected.end());
+				AssertThat(values, Equals(expected));
+			});
+		}
+	});
+});
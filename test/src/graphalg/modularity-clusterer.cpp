@@ -0,0 +1,239 @@
+/** \file
+ * \brief Tests for ogdf::ModularityClusterer
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.md in the OGDF root directory for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, see
+ * http://www.gnu.org/copyleft/gpl.html
+ */
+
+#include <ogdf/basic/Graph.h>
+#include <ogdf/basic/GraphList.h>
+#include <ogdf/basic/List.h>
+#include <ogdf/basic/SList.h>
+#include <ogdf/basic/basic.h>
+#include <ogdf/basic/graph_generators.h>
+#include <ogdf/cluster/ClusterGraph.h>
+#include <ogdf/graphalg/ClustererModule.h>
+#include <ogdf/graphalg/ModularityClusterer.h>
+
+#include <string>
+#include <vector>
+
+#include <testing.h>
+
+//! Creates \p k cliques on \p size nodes each, joined in a ring by single edges, and returns
+//! the nodes of each clique in \p cliques.
+static void ringOfCliques(Graph& G, int k, int size, std::vector<std::vector<node>>& cliques) {
+	cliques.assign(k, std::vector<node>());
+	for (auto& clique : cliques) {
+		for (int i = 0; i < size; ++i) {
+			node v = G.newNode();
+			for (node w : clique) {
+				G.newEdge(v, w);
+			}
+			clique.push_back(v);
+		}
+	}
+	for (int i = 0; i < k && k > 1; ++i) {
+		G.newEdge(cliques[i].back(), cliques[(i + 1) % k].front());
+	}
+}
+
+//! Returns the modularity of \p clusterOf for unit weights.
+static double modularityOf(const Graph& G, const NodeArray<int>& clusterOf, int k) {
+	std::vector<double> inner(k, 0), volume(k, 0);
+	for (edge e : G.edges) {
+		volume[clusterOf[e->source()]] += 1;
+		volume[clusterOf[e->target()]] += 1;
+		if (clusterOf[e->source()] == clusterOf[e->target()]) {
+			inner[clusterOf[e->source()]] += 2;
+		}
+	}
+	double q = 0;
+	for (int c = 0; c < k; ++c) {
+		q += inner[c] - volume[c] * volume[c] / (2 * G.numberOfEdges());
+	}
+	return q / (2 * G.numberOfEdges());
+}
+
+//! Asserts that the subtree of \p c in \p C contains exactly the nodes of one top-level
+//! cluster of \p clusterer, if \p c is a child of the root, and returns its number of nodes.
+static int checkCluster(ModularityClusterer& clusterer, cluster c, int topLevel) {
+	int size = c->nCount();
+	for (node v : c->nodes) {
+		AssertThat(clusterer.clusters()[v], Equals(topLevel));
+	}
+	for (cluster child : c->children) {
+		AssertThat(child->cCount() + child->nCount(), IsGreaterThan(1));
+		size += checkCluster(clusterer, child, topLevel);
+	}
+	return size;
+}
+
+go_bandit([] {
+	describe("ModularityClusterer", [] {
+		for (unsigned int threads : {1u, 4u}) {
+			std::string suffix = " using " + to_string(threads) + " thread(s)";
+
+			it("separates two cliques joined by an edge" + suffix, [&] {
+				Graph G;
+				std::vector<std::vector<node>> cliques;
+				ringOfCliques(G, 2, 6, cliques);
+
+				ModularityClusterer clusterer(G);
+				clusterer.maxThreads(threads);
+				AssertThat(clusterer.numberOfClusters(), Equals(2));
+				for (const auto& clique : cliques) {
+					for (node v : clique) {
+						AssertThat(clusterer.clusters()[v],
+								Equals(clusterer.clusters()[clique.front()]));
+					}
+				}
+				AssertThat(clusterer.clusters()[cliques[0].front()],
+						!Equals(clusterer.clusters()[cliques[1].front()]));
+				AssertThat(clusterer.modularity(),
+						EqualsWithDelta(modularityOf(G, clusterer.clusters(), 2), 1e-12));
+			});
+
+			it("finds the cliques of a ring of cliques" + suffix, [&] {
+				Graph G;
+				std::vector<std::vector<node>> cliques;
+				ringOfCliques(G, 10, 6, cliques);
+
+				ModularityClusterer clusterer(G);
+				clusterer.maxThreads(threads);
+				AssertThat(clusterer.numberOfClusters(), Equals(10));
+				for (const auto& clique : cliques) {
+					for (node v : clique) {
+						AssertThat(clusterer.clusters()[v],
+								Equals(clusterer.clusters()[clique.front()]));
+					}
+					AssertThat(clusterer.computeCIndex(clique[1]), Equals(1.0));
+				}
+
+				// a tiny resolution merges everything
+				clusterer.resolution(1e-3);
+				AssertThat(clusterer.numberOfClusters(), Equals(1));
+			});
+
+			it("respects edge weights" + suffix, [&] {
+				Graph G;
+				std::vector<std::vector<node>> cliques;
+				ringOfCliques(G, 2, 6, cliques);
+				EdgeArray<double> weight(G, 1);
+				for (adjEntry adj : cliques[0].back()->adjEntries) {
+					weight[adj->theEdge()] = adj->twinNode() == cliques[1].front() ? 100 : 0.01;
+				}
+
+				ModularityClusterer clusterer(G);
+				clusterer.maxThreads(threads);
+				clusterer.setEdgeWeights(&weight);
+				AssertThat(clusterer.clusters()[cliques[0].back()],
+						Equals(clusterer.clusters()[cliques[1].front()]));
+			});
+
+			it("creates a consistent cluster hierarchy" + suffix, [&] {
+				Graph G;
+				randomSimpleGraph(G, 3000, 12000);
+				ModularityClusterer clusterer(G);
+				clusterer.maxThreads(threads);
+
+				ClusterGraph C(G);
+				clusterer.createClusterGraph(C);
+#ifdef OGDF_DEBUG
+				C.consistencyCheck();
+#endif
+				AssertThat(clusterer.modularity(), IsGreaterThan(0.2));
+				AssertThat(clusterer.modularity(),
+						EqualsWithDelta(modularityOf(G, clusterer.clusters(),
+												clusterer.numberOfClusters()),
+								1e-9));
+
+				int size = C.rootCluster()->nCount();
+				for (cluster c : C.rootCluster()->children) {
+					AssertThat(c->nCount() + c->cCount(), IsGreaterThan(1));
+					cluster d = c;
+					while (d->nodes.empty()) {
+						d = d->children.front();
+					}
+					size += checkCluster(clusterer, c, clusterer.clusters()[d->nodes.front()]);
+				}
+				AssertThat(size, Equals(G.numberOfNodes()));
+
+				SList<SimpleCluster*> sl;
+				clusterer.computeClustering(sl);
+				AssertThat(sl.size(), Equals(C.numberOfClusters()));
+				int simpleSize = 0;
+				for (SimpleCluster* s : sl) {
+					AssertThat(s->m_size, Equals(s->nodes().size()));
+					simpleSize += s->m_size;
+					delete s;
+				}
+				AssertThat(simpleSize, Equals(G.numberOfNodes()));
+			});
+		}
+
+		it("computes the same clustering with any number of threads", [] {
+			Graph G;
+			randomSimpleGraph(G, 20000, 100000);
+			ModularityClusterer sequential(G);
+			sequential.maxThreads(1);
+			ModularityClusterer parallel(G);
+			parallel.maxThreads(4);
+			AssertThat(parallel.numberOfClusters(), Equals(sequential.numberOfClusters()));
+			AssertThat(parallel.modularity(), Equals(sequential.modularity()));
+			for (node v : G.nodes) {
+				AssertThat(parallel.clusters()[v], Equals(sequential.clusters()[v]));
+			}
+		});
+
+		it("handles graphs without edges", [] {
+			Graph G;
+			ModularityClusterer clusterer(G);
+			AssertThat(clusterer.numberOfClusters(), Equals(0));
+
+			G.newNode();
+			G.newNode();
+			AssertThat(clusterer.numberOfClusters(), Equals(2));
+			AssertThat(clusterer.modularity(), Equals(0.0));
+		});
+
+		it("recomputes the clustering after the graph changes", [] {
+			Graph G;
+			std::vector<std::vector<node>> cliques;
+			ringOfCliques(G, 2, 6, cliques);
+			ModularityClusterer clusterer(G);
+			AssertThat(clusterer.numberOfClusters(), Equals(2));
+
+			std::vector<std::vector<node>> third;
+			ringOfCliques(G, 1, 6, third);
+			AssertThat(clusterer.numberOfClusters(), Equals(3));
+			AssertThat(clusterer.modularity(),
+					EqualsWithDelta(modularityOf(G, clusterer.clusters(), 3), 1e-12));
+
+			G.clear();
+			AssertThat(clusterer.numberOfClusters(), Equals(0));
+		});
+	});
+});
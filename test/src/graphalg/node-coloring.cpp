@@ -32,6 +32,7 @@
 #include <ogdf/basic/Graph.h>
 #include <ogdf/basic/GraphList.h>
 #include <ogdf/basic/Math.h>
+#include <ogdf/basic/graph_generators.h>
 #include <ogdf/graphalg/NodeColoringBergerRompel.h>
 #include <ogdf/graphalg/NodeColoringBoppanaHalldorsson.h>
 #include <ogdf/graphalg/NodeColoringHalldorsson.h>
@@ -40,6 +41,7 @@
 #include <ogdf/graphalg/NodeColoringRecursiveLargestFirst.h>
 #include <ogdf/graphalg/NodeColoringSequential.h>
 #include <ogdf/graphalg/NodeColoringSimple.h>
+#include <ogdf/graphalg/NodeColoringSpeculative.h>
 #include <ogdf/graphalg/NodeColoringWigderson.h>
 
 #include <functional>
@@ -92,6 +94,50 @@ static void describeModule(std::string&& moduleName, bool isSlow = false) {
 	});
 }
 
+static void describeNodeColoringSpeculative() {
+	describe("NodeColoringSpeculative", [] {
+		NodeColoringSpeculative module;
+		describeNodeColoringModule(module, false);
+
+		for (unsigned int threads : {1u, 4u}) {
+			std::string suffix = " using " + to_string(threads) + " thread(s)";
+
+			it("colors a large sparse graph" + suffix, [&] {
+				Graph graph;
+				randomGraph(graph, 50000, 250000);
+				module.maxThreads(threads);
+				NodeArray<NColor> colors(graph);
+				auto numColors = module.call(graph, colors, 3);
+				AssertThat(module.checkColoring(graph, colors), IsTrue());
+				for (node v : graph.nodes) {
+					AssertThat(colors[v], IsGreaterThanOrEqualTo(3u));
+					colors[v] -= 3;
+				}
+				AssertThat(numColors, Equals(getNumberOfUsedColors(graph, colors)));
+				AssertThat(module.rounds(), IsGreaterThan(0));
+			});
+
+			it("colors dense graphs with nodes of large degree" + suffix, [&] {
+				Graph graph;
+				completeGraph(graph, 300);
+				module.maxThreads(threads);
+				NodeArray<NColor> colors(graph);
+				AssertThat(module.call(graph, colors), Equals(300u));
+				AssertThat(module.checkColoring(graph, colors), IsTrue());
+
+				Graph bipartite;
+				completeBipartiteGraph(bipartite, 200, 200);
+				colors.init(bipartite);
+				auto numColors = module.call(bipartite, colors);
+				AssertThat(module.checkColoring(bipartite, colors), IsTrue());
+				if (threads == 1) {
+					AssertThat(numColors, Equals(2u));
+				}
+			});
+		}
+	});
+}
+
 go_bandit([]() {
 	describeModule<NodeColoringBergerRompel>("NodeColoringBergerRompel");
 	describeModule<NodeColoringBoppanaHalldorsson>("NodeColoringBoppanaHalldorsson");
@@ -100,5 +146,6 @@ go_bandit([]() {
 	describeModule<NodeColoringRecursiveLargestFirst>("NodeColoringRecursiveLargestFirst");
 	describeModule<NodeColoringSequential>("NodeColoringSequential");
 	describeModule<NodeColoringSimple>("NodeColoringSimple");
+	describeNodeColoringSpeculative();
 	describeModule<NodeColoringWigderson>("NodeColoringWigderson");
 });
@@ -0,0 +1,183 @@
+/** \file
+ * \brief Tests for the PageRank engine.
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.md in the OGDF root directory for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, see
+ * http://www.gnu.org/copyleft/gpl.html
+ */
+
+#include <ogdf/basic/ArrayBuffer.h>
+#include <ogdf/basic/Graph.h>
+#include <ogdf/basic/basic.h>
+#include <ogdf/basic/graph_generators.h>
+#include <ogdf/graphalg/PageRank.h>
+
+#include <string>
+#include <utility>
+
+#include <testing.h>
+
+using Method = PageRank::Method;
+
+/**
+ * Computes PageRank by a plain power iteration. Random jumps and the walks
+ * from dangling nodes go to a uniformly chosen node, or to \p s if it is not
+ * nullptr.
+ */
+static void referencePageRank(const Graph& G, const EdgeArray<double>* weight, bool directed,
+		node s, NodeArray<double>& rank) {
+	const double d = 0.85;
+	auto w = [&](edge e) { return weight == nullptr ? 1.0 : (*weight)[e]; };
+	NodeArray<double> out(G, 0.0);
+	for (edge e : G.edges) {
+		out[e->source()] += w(e);
+		if (!directed) {
+			out[e->target()] += w(e);
+		}
+	}
+
+	NodeArray<double> jump(G, s == nullptr ? 1.0 / G.numberOfNodes() : 0.0);
+	if (s != nullptr) {
+		jump[s] = 1;
+	}
+	rank = jump;
+	for (int i = 0; i < 300; ++i) {
+		double dangling = 0;
+		for (node v : G.nodes) {
+			if (out[v] == 0) {
+				dangling += rank[v];
+			}
+		}
+		NodeArray<double> next(G);
+		for (node v : G.nodes) {
+			next[v] = (1 - d + d * dangling) * jump[v];
+		}
+		for (edge e : G.edges) {
+			next[e->target()] += d * rank[e->source()] * w(e) / out[e->source()];
+			if (!directed) {
+				next[e->source()] += d * rank[e->target()] * w(e) / out[e->target()];
+			}
+		}
+		rank = next;
+	}
+}
+
+static void assertScores(const Graph& G, const PageRank& pageRank,
+		const NodeArray<double>& expected, double tolerance) {
+	double sum = 0;
+	for (node v : G.nodes) {
+		AssertThat(pageRank.score(v), EqualsWithDelta(expected[v], tolerance));
+		sum += pageRank.score(v);
+	}
+	AssertThat(sum, EqualsWithDelta(1.0, 1e-9));
+}
+
+go_bandit([] {
+	describe("PageRank", [] {
+		for (Method method : {Method::Jacobi, Method::GaussSeidel}) {
+			for (unsigned int threads : {1u, 4u}) {
+				std::string title = method == Method::Jacobi ? "Jacobi" : "Gauss-Seidel";
+				title += " iteration with " + to_string(threads) + " thread(s)";
+
+				it("computes PageRank using the " + title, [&] {
+					Graph G;
+					randomGraph(G, 20000, 80000);
+					NodeArray<double> expected;
+					referencePageRank(G, nullptr, true, nullptr, expected);
+
+					PageRank pageRank(G);
+					pageRank.method(method);
+					pageRank.maxThreads(threads);
+					AssertThat(pageRank.compute(), IsLessThan(pageRank.maxIterations()));
+					assertScores(G, pageRank, expected, 1e-9);
+
+					// a warm start converges at once
+					AssertThat(pageRank.compute(), IsLessThan(3));
+					assertScores(G, pageRank, expected, 1e-9);
+				});
+			}
+		}
+
+		it("computes PageRank of undirected weighted graphs", [] {
+			Graph G;
+			randomGraph(G, 1000, 3000);
+			EdgeArray<double> weight(G);
+			for (edge e : G.edges) {
+				weight[e] = randomDouble(0.5, 2);
+			}
+			NodeArray<double> expected;
+			referencePageRank(G, &weight, false, nullptr, expected);
+
+			PageRank pageRank(G, &weight, false);
+			pageRank.compute();
+			assertScores(G, pageRank, expected, 1e-9);
+		});
+
+		it("updates PageRank after edges and nodes were added or removed", [] {
+			Graph G;
+			randomGraph(G, 5000, 15000);
+			PageRank pageRank(G);
+			pageRank.compute();
+
+			for (int i = 0; i < 20; ++i) {
+				G.delEdge(G.chooseEdge());
+				G.newEdge(G.chooseNode(), G.chooseNode());
+			}
+			G.delNode(G.chooseNode());
+			node v = G.newNode();
+			G.newEdge(v, G.chooseNode());
+			AssertThat(pageRank.update(), IsGreaterThan(0));
+
+			NodeArray<double> expected;
+			referencePageRank(G, nullptr, true, nullptr, expected);
+			assertScores(G, pageRank, expected, 1e-9);
+		});
+
+		it("computes personalized PageRank", [] {
+			Graph G;
+			randomGraph(G, 2000, 6000);
+			node s = G.chooseNode();
+			NodeArray<double> expected;
+			referencePageRank(G, nullptr, true, s, expected);
+
+			PageRank pageRank(G);
+			ArrayBuffer<std::pair<node, double>> result;
+			pageRank.personalized(s, result, 1e-9);
+
+			NodeArray<double> score(G, 0.0);
+			double sum = 0;
+			for (int i = 0; i < result.size(); ++i) {
+				if (i > 0) {
+					AssertThat(result[i].second, IsLessThanOrEqualTo(result[i - 1].second));
+				}
+				score[result[i].first] = result[i].second;
+				sum += result[i].second;
+			}
+			AssertThat(sum, EqualsWithDelta(1.0, 1e-9));
+			for (node v : G.nodes) {
+				AssertThat(score[v], EqualsWithDelta(expected[v], 1e-5));
+			}
+		});
+	});
+});
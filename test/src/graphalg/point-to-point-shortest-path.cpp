@@ -0,0 +1,217 @@
+/** \file
+ * \brief Tests for the point-to-point shortest path query engine.
+ *
+ * \par License:
+ * This file is part of the Open Graph Drawing Framework (OGDF).
+ *
+ * \par
+ * Copyright (C)<br>
+ * See README.md in the OGDF root directory for details.
+ *
+ * \par
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * Version 2 or 3 as published by the Free Software Foundation;
+ * see the file LICENSE.txt included in the packaging of this file
+ * for details.
+ *
+ * \par
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU General Public
+ * License along with this program; if not, see
+ * http://www.gnu.org/copyleft/gpl.html
+ */
+
+#include <ogdf/basic/Array.h>
+#include <ogdf/basic/EpsilonTest.h>
+#include <ogdf/basic/Graph.h>
+#include <ogdf/basic/List.h>
+#include <ogdf/basic/Thread.h>
+#include <ogdf/basic/basic.h>
+#include <ogdf/basic/graph_generators.h>
+#include <ogdf/graphalg/Dijkstra.h>
+#include <ogdf/graphalg/PointToPointShortestPath.h>
+
+#include <atomic>
+#include <limits>
+#include <string>
+
+#include <testing.h>
+
+template<typename T>
+using Engine = PointToPointShortestPath<T>;
+
+//! Asserts that \p path is a (directed) path from \p s to \p t of length \p length.
+template<typename T>
+void validatePath(const List<edge>& path, node s, node t, const EdgeArray<T>& weight,
+		bool directed, T length) {
+	EpsilonTest eps;
+	T sum = 0;
+	node v = s;
+	for (edge e : path) {
+		AssertThat(e->isIncident(v), IsTrue());
+		if (directed) {
+			AssertThat(e->source(), Equals(v));
+		}
+		v = e->opposite(v);
+		sum += weight[e];
+	}
+	AssertThat(v, Equals(t));
+	AssertThat(eps.equal(sum, length), IsTrue());
+}
+
+template<typename T>
+void compareWithDijkstra(const Graph& G, const EdgeArray<T>& weight, bool directed) {
+	Engine<T> engine(G, weight, directed);
+	engine.computeLandmarks(4);
+	engine.contract();
+	typename Engine<T>::Workspace workspace(engine);
+
+	Dijkstra<T> dijkstra;
+	NodeArray<edge> pred;
+	NodeArray<T> distance;
+	EpsilonTest eps;
+
+	for (int i = 0; i < 5; ++i) {
+		node s = G.chooseNode();
+		dijkstra.call(G, weight, s, pred, distance, directed);
+
+		for (node t : G.nodes) {
+			for (auto algorithm : {Engine<T>::Algorithm::Bidirectional, Engine<T>::Algorithm::ALT,
+						 Engine<T>::Algorithm::CH}) {
+				List<edge> path;
+				T result = engine.query(s, t, workspace, algorithm, &path);
+				if (distance[t] == std::numeric_limits<T>::max()) {
+					AssertThat(result, Equals(Engine<T>::infinity()));
+					AssertThat(path.empty(), IsTrue());
+				} else {
+					AssertThat(eps.equal(result, distance[t]), IsTrue());
+					validatePath(path, s, t, weight, directed, result);
+				}
+			}
+		}
+	}
+}
+
+template<typename T>
+void describeEngine(const std::string& typeName) {
+	for (bool directed : {false, true}) {
+		std::string title = "[" + typeName + "] answers " + (directed ? "directed" : "undirected")
+				+ " queries like Dijkstra";
+
+		it(title + " on random graphs", [&] {
+			for (int i = 0; i < 5; ++i) {
+				Graph G;
+				randomSimpleGraph(G, randomNumber(30, 80), randomNumber(60, 240));
+				EdgeArray<T> weight(G);
+				for (edge e : G.edges) {
+					weight[e] = static_cast<T>(randomNumber(0, 20));
+				}
+				compareWithDijkstra(G, weight, directed);
+			}
+		});
+
+		it(title + " on grids", [&] {
+			Graph G;
+			gridGraph(G, 15, 15, false, false);
+			EdgeArray<T> weight(G);
+			for (edge e : G.edges) {
+				weight[e] = static_cast<T>(randomNumber(1, 5));
+			}
+			compareWithDijkstra(G, weight, directed);
+		});
+	}
+
+	it("[" + typeName + "] handles disconnected graphs and multi-edges", [] {
+		Graph G;
+		randomGraph(G, 40, 40);
+		EdgeArray<T> weight(G);
+		for (edge e : G.edges) {
+			weight[e] = static_cast<T>(randomNumber(1, 10));
+		}
+		compareWithDijkstra(G, weight, false);
+	});
+}
+
+go_bandit([] {
+	describe("PointToPointShortestPath", [] {
+		describeEngine<int>("int");
+		describeEngine<double>("double");
+
+		it("selects distinct landmarks", [] {
+			Graph G;
+			gridGraph(G, 10, 10, false, false);
+			EdgeArray<int> weight(G, 1);
+			Engine<int> engine(G, weight);
+			engine.computeLandmarks(8);
+			AssertThat(engine.numberOfLandmarks(), Equals(8));
+
+			engine.computeLandmarks(1000);
+			AssertThat(engine.numberOfLandmarks(), Equals(G.numberOfNodes()));
+		});
+
+		it("resets only the touched part of a workspace", [] {
+			Graph G;
+			gridGraph(G, 100, 100, false, false);
+			EdgeArray<int> weight(G, 1);
+			Engine<int> engine(G, weight);
+			typename Engine<int>::Workspace workspace(engine);
+
+			node s = G.firstNode();
+			node t = s->firstAdj()->twinNode();
+			AssertThat(engine.query(s, G.lastNode(), workspace), Equals(198));
+			AssertThat(engine.query(s, t, workspace), Equals(1));
+			AssertThat(workspace.numberOfTouchedNodes(), IsLessThan(20));
+		});
+
+		it("answers concurrent queries", [] {
+			Graph G;
+			randomSimpleGraph(G, 300, 900);
+			EdgeArray<int> weight(G);
+			for (edge e : G.edges) {
+				weight[e] = randomNumber(1, 100);
+			}
+			Engine<int> engine(G, weight);
+			engine.computeLandmarks(8);
+			engine.contract();
+
+			Array<node> nodes;
+			G.allNodes(nodes);
+			const int numberOfQueries = 200;
+			Array<node> source(numberOfQueries), target(numberOfQueries);
+			Array<int> expected(numberOfQueries);
+			for (int i = 0; i < numberOfQueries; ++i) {
+				source[i] = nodes[randomNumber(0, nodes.size() - 1)];
+				target[i] = nodes[randomNumber(0, nodes.size() - 1)];
+				expected[i] = engine.query(source[i], target[i]);
+			}
+
+			std::atomic<int> failures(0);
+			auto worker = [&] {
+				Engine<int>::Workspace workspace(engine);
+				for (int i = 0; i < numberOfQueries; ++i) {
+					if (engine.query(source[i], target[i], workspace, Engine<int>::Algorithm::ALT)
+									!= expected[i]
+							|| engine.query(source[i], target[i], workspace,
+									   Engine<int>::Algorithm::CH)
+									!= expected[i]) {
+						++failures;
+					}
+				}
+			};
+			Array<Thread> thread(4);
+			for (Thread& t : thread) {
+				t = Thread(worker);
+			}
+			for (Thread& t : thread) {
+				t.join();
+			}
+			AssertThat(failures.load(), Equals(0));
+		});
+	});
+});
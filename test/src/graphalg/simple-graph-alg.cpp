@@ -30,6 +30,7 @@
  */
 
 #include <ogdf/basic/Array.h>
+#include <ogdf/basic/ArrayBuffer.h>
 #include <ogdf/basic/CombinatorialEmbedding.h>
 #include <ogdf/basic/Graph.h>
 #include <ogdf/basic/GraphList.h>
@@ -43,6 +44,7 @@
 #include <algorithm>
 #include <functional>
 #include <initializer_list>
+#include <map>
 #include <set>
 #include <string>
 #include <utility>
@@ -621,6 +623,100 @@ static void describeStrongComponents() {
 	}
 }
 
+/**
+ * Assert that \p a and \p b assign the same partition to the nodes or edges
+ * in \p range, i.e., that there is a one-to-one mapping of their values.
+ */
+template<typename Range, typename ArrayType>
+void samePartitionAssert(const Range& range, const ArrayType& a, const ArrayType& b) {
+	std::map<int, int> aToB, bToA;
+	for (auto x : range) {
+		AssertThat(aToB.emplace(a[x], b[x]).first->second, Equals(b[x]));
+		AssertThat(bToA.emplace(b[x], a[x]).first->second, Equals(a[x]));
+	}
+}
+
+//! Compares the parallel connectivity algorithms with the sequential ones on \p G.
+static void parallelComponentsAssert(const Graph& G, unsigned int threads) {
+	NodeArray<int> expected(G), component(G);
+	List<node> expectedIsolated, isolated;
+	ArrayBuffer<node> expectedReprs, reprs;
+	AssertThat(parallelConnectedComponents(G, component, threads, &isolated, &reprs),
+			Equals(connectedComponents(G, expected, &expectedIsolated, &expectedReprs)));
+	for (node v : G.nodes) {
+		AssertThat(component[v], Equals(expected[v]));
+	}
+	AssertThat(isolated.size(), Equals(expectedIsolated.size()));
+	for (auto it = isolated.begin(), jt = expectedIsolated.begin(); it.valid(); ++it, ++jt) {
+		AssertThat(*it, Equals(*jt));
+	}
+	AssertThat(reprs.size(), Equals(expectedReprs.size()));
+	for (int i = 0; i < reprs.size(); ++i) {
+		AssertThat(reprs[i], Equals(expectedReprs[i]));
+	}
+
+	EdgeArray<int> expectedBlock(G), block(G);
+	int expectedNonEmpty = 0, nonEmpty = 0;
+	AssertThat(parallelBiconnectedComponents(G, block, nonEmpty, threads),
+			Equals(biconnectedComponents(G, expectedBlock, expectedNonEmpty)));
+	AssertThat(nonEmpty, Equals(expectedNonEmpty));
+	samePartitionAssert(G.edges, block, expectedBlock);
+
+	AssertThat(parallelStrongComponents(G, component, threads),
+			Equals(strongComponents(G, expected)));
+	samePartitionAssert(G.nodes, component, expected);
+}
+
+static void describeParallelComponents() {
+	for (unsigned int threads : {2u, 4u}) {
+		describe("using " + to_string(threads) + " thread(s)", [threads] {
+			forEachGraphItWorks({}, [threads](const Graph& G) {
+				parallelComponentsAssert(G, threads);
+			});
+
+			it("works on large sparse graphs", [threads] {
+				Graph G;
+				randomGraph(G, 50000, 55000);
+				parallelComponentsAssert(G, threads);
+			});
+
+			it("works on large graphs with a giant component", [threads] {
+				Graph G;
+				randomGraph(G, 50000, 100000);
+				for (int i = 0; i < 1000; ++i) {
+					node v = G.chooseNode();
+					G.newEdge(v, v);
+					G.newEdge(v, G.chooseNode());
+				}
+				for (int i = 0; i < 1000; ++i) {
+					G.delNode(G.chooseNode());
+				}
+				parallelComponentsAssert(G, threads);
+			});
+
+			it("works on a chain of cycles", [threads] {
+				Graph G;
+				node last = nullptr;
+				for (int i = 0; i < 2000; ++i) {
+					node first = G.newNode();
+					node v = first;
+					for (int j = 0; j < 10; ++j) {
+						node w = G.newNode();
+						G.newEdge(v, w);
+						v = w;
+					}
+					G.newEdge(v, first);
+					if (last != nullptr) {
+						G.newEdge(last, first);
+					}
+					last = v;
+				}
+				parallelComponentsAssert(G, threads);
+			});
+		});
+	}
+}
+
 static void describeIsArborescenceForest() {
 	Graph G;
 	List<node> roots;
@@ -943,6 +1039,8 @@ go_bandit([]() {
 
 		describe("strongComponents", []() { describeStrongComponents(); });
 
+		describe("parallel components", []() { describeParallelComponents(); });
+
 		describe("triangulate", []() { describeTriangulation(); });
 
 		describe("isAcyclic", []() { describeIsAcyclic(true); });
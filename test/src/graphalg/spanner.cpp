@@ -37,6 +37,8 @@
 #include <ogdf/basic/basic.h>
 #include <ogdf/basic/graph_generators/deterministic.h>
 #include <ogdf/basic/graph_generators/randomized.h>
+#include <ogdf/graphalg/DistanceOracleThorupZwick.h>
+#include <ogdf/graphalg/ShortestPathAlgorithms.h>
 #include <ogdf/graphalg/SpannerBasicGreedy.h>
 #include <ogdf/graphalg/SpannerBaswanaSen.h>
 #include <ogdf/graphalg/SpannerBerman.h>
@@ -46,8 +48,10 @@
 #include <ogdf/graphalg/SpannerKortsarzPeleg.h>
 #include <ogdf/graphalg/SpannerModule.h>
 
+#include <cstdint>
 #include <functional>
 #include <initializer_list>
+#include <limits>
 #include <set>
 #include <string>
 #include <utility>
@@ -266,6 +270,49 @@ void testSpannerIteratedWrapper(const std::string& should,
 	});
 }
 
+template<typename TWeight>
+void testDistanceOracle(const std::string& type) {
+	for (int k : {1, 2, 3}) {
+		for (unsigned int threads : {1u, 4u}) {
+			it("approximates " + type + " distances with stretch " + to_string(2 * k - 1)
+							+ " using " + to_string(threads) + " thread(s)",
+					[&] {
+						Graph G;
+						randomGraph(G, 300, 600);
+						EdgeArray<TWeight> weight(G);
+						for (edge e : G.edges) {
+							weight[e] = static_cast<TWeight>(randomNumber(0, 10));
+						}
+						NodeArray<NodeArray<TWeight>> distance(G);
+						dijkstra_SPAP(G, distance, weight);
+
+						DistanceOracleThorupZwick<TWeight> oracle;
+						oracle.maxThreads(threads);
+						oracle.init(G, weight, k);
+						AssertThat(oracle.k(), Equals(k));
+						int64_t size = 0;
+						for (node v : G.nodes) {
+							size += oracle.bunchSize(v);
+						}
+						AssertThat(oracle.size(), Equals(size));
+
+						for (node u : G.nodes) {
+							for (node v : G.nodes) {
+								TWeight estimate = oracle.distance(u, v);
+								if (distance[u][v] == std::numeric_limits<TWeight>::max()) {
+									AssertThat(estimate, Equals(distance[u][v]));
+								} else {
+									AssertThat(estimate, IsGreaterThanOrEqualTo(distance[u][v]));
+									AssertThat(estimate,
+											IsLessThanOrEqualTo((2 * k - 1) * distance[u][v]));
+								}
+							}
+						}
+					});
+		}
+	}
+}
+
 go_bandit([] {
 	describe("IteratedWrapper", [] {
 		testSpannerIteratedWrapper("propagates errors",
@@ -350,6 +397,32 @@ go_bandit([] {
 		});
 		testTimelimit<SpannerBaswanaSen<int>>(false, 1.0);
 		testTimelimit<SpannerBaswanaSen<double>>(false, 1.0);
+		for (double stretch : {3.0, 5.0}) {
+			it("computes a " + to_string(stretch) + "-spanner using 4 threads", [&] {
+				Graph G;
+				randomSimpleGraph(G, 2000, 20000);
+				GraphAttributes GA(G, 0);
+				GA.directed() = false;
+				makeWeighted<int>(GA);
+
+				GraphCopySimple spanner;
+				EdgeArray<bool> inSpanner;
+				SpannerBaswanaSen<int> sm;
+				sm.maxThreads(4);
+				AssertThat(sm.call(GA, stretch, spanner, inSpanner),
+						Equals(SpannerModule<int>::ReturnType::Feasible));
+				AssertThat(spanner.numberOfEdges(), IsLessThan(G.numberOfEdges()));
+				for (edge e : G.edges) {
+					AssertThat(inSpanner[e], Equals(spanner.copy(e) != nullptr));
+				}
+				AssertThat(SpannerModule<int>::isMultiplicativeSpanner(GA, spanner, stretch),
+						IsTrue());
+			});
+		}
+	});
+	describe("DistanceOracleThorupZwick", [] {
+		testDistanceOracle<int>("int");
+		testDistanceOracle<double>("double");
 	});
 	describe("SpannerKortsarzPeleg", [] {
 		describe("general graphs", [] {
@@ -640,6 +640,32 @@ static void testFullComponentGeneratorDreyfusWagner() {
 
 		AssertThat(testComponents(arg, fcg, 3), Equals(0));
 	});
+
+	it("generates the same components with several threads", [&] {
+		Arguments<T> arg;
+		apspStandard(*S, arg);
+
+		FCG sequential(S->graph, S->terminals, S->isTerminal, arg.distance, arg.pred);
+		sequential.maxThreads(1);
+		sequential.call(5);
+		FCG parallel(S->graph, S->terminals, S->isTerminal, arg.distance, arg.pred);
+		parallel.maxThreads(4);
+		parallel.call(5);
+
+		for (int k = 2; k <= 5; ++k) {
+			SubsetEnumerator<node> terminalSubset(S->terminals);
+			for (terminalSubset.begin(k); terminalSubset.valid(); terminalSubset.next()) {
+				List<node> terminals;
+				terminalSubset.list(terminals);
+				EdgeWeightedGraphCopy<T> expected, actual;
+				AssertThat(parallel.getSteinerTreeFor(terminals, actual),
+						Equals(sequential.getSteinerTreeFor(terminals, expected)));
+				AssertThat(actual.numberOfEdges(), Equals(expected.numberOfEdges()));
+				AssertThat(parallel.isValidComponent(actual),
+						Equals(sequential.isValidComponent(expected)));
+			}
+		}
+	});
 }
 
 template<typename T>
@@ -654,6 +680,14 @@ static void describeFullComponentGenerators(const std::string&& type) {
 
 		steiner_tree::Full3ComponentGeneratorEnumeration<T> fcgEnumeration;
 		testFull3ComponentGeneratorModule("Enumeration", fcgEnumeration);
+
+		steiner_tree::Full3ComponentGeneratorVoronoi<T> fcgVoronoiParallel;
+		fcgVoronoiParallel.maxThreads(4);
+		testFull3ComponentGeneratorModule("Voronoi (4 threads)", fcgVoronoiParallel);
+
+		steiner_tree::Full3ComponentGeneratorEnumeration<T> fcgEnumerationParallel;
+		fcgEnumerationParallel.maxThreads(4);
+		testFull3ComponentGeneratorModule("Enumeration (4 threads)", fcgEnumerationParallel);
 	});
 	describe("FullComponentGeneratorDreyfusWagner<" + type + ">",
 			[&] { testFullComponentGeneratorDreyfusWagner<T>(); });
@@ -164,6 +164,11 @@ static void testPrecomposedReductions(int numberOfTests) {
 			{"fast reductions", [](SteinerTreePreprocessing<T>& stprep) { stprep.reduceFast(); }},
 			{"fast reductions with dual-ascent-based test",
 					[](SteinerTreePreprocessing<T>& stprep) { stprep.reduceFastAndDualAscent(); }},
+			{"fast reductions using 4 threads",
+					[](SteinerTreePreprocessing<T>& stprep) {
+						stprep.maxThreads(4);
+						stprep.reduceFast();
+					}},
 	};
 	for (const auto& reduction : reductions) {
 		describe(reduction.first, [numberOfTests, &reduction]() {
@@ -267,12 +272,65 @@ static void testWildMixesOfReductions(string typeName, int numberOfTests) {
 	}
 }
 
+template<typename T>
+static void testStatistics() {
+	using Reduction = typename SteinerTreePreprocessing<T>::Reduction;
+
+	it("records the removed nodes and edges of all reductions", [] {
+		EdgeWeightedGraph<T> wg;
+		List<node> terminals;
+		NodeArray<bool> isTerminal;
+		randomEdgeWeightedGraph<T>(100, 300, 20, 1000, wg, terminals, isTerminal);
+
+		SteinerTreePreprocessing<T> stprep(wg, terminals, isTerminal);
+		stprep.reduceFastAndDualAscent();
+
+		int removedNodes = 0;
+		int removedEdges = 0;
+		for (int i = 0; i < SteinerTreePreprocessing<T>::numberOfReductions; ++i) {
+			const auto& statistics = stprep.statistics(static_cast<Reduction>(i));
+			AssertThat(statistics.successfulCalls, IsLessThanOrEqualTo(statistics.calls));
+			AssertThat(statistics.seconds, IsGreaterThanOrEqualTo(0.0));
+			removedNodes += statistics.removedNodes;
+			removedEdges += statistics.removedEdges;
+		}
+		AssertThat(stprep.statistics(Reduction::degree2).calls, IsGreaterThan(0));
+		AssertThat(removedNodes,
+				Equals(wg.numberOfNodes() - stprep.getReducedGraph().numberOfNodes()));
+		AssertThat(removedEdges,
+				Equals(wg.numberOfEdges() - stprep.getReducedGraph().numberOfEdges()));
+
+		stprep.resetStatistics();
+		AssertThat(stprep.statistics(Reduction::degree2).calls, Equals(0));
+	});
+
+	it("skips reductions that did not change the current graph", [] {
+		EdgeWeightedGraph<T> wg;
+		List<node> terminals;
+		NodeArray<bool> isTerminal;
+		randomEdgeWeightedGraph<T>(100, 300, 20, 1000, wg, terminals, isTerminal);
+
+		SteinerTreePreprocessing<T> stprep(wg, terminals, isTerminal);
+		stprep.reduceTrivial();
+		int calls = stprep.statistics(Reduction::degree2).calls;
+
+		AssertThat(stprep.reduceTrivial(), IsFalse());
+		AssertThat(stprep.statistics(Reduction::degree2).calls, Equals(calls));
+		AssertThat(stprep.statistics(Reduction::degree2).skippedCalls, Equals(1));
+
+		stprep.shuffleReducedTerminals();
+		AssertThat(stprep.reduceTrivial(), IsFalse());
+		AssertThat(stprep.statistics(Reduction::degree2).calls, Equals(calls + 1));
+	});
+}
+
 template<typename T>
 static void registerSuite(const string& typeName) {
 	describe("basic reductions (" + typeName + ")", []() { testBasicReductions<T>(15); });
 	describe_skip("mix of all subsets of reductions (" + typeName + ")",
 			[&typeName]() { testWildMixesOfReductions<T>(typeName, 3); });
 	describe("precomposed reductions (" + typeName + ")", []() { testPrecomposedReductions<T>(15); });
+	describe("reduction statistics (" + typeName + ")", []() { testStatistics<T>(); });
 }
 
 go_bandit([]() {
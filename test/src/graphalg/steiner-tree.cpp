@@ -50,6 +50,7 @@
 #include <ogdf/graphalg/MinSteinerTreeZelikovsky.h>
 #include <ogdf/graphalg/steiner_tree/EdgeWeightedGraph.h>
 #include <ogdf/graphalg/steiner_tree/EdgeWeightedGraphCopy.h>
+#include <ogdf/tree/LCALinear.h>
 
 #include <ogdf/external/abacus.h>
 
@@ -549,6 +550,28 @@ static void registerGoemans139Variants(Modules<T>& modules) {
 	}
 }
 
+/**
+ * Registers instances of the algorithms whose save calculation uses LCALinear
+ */
+template<typename T>
+static void registerLCALinearVariants(Modules<T>& modules) {
+	using Zelikovsky = MinSteinerTreeZelikovsky<T, LCALinear>;
+	Zelikovsky* staticSave = new Zelikovsky();
+	staticSave->saveCalculation(Zelikovsky::SaveCalculation::staticLCATree);
+	addModule(modules, "Zelikovsky with LCALinear, static LCATree save calculation", staticSave,
+			11 / 6.0);
+	Zelikovsky* dynamicSave = new Zelikovsky();
+	dynamicSave->saveCalculation(Zelikovsky::SaveCalculation::dynamicLCATree);
+	addModule(modules, "Zelikovsky with LCALinear, dynamic LCATree save calculation", dynamicSave,
+			11 / 6.0);
+
+	for (int maxCompSize = 3; maxCompSize < 5; ++maxCompSize) {
+		addModule(modules,
+				"RZLoss with LCALinear and maximum component size of " + to_string(maxCompSize),
+				new MinSteinerTreeRZLoss<T, LCALinear>(maxCompSize), 2, {14, 25});
+	}
+}
+
 /**
  * Registers a complete Steiner test suite for a given
  * template parameter, like int or double.
@@ -572,6 +595,7 @@ void registerSuite(const std::string typeName) {
 		registerZelikovskyVariants<T>(modules);
 		registerRZLossVariants<T>(modules);
 		registerGoemans139Variants<T>(modules);
+		registerLCALinearVariants<T>(modules);
 
 		// register suites
 		for (auto& module : modules) {
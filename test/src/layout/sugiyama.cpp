@@ -115,5 +115,15 @@ go_bandit([] {
 		DESCRIBE_SUGI_LAYOUT(FastSimpleHierarchyLayout, {GraphProperty::sparse});
 		describeSugi<OptimalHierarchyLayout>("OptimalHierarchyLayout",
 				{GraphProperty::simple, GraphProperty::sparse});
+
+		describe("with crossing minimization windows", [] {
+			SugiyamaLayout sugi;
+			sugi.runs(2);
+			sugi.windowSize(3);
+
+			DESCRIBE_SUGI_CROSSMIN(BarycenterHeuristic, sugi, {GraphProperty::sparse});
+			DESCRIBE_SUGI_CROSSMIN(MedianHeuristic, sugi, {GraphProperty::sparse});
+			DESCRIBE_SUGI_CROSSMIN(SplitHeuristic, sugi, {GraphProperty::sparse});
+		});
 	});
 });
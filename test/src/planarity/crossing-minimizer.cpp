@@ -49,9 +49,11 @@
 #include <ogdf/planarity/VariableEmbeddingInserter.h>
 #include <ogdf/planarity/VariableEmbeddingInserterDyn.h>
 
+#include <atomic>
 #include <exception>
 #include <functional>
 #include <initializer_list>
+#include <limits>
 #include <sstream>
 #include <string>
 
@@ -315,6 +317,9 @@ void testSPRRType(SubgraphPlanarizer& heuristic, EdgeInserter* edgeInserter,
 		testModule(heuristic, "single run", false);
 		heuristic.permutations(4);
 		testModule(heuristic, "4 permutations", false);
+		heuristic.boundedInsertion(true);
+		testModule(heuristic, "4 permutations with bounded insertion", false);
+		heuristic.boundedInsertion(false);
 	};
 
 	string title = "remove-reinsert: " + name;
@@ -336,6 +341,26 @@ void testSPEdgeInserter(EdgeInserter* edgeInserter, const std::string name) {
 		testSPRRType(heuristic, edgeInserter, RemoveReinsertType::All, "all");
 		testSPRRType(heuristic, edgeInserter, RemoveReinsertType::Incremental, "incremental");
 		testSPRRType(heuristic, edgeInserter, RemoveReinsertType::IncInserted, "inc-inserted");
+
+		for (unsigned int threads : {1, 2}) {
+			it("keeps the crossing bound of the inserter using " + to_string(threads)
+							+ " thread(s)",
+					[&heuristic, edgeInserter, threads]() {
+						std::atomic<int> bound(std::numeric_limits<int>::max());
+						edgeInserter->crossingBound(&bound);
+						heuristic.permutations(4);
+						heuristic.maxThreads(threads);
+						heuristic.boundedInsertion(true);
+
+						Graph graph;
+						completeGraph(graph, 6);
+						testComputation(heuristic, graph, 3, false);
+						AssertThat(edgeInserter->crossingBound(), Equals(&bound));
+
+						edgeInserter->crossingBound(nullptr);
+						heuristic.boundedInsertion(false);
+					});
+		}
 	});
 }
 
@@ -161,6 +161,30 @@ void describeEmbedder<EmbedderMinDepthPiTa>(const string& title) {
 	describeEmbedder(title + " [extendedDD=" + to_string(!extendedDD) + "]", embedder, reqs);
 }
 
+template<typename EmbedderType>
+void describeThreadedEmbedder(const string& title) {
+	EmbedderType embedder;
+	embedder.maxThreads(1);
+	describeEmbedder(title + " [maxThreads=1]", embedder);
+	embedder.maxThreads(4);
+	describeEmbedder(title + " [maxThreads=4]", embedder);
+}
+
+template<>
+void describeEmbedder<EmbedderMaxFace>(const string& title) {
+	describeThreadedEmbedder<EmbedderMaxFace>(title);
+}
+
+template<>
+void describeEmbedder<EmbedderMinDepth>(const string& title) {
+	describeThreadedEmbedder<EmbedderMinDepth>(title);
+}
+
+template<>
+void describeEmbedder<EmbedderMinDepthMaxFace>(const string& title) {
+	describeThreadedEmbedder<EmbedderMinDepthMaxFace>(title);
+}
+
 // TODO currently skipped since these tests are failing.
 template<>
 void describeEmbedder<EmbedderOptimalFlexDraw>(const string& title) {
@@ -41,13 +41,17 @@
 #include <ogdf/basic/graph_generators.h>
 #include <ogdf/basic/graphics.h>
 #include <ogdf/basic/simple_graph_alg.h>
+#include <ogdf/fileformats/GraphIO.h>
 #include <ogdf/graphalg/MaxFlowSTPlanarItaiShiloach.h>
 #include <ogdf/graphalg/MinSTCutMaxFlow.h>
+#include <ogdf/planarity/BatchPlanarityTest.h>
 #include <ogdf/planarity/BoothLueker.h>
 #include <ogdf/planarity/BoyerMyrvold.h>
 #include <ogdf/planarity/CrossingMinimizationModule.h>
 #include <ogdf/planarity/ExtractKuratowskis.h>
+#include <ogdf/planarity/IncrementalPlanarityTest.h>
 #include <ogdf/planarity/KuratowskiSubdivision.h>
+#include <ogdf/planarity/LRPlanarityTest.h>
 #include <ogdf/planarity/NonPlanarCore.h>
 #include <ogdf/planarity/PlanRep.h>
 #include <ogdf/planarity/PlanarityModule.h>
@@ -60,6 +64,7 @@
 #include <limits>
 #include <random>
 #include <set>
+#include <sstream>
 #include <string>
 #include <vector>
 
@@ -140,6 +145,172 @@ void describeModule(const std::string& name, PlanarityModule& pm) {
 	});
 }
 
+void describeLRPlanarityTest() {
+	describe("Left-right planarity test", []() {
+		LRPlanarityTest test;
+
+		it("agrees with the planar embedding on random graphs", [&]() {
+			BoyerMyrvold bm;
+			for (int i = 0; i < 200; ++i) {
+				Graph G;
+				randomGraph(G, 10 + i % 20, 15 + (i * 7) % 40);
+				bool planar = test.isPlanar(G);
+				AssertThat(planar, Equals(bm.planarEmbed(G)));
+			}
+		});
+
+		it("recognizes K5 and K3,3 given as edge lists with self-loops and multi-edges", [&]() {
+			std::vector<int> source, target;
+			for (int u = 0; u < 5; ++u) {
+				for (int v = u + 1; v < 5; ++v) {
+					source.push_back(u);
+					target.push_back(v);
+					source.push_back(v);
+					target.push_back(u);
+				}
+				source.push_back(u);
+				target.push_back(u);
+			}
+			AssertThat(test.isPlanar(5, source, target), IsFalse());
+
+			test.clear();
+			for (int u = 0; u < 3; ++u) {
+				for (int v = 3; v < 6; ++v) {
+					test.addEdge(u, v);
+				}
+			}
+			AssertThat(test.isPlanar(6), IsFalse());
+
+			test.clear();
+			for (int u = 0; u < 3; ++u) {
+				for (int v = 3; v < 6; ++v) {
+					if (u != 0 || v != 3) {
+						test.addEdge(u, v);
+						test.addEdge(v, u);
+					}
+				}
+			}
+			AssertThat(test.isPlanar(6), IsTrue());
+		});
+
+		it("works on long paths", [&]() {
+			Graph G;
+			gridGraph(G, 2, 100000, false, false);
+			AssertThat(test.isPlanar(G), IsTrue());
+
+			G.newEdge(G.firstNode(), G.lastNode());
+			AssertThat(test.isPlanar(G), IsTrue());
+			completeGraph(G, 5);
+			AssertThat(test.isPlanar(G), IsFalse());
+		});
+	});
+}
+
+void describeBatchPlanarityTest() {
+	describe("Batch planarity test", []() {
+		const int count = 100;
+		Array<Graph> graphs(count);
+		std::vector<bool> expected(count);
+		BoyerMyrvold bm;
+		for (int i = 0; i < count; ++i) {
+			randomSimpleGraph(graphs[i], 8 + i % 10, 12 + i % 17);
+			expected[i] = bm.isPlanar(graphs[i]);
+		}
+
+		BatchPlanarityTest batch;
+		batch.maxThreads(4);
+
+		it("tests graphs", [&]() {
+			std::vector<const Graph*> input;
+			for (const Graph& G : graphs) {
+				input.push_back(&G);
+			}
+			std::vector<bool> planar;
+			batch.isPlanar(input, planar);
+			AssertThat(planar, Equals(expected));
+		});
+
+		it("embeds graphs", [&]() {
+			std::vector<Graph*> input;
+			for (Graph& G : graphs) {
+				input.push_back(&G);
+			}
+			std::vector<bool> planar;
+			batch.planarEmbed(input, planar);
+			AssertThat(planar, Equals(expected));
+			for (int i = 0; i < count; ++i) {
+				AssertThat(graphs[i].representsCombEmbedding(), Equals(bool(expected[i])));
+			}
+		});
+
+		it("tests graph6 streams", [&]() {
+			std::stringstream ss;
+			for (const Graph& G : graphs) {
+				GraphIO::writeGraph6(G, ss);
+			}
+			std::vector<bool> planar;
+			AssertThat(batch.isPlanarGraph6(ss, planar), IsTrue());
+			AssertThat(planar, Equals(expected));
+
+			AssertThat(batch.isPlanarGraph6({"D~{", "D~", "DQc"}, planar), IsFalse());
+			AssertThat(planar, Equals(std::vector<bool> {false, false, true}));
+		});
+
+		it("tests long graph6 streams in batches", [&]() {
+			std::stringstream ss;
+			std::vector<bool> expectedLong;
+			for (int i = 0; i < 10000; ++i) {
+				ss << (i % 3 == 0 ? "D~{" : "DQc") << "\n";
+				expectedLong.push_back(i % 3 != 0);
+			}
+			std::vector<bool> planar;
+			AssertThat(batch.isPlanarGraph6(ss, planar), IsTrue());
+			AssertThat(planar, Equals(expectedLong));
+		});
+	});
+}
+
+void describeIncrementalPlanarityTest() {
+	describe("Incremental planarity test", []() {
+		for (int n : {10, 30, 100}) {
+			it("maintains a maximal planar subgraph of a random graph with " + to_string(n)
+							+ " nodes",
+					[&]() {
+						Graph G;
+						randomSimpleGraph(G, n, 4 * n);
+						Graph H;
+						NodeArray<node> copy(G);
+						for (node v : G.nodes) {
+							copy[v] = H.newNode();
+						}
+
+						IncrementalPlanarityTest oracle(G);
+						for (edge e : G.edges) {
+							edge f = H.newEdge(copy[e->source()], copy[e->target()]);
+							bool planar = isPlanar(H);
+							node u = e->source(), v = e->target();
+							AssertThat(oracle.isPlanarWith(u, v), Equals(planar));
+							AssertThat(oracle.tryInsert(u, v), Equals(planar));
+							if (!planar) {
+								H.delEdge(f);
+							}
+						}
+
+						AssertThat(oracle.numberOfEdges(), Equals(H.numberOfEdges()));
+						// biconnectedComponents() also counts isolated nodes
+						EdgeArray<int> component(H);
+						int blocks = biconnectedComponents(H, component);
+						for (node v : H.nodes) {
+							if (v->degree() == 0) {
+								--blocks;
+							}
+						}
+						AssertThat(oracle.numberOfBlocks(), Equals(blocks));
+					});
+		}
+	});
+}
+
 void describeDestructiveBoyerMyrvold(bool bundles, bool limitStructures, bool randomDFSTree,
 		bool avoidE2Minors) {
 	// bundles on big non-planar graphs takes too long.
@@ -472,6 +643,9 @@ go_bandit([]() {
 		BoyerMyrvold bm;
 		describeModule("Boyer-Myrvold", bm);
 		describeDestructiveBoyerMyrvold();
+		describeLRPlanarityTest();
+		describeBatchPlanarityTest();
+		describeIncrementalPlanarityTest();
 
 		it("transforms based on the right graph, when it's a GraphCopySimple", []() {
 			Graph G;